@@ -0,0 +1,500 @@
+/**
+ * @file GLCallTracer.hpp
+ * @brief Counts, and optionally logs, the OpenGL calls issued each frame by wrapping the glad function table
+ *
+ * @copyright MIT License
+ *
+ *	These functions, classes, and constants help minimize common
+ *	code that needs to be written.
+ */
+
+#ifndef CSCI441_GL_CALL_TRACER_HPP
+#define CSCI441_GL_CALL_TRACER_HPP
+
+#ifdef CSCI441_USE_GLEW
+    #include <GL/glew.h>
+#else
+    #include <glad/gl.h>
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <type_traits>
+
+namespace CSCI441_INTERNAL {
+    template<auto* SLOT, typename PROC> struct GLCallHook;
+}
+
+namespace CSCI441 {
+
+    /**
+     * @brief Counts every OpenGL call the engine issues, grouped by category and per frame
+     * @note install() replaces the glad function pointers used by this project with wrappers that
+     * count the call, optionally write its name to a log, and forward to the driver.  Calls are
+     * counted without synchronization: only the thread that owns the context may issue them, and
+     * ownership changes (glfwMakeContextCurrent on another thread) must already be synchronized.
+     * @note only the glad loader can be traced; with CSCI441_USE_GLEW install() does nothing
+     */
+    class GLCallTracer final {
+    public:
+        /**
+         * @brief groups of OpenGL calls reported separately
+         */
+        enum Category {
+            /**
+             * @brief glDraw* calls
+             */
+            DRAW,
+            /**
+             * @brief glUniform* and glProgramUniform* uploads
+             */
+            UNIFORM,
+            /**
+             * @brief glBufferData and glBufferSubData updates
+             */
+            BUFFER,
+            /**
+             * @brief texture image and parameter updates
+             */
+            TEXTURE,
+            /**
+             * @brief binds, program changes, vertex attribute setup and fixed function state
+             */
+            STATE,
+            /**
+             * @brief clears, blits and framebuffer binds
+             */
+            FRAMEBUFFER,
+            /**
+             * @brief glGet* and glIs* queries, which may stall the pipeline until the driver catches up
+             */
+            QUERY,
+            /**
+             * @brief creation, deletion, compilation and linking of OpenGL objects
+             */
+            OBJECT,
+            /**
+             * @brief number of categories
+             */
+            NUM_CATEGORIES
+        };
+
+        /**
+         * @brief number of calls in each category
+         * @note value initialize (Counts{}) to start from zero
+         */
+        struct Counts {
+            /**
+             * @brief calls indexed by Category
+             */
+            GLuint64 calls[NUM_CATEGORIES];
+
+            /**
+             * @brief returns the calls in every category
+             */
+            [[nodiscard]] GLuint64 total() const noexcept {
+                GLuint64 sum = 0;
+                for( GLuint64 count : calls ) sum += count;
+                return sum;
+            }
+        };
+
+        /**
+         * @brief wraps the loaded glad function pointers with counting wrappers
+         * @note call after the function pointers have been loaded; functions the driver does not
+         * provide are left untouched.  Calling again has no effect.
+         */
+        static void install();
+        /**
+         * @brief restores the original glad function pointers
+         */
+        static void uninstall();
+        /**
+         * @brief returns if the wrappers are installed
+         */
+        [[nodiscard]] static bool isInstalled() noexcept { return _installed; }
+
+        /**
+         * @brief writes the name of every traced call to a file, one per line, with a line
+         * marking the end of each frame
+         * @param FILENAME file to create
+         * @return true if the file could be opened
+         */
+        static bool startLogging(const char* FILENAME);
+        /**
+         * @brief closes the log opened with startLogging()
+         */
+        static void stopLogging();
+
+        /**
+         * @brief closes the current frame
+         * @return calls issued during the frame that just ended
+         */
+        static const Counts& endFrame();
+
+        /**
+         * @brief returns the calls issued since the last endFrame()
+         */
+        [[nodiscard]] static const Counts& getCurrentFrame() noexcept { return _currentFrame; }
+        /**
+         * @brief returns the calls issued during the last completed frame
+         */
+        [[nodiscard]] static const Counts& getLastFrame() noexcept { return _lastFrame; }
+        /**
+         * @brief returns the calls issued since install(), including the current frame
+         */
+        [[nodiscard]] static Counts getTotals() noexcept;
+        /**
+         * @brief returns the most calls of each category issued in a single completed frame
+         */
+        [[nodiscard]] static const Counts& getMaxPerFrame() noexcept { return _maxPerFrame; }
+        /**
+         * @brief returns the number of completed frames
+         */
+        [[nodiscard]] static GLuint64 getNumFrames() noexcept { return _numFrames; }
+
+        /**
+         * @brief returns the name of a category for reports
+         */
+        [[nodiscard]] static const char* getCategoryName(Category category) noexcept;
+
+        /**
+         * @brief prints the average and maximum calls per frame of each category and the most
+         * frequently called functions
+         */
+        static void printReport();
+
+    private:
+        template<auto* SLOT, typename PROC> friend struct CSCI441_INTERNAL::GLCallHook;
+
+        struct Function {
+            const char* name;
+            Category category;
+            GLuint64 calls;
+            void (*restore)();
+        };
+        static constexpr GLuint MAX_FUNCTIONS = 192;
+
+        template<auto* SLOT>
+        static void _wrap(const char* NAME, Category category);
+        static void _record(GLuint FUNCTION) noexcept;
+
+        inline static Function _functions[MAX_FUNCTIONS] = {};
+        inline static GLuint _numFunctions = 0;
+        inline static bool _installed = false;
+        inline static FILE* _log = nullptr;
+
+        inline static Counts _currentFrame;
+        inline static Counts _lastFrame;
+        inline static Counts _completedFrames;
+        inline static Counts _maxPerFrame;
+        inline static GLuint64 _numFrames = 0;
+    };
+}
+
+//**********************************************************************************
+
+#ifndef CSCI441_USE_GLEW
+
+namespace CSCI441_INTERNAL {
+    /**
+     * @brief replacement for the glad function pointer stored in SLOT
+     * @note one instantiation per wrapped function holds the driver's pointer
+     */
+    template<auto* SLOT, typename R, typename... ARGS>
+    struct GLCallHook<SLOT, R (GLAD_API_PTR *)(ARGS...)> {
+        inline static R (GLAD_API_PTR *original)(ARGS...) = nullptr;
+        inline static GLuint index = 0;
+
+        static R GLAD_API_PTR call(ARGS... args) {
+            CSCI441::GLCallTracer::_record(index);
+            return original(args...);
+        }
+        static void restore() {
+            *SLOT = original;
+        }
+    };
+}
+
+template<auto* SLOT>
+inline void CSCI441::GLCallTracer::_wrap(const char* NAME, const Category category) {
+    using Hook = CSCI441_INTERNAL::GLCallHook<SLOT, std::remove_pointer_t<decltype(SLOT)>>;
+    if( *SLOT == nullptr || *SLOT == &Hook::call ) return;
+    if( _numFunctions == MAX_FUNCTIONS ) {
+        fprintf(stderr, "[WARN]: GL call tracer cannot wrap %s, all %u slots are in use\n", NAME, MAX_FUNCTIONS);
+        return;
+    }
+
+    Hook::original = *SLOT;
+    Hook::index = _numFunctions;
+    *SLOT = &Hook::call;
+    _functions[_numFunctions++] = { NAME, category, 0, &Hook::restore };
+}
+
+// wraps glad_<NAME>, the pointer behind the gl<NAME> macro
+#define CSCI441_INTERNAL_TRACE_GL(NAME, CATEGORY) _wrap<&glad_##NAME>(#NAME, CATEGORY)
+
+#endif // CSCI441_USE_GLEW
+
+inline void CSCI441::GLCallTracer::install() {
+#ifdef CSCI441_USE_GLEW
+    fprintf(stderr, "[WARN]: GL call tracing requires the glad loader\n");
+#else
+    if( _installed ) return;
+
+    // every function this project calls, including the one time shader introspection; anything
+    // else still goes straight to the driver
+    CSCI441_INTERNAL_TRACE_GL(glDrawArrays, DRAW);
+    CSCI441_INTERNAL_TRACE_GL(glDrawArraysInstanced, DRAW);
+    CSCI441_INTERNAL_TRACE_GL(glDrawElements, DRAW);
+    CSCI441_INTERNAL_TRACE_GL(glDrawElementsInstanced, DRAW);
+    CSCI441_INTERNAL_TRACE_GL(glDrawElementsInstancedBaseVertex, DRAW);
+
+    CSCI441_INTERNAL_TRACE_GL(glUniform3fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glUniformMatrix4fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glUniformBlockBinding, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform1f, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform2f, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform3f, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform4f, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform1i, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform2i, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform3i, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform4i, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform1ui, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform2ui, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform3ui, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform4ui, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform1fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform2fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform3fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform4fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform1iv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform2iv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform3iv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform4iv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform1uiv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform2uiv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform3uiv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniform4uiv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix2fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix3fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix4fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix2x3fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix3x2fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix2x4fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix4x2fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix3x4fv, UNIFORM);
+    CSCI441_INTERNAL_TRACE_GL(glProgramUniformMatrix4x3fv, UNIFORM);
+
+    CSCI441_INTERNAL_TRACE_GL(glBufferData, BUFFER);
+    CSCI441_INTERNAL_TRACE_GL(glBufferSubData, BUFFER);
+
+    CSCI441_INTERNAL_TRACE_GL(glTexImage2D, TEXTURE);
+    CSCI441_INTERNAL_TRACE_GL(glTexParameteri, TEXTURE);
+    CSCI441_INTERNAL_TRACE_GL(glTexParameterf, TEXTURE);
+    CSCI441_INTERNAL_TRACE_GL(glGenerateMipmap, TEXTURE);
+    CSCI441_INTERNAL_TRACE_GL(glPixelStorei, TEXTURE);
+
+    CSCI441_INTERNAL_TRACE_GL(glUseProgram, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glBindVertexArray, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glBindBuffer, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glBindBufferBase, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glBindTexture, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glActiveTexture, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glEnableVertexAttribArray, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glDisableVertexAttribArray, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glVertexAttribPointer, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glVertexAttribDivisor, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glEnable, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glDisable, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glPolygonMode, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glDepthFunc, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glDepthRange, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glDepthRangeIndexed, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glBlendFunc, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glViewport, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glViewportIndexedf, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glLineWidth, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glPointSize, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glClearColor, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glBeginQuery, STATE);
+    CSCI441_INTERNAL_TRACE_GL(glEndQuery, STATE);
+
+    CSCI441_INTERNAL_TRACE_GL(glClear, FRAMEBUFFER);
+    CSCI441_INTERNAL_TRACE_GL(glBlitFramebuffer, FRAMEBUFFER);
+    CSCI441_INTERNAL_TRACE_GL(glBindFramebuffer, FRAMEBUFFER);
+    CSCI441_INTERNAL_TRACE_GL(glBindRenderbuffer, FRAMEBUFFER);
+    CSCI441_INTERNAL_TRACE_GL(glDrawBuffer, FRAMEBUFFER);
+
+    CSCI441_INTERNAL_TRACE_GL(glGetIntegerv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetFloatv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetString, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetStringi, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetUniformLocation, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetAttribLocation, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetShaderiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetQueryObjectiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetQueryObjectui64v, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glCheckFramebufferStatus, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glIsProgram, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glIsShader, QUERY);
+    // introspection used by ShaderProgram and ShaderUtils after linking and when printing program info
+    CSCI441_INTERNAL_TRACE_GL(glGetShaderInfoLog, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramInfoLog, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramBinary, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetAttachedShaders, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetUniformiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveUniform, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveUniformsiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetUniformIndices, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetUniformBlockIndex, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveUniformBlockiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveUniformBlockName, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveAttrib, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveAtomicCounterBufferiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramInterfaceiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramResourceIndex, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramResourceName, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramResourceiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramStageiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetSubroutineIndex, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetSubroutineUniformLocation, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveSubroutineName, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveSubroutineUniformName, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetActiveSubroutineUniformiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramPipelineiv, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glGetProgramPipelineInfoLog, QUERY);
+    CSCI441_INTERNAL_TRACE_GL(glIsProgramPipeline, QUERY);
+
+    CSCI441_INTERNAL_TRACE_GL(glGenBuffers, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDeleteBuffers, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glGenVertexArrays, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDeleteVertexArrays, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glGenTextures, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDeleteTextures, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glGenFramebuffers, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDeleteFramebuffers, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glFramebufferTexture2D, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glFramebufferRenderbuffer, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glGenRenderbuffers, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDeleteRenderbuffers, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glRenderbufferStorage, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glGenQueries, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDeleteQueries, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glCreateShader, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glShaderSource, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glCompileShader, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDeleteShader, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glCreateProgram, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glAttachShader, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDetachShader, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glLinkProgram, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glDeleteProgram, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glProgramBinary, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glProgramParameteri, OBJECT);
+    CSCI441_INTERNAL_TRACE_GL(glMaxShaderCompilerThreadsKHR, OBJECT);
+
+    _installed = true;
+#endif
+}
+
+inline void CSCI441::GLCallTracer::uninstall() {
+    for( GLuint i = 0; i < _numFunctions; i++ ) {
+        _functions[i].restore();
+    }
+    _numFunctions = 0;
+    _installed = false;
+}
+
+inline bool CSCI441::GLCallTracer::startLogging(const char* FILENAME) {
+    stopLogging();
+    _log = fopen(FILENAME, "w");
+    if( _log == nullptr ) {
+        fprintf(stderr, "[ERROR]: Could not open GL call log %s for writing\n", FILENAME);
+        return false;
+    }
+    return true;
+}
+
+inline void CSCI441::GLCallTracer::stopLogging() {
+    if( _log != nullptr ) {
+        fclose(_log);
+        _log = nullptr;
+    }
+}
+
+inline void CSCI441::GLCallTracer::_record(const GLuint FUNCTION) noexcept {
+    Function& function = _functions[FUNCTION];
+    function.calls++;
+    _currentFrame.calls[function.category]++;
+    if( _log != nullptr ) {
+        fputs(function.name, _log);
+        fputc('\n', _log);
+    }
+}
+
+inline const CSCI441::GLCallTracer::Counts& CSCI441::GLCallTracer::endFrame() {
+    _lastFrame = _currentFrame;
+    _currentFrame = Counts{};
+    for( int i = 0; i < NUM_CATEGORIES; i++ ) {
+        _completedFrames.calls[i] += _lastFrame.calls[i];
+        _maxPerFrame.calls[i] = std::max(_maxPerFrame.calls[i], _lastFrame.calls[i]);
+    }
+    _numFrames++;
+
+    if( _log != nullptr ) {
+        fprintf(_log, "-- end of frame %llu: %llu calls\n", static_cast<unsigned long long>(_numFrames), static_cast<unsigned long long>(_lastFrame.total()));
+    }
+    return _lastFrame;
+}
+
+inline CSCI441::GLCallTracer::Counts CSCI441::GLCallTracer::getTotals() noexcept {
+    Counts totals = _completedFrames;
+    for( int i = 0; i < NUM_CATEGORIES; i++ ) {
+        totals.calls[i] += _currentFrame.calls[i];
+    }
+    return totals;
+}
+
+inline const char* CSCI441::GLCallTracer::getCategoryName(const Category category) noexcept {
+    switch( category ) {
+        case DRAW:          return "draw";
+        case UNIFORM:       return "uniform";
+        case BUFFER:        return "buffer";
+        case TEXTURE:       return "texture";
+        case STATE:         return "state";
+        case FRAMEBUFFER:   return "framebuffer";
+        case QUERY:         return "query";
+        case OBJECT:        return "object";
+        default:            return "unknown";
+    }
+}
+
+inline void CSCI441::GLCallTracer::printReport() {
+    if( !_installed ) return;
+
+    const double frames = static_cast<double>(std::max<GLuint64>(_numFrames, 1));
+    fprintf(stdout, "[INFO]: GL calls over %llu frames: %.1f per frame on average\n",
+            static_cast<unsigned long long>(_numFrames), static_cast<double>(_completedFrames.total()) / frames);
+    for( int i = 0; i < NUM_CATEGORIES; i++ ) {
+        fprintf(stdout, "[INFO]:   %-12s %10.1f per frame, at most %llu\n", getCategoryName(static_cast<Category>(i)),
+                static_cast<double>(_completedFrames.calls[i]) / frames, static_cast<unsigned long long>(_maxPerFrame.calls[i]));
+    }
+
+    // the functions called most often since install()
+    GLuint order[MAX_FUNCTIONS];
+    for( GLuint i = 0; i < _numFunctions; i++ ) {
+        order[i] = i;
+    }
+    const GLuint numListed = std::min<GLuint>(_numFunctions, 8);
+    std::partial_sort(order, order + numListed, order + _numFunctions,
+                      [](const GLuint a, const GLuint b) { return _functions[a].calls > _functions[b].calls; });
+    for( GLuint i = 0; i < numListed && _functions[order[i]].calls > 0; i++ ) {
+        const Function& function = _functions[order[i]];
+        fprintf(stdout, "[INFO]:   %-32s %12llu calls (%s)\n", function.name, static_cast<unsigned long long>(function.calls), getCategoryName(function.category));
+    }
+}
+
+#endif //CSCI441_GL_CALL_TRACER_HPP
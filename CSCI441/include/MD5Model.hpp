@@ -65,6 +65,7 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <vector>
 
 namespace CSCI441 {
 
@@ -399,6 +400,36 @@ namespace CSCI441 {
          */
         void animate(GLfloat dt);
 
+        // baking prototypes
+        /**
+         * @brief returns the total number of vertices across all meshes of the model
+         * @returns sum of the vertex counts of every mesh
+         */
+        [[nodiscard]] GLint getNumVertices() const;
+        /**
+         * @brief returns the length of one loop of the animation sequence
+         * @returns duration in seconds, 0 if model is not animated
+         */
+        [[nodiscard]] GLfloat getAnimationDuration() const;
+        /**
+         * @brief samples the animation at a fixed rate and skins every mesh vertex on the CPU
+         * @param SAMPLE_RATE number of samples to take per second of animation
+         * @param positions populated with the skinned vertex positions, NUM_SAMPLES * getNumVertices() entries stored sample-major
+         * @param normals populated with the matching smooth vertex normals
+         * @returns number of samples taken, 0 if the model is not animated
+         * @note meshes are concatenated in file order, matching the layout returned by getMeshTopology()
+         * @note the sample following the last one is the first one, so baked clips loop seamlessly
+         */
+        [[maybe_unused]] GLint bakeAnimation(GLfloat SAMPLE_RATE, std::vector<glm::vec3>& positions, std::vector<glm::vec3>& normals) const;
+        /**
+         * @brief returns the texture coordinates and triangle indices of every mesh concatenated into single arrays
+         * @param texCoords populated with getNumVertices() texture coordinates
+         * @param indices populated with triangle indices into the concatenated vertex array
+         * @param meshIndexOffsets populated with the first index of each mesh followed by the total index count
+         * @param diffuseTextures populated with the diffuse texture handle of each mesh
+         */
+        [[maybe_unused]] void getMeshTopology(std::vector<glm::vec2>& texCoords, std::vector<GLuint>& indices, std::vector<GLint>& meshIndexOffsets, std::vector<GLuint>& diffuseTextures) const;
+
     private:
         MD5Joint* _baseSkeleton;
         MD5Mesh* _meshes;
@@ -446,6 +477,12 @@ namespace CSCI441 {
                                         MD5Joint* pSkeletonFrame,
                                         GLint NUM_JOINTS);
         void _interpolateSkeletons(GLfloat interp);
+        static void _interpolateSkeletons(const MD5Joint* pSKELETON_A,
+                                          const MD5Joint* pSKELETON_B,
+                                          GLint NUM_JOINTS,
+                                          GLfloat interp,
+                                          MD5Joint* pSkeletonOut);
+        static void _skinMesh(const MD5Mesh* pMESH, const MD5Joint* pSKELETON, glm::vec3* pVertices);
         void _freeModel();
         void _freeVertexArrays();
         void _freeAnim();
@@ -742,22 +779,22 @@ CSCI441::MD5Model::readMD5Model(
 inline void
 CSCI441::MD5Model::_freeModel()
 {
-    delete _baseSkeleton;
+    delete[] _baseSkeleton;
     _baseSkeleton = nullptr;
 
     // Free mesh data
     for(GLint i = 0; i < _numMeshes; ++i) {
-        delete _meshes[i].vertices;
+        delete[] _meshes[i].vertices;
         _meshes[i].vertices = nullptr;
 
-        delete _meshes[i].triangles;
+        delete[] _meshes[i].triangles;
         _meshes[i].triangles = nullptr;
 
-        delete _meshes[i].weights;
+        delete[] _meshes[i].weights;
         _meshes[i].weights = nullptr;
     }
 
-    delete _meshes;
+    delete[] _meshes;
     _meshes = nullptr;
 }
 
@@ -788,28 +825,9 @@ CSCI441::MD5Model::_prepareMesh(
     }
 
     // Setup vertices
-    for(i = 0; i < pMESH->numVertices; ++i) {
-        glm::vec3 finalVertex = {0.0f, 0.0f, 0.0f };
-
-        // Calculate final vertex to draw with weights
-        for(j = 0; j < pMESH->vertices[i].count; ++j) {
-            const MD5Weight *weight = &pMESH->weights[pMESH->vertices[i].start + j];
-            const MD5Joint  *joint  = &_skeleton[weight->joint];
-
-            // Calculate transformed vertex for this weight
-            glm::vec3 weightedVertex;
-            weightedVertex = glm::rotate(joint->orientation, glm::vec4(weight->position, 0.0f));
-
-            // The sum of all weight->bias should be 1.0
-            finalVertex.x += (joint->position.x + weightedVertex.x) * weight->bias;
-            finalVertex.y += (joint->position.y + weightedVertex.y) * weight->bias;
-            finalVertex.z += (joint->position.z + weightedVertex.z) * weight->bias;
-        }
-
-        _vertexArray[i].x = finalVertex.x;
-        _vertexArray[i].y = finalVertex.y;
-        _vertexArray[i].z = finalVertex.z;
+    _skinMesh(pMESH, _skeleton, _vertexArray);
 
+    for(i = 0; i < pMESH->numVertices; ++i) {
         _texelArray[i].s = pMESH->vertices[i].texCoord.s;
         _texelArray[i].t = pMESH->vertices[i].texCoord.t;
     }
@@ -1162,13 +1180,13 @@ CSCI441::MD5Model::readMD5Anim(
 
     // Free temporary data allocated
     if( animFrameData )
-        free( animFrameData );
+        delete[] animFrameData;
 
     if( baseFrame )
-        free( baseFrame );
+        delete[] baseFrame;
 
     if( jointInfos )
-        free( jointInfos );
+        delete[] jointInfos;
 
     // successful loading...set up animation parameters
     _animationInfo.currFrame = 0;
@@ -1196,17 +1214,17 @@ CSCI441::MD5Model::_freeAnim()
     GLint i;
 
     for(i = 0; i < _animation.numFrames; ++i) {
-        delete _animation.skeletonFrames[i];
+        delete[] _animation.skeletonFrames[i];
         _animation.skeletonFrames[i] = nullptr;
     }
 
     delete[] _animation.skeletonFrames;
     _animation.skeletonFrames = nullptr;
 
-    delete _animation.boundingBoxes;
+    delete[] _animation.boundingBoxes;
     _animation.boundingBoxes = nullptr;
 
-    delete _skeleton;
+    delete[] _skeleton;
     _skeleton = nullptr;
 }
 
@@ -1214,22 +1232,65 @@ CSCI441::MD5Model::_freeAnim()
 inline void
 CSCI441::MD5Model::_interpolateSkeletons(GLfloat interp)
 {
-    const MD5Joint *skeletonA = _animation.skeletonFrames[_animationInfo.currFrame];
-    const MD5Joint *skeletonB = _animation.skeletonFrames[_animationInfo.nextFrame];
+    _interpolateSkeletons(_animation.skeletonFrames[_animationInfo.currFrame],
+                          _animation.skeletonFrames[_animationInfo.nextFrame],
+                          _animation.numJoints,
+                          interp,
+                          _skeleton);
+}
 
+inline void
+CSCI441::MD5Model::_interpolateSkeletons(
+        const MD5Joint* pSKELETON_A,
+        const MD5Joint* pSKELETON_B,
+        const GLint NUM_JOINTS,
+        const GLfloat interp,
+        MD5Joint* pSkeletonOut
+) {
     GLint i;
 
-    for(i = 0; i < _animation.numJoints; ++i) {
+    for(i = 0; i < NUM_JOINTS; ++i) {
         // Copy parent index
-        _skeleton[i].parent = skeletonA[i].parent;
+        pSkeletonOut[i].parent = pSKELETON_A[i].parent;
 
         // Linear interpolation for position
-        _skeleton[i].position[0] = skeletonA[i].position[0] + interp * (skeletonB[i].position[0] - skeletonA[i].position[0]);
-        _skeleton[i].position[1] = skeletonA[i].position[1] + interp * (skeletonB[i].position[1] - skeletonA[i].position[1]);
-        _skeleton[i].position[2] = skeletonA[i].position[2] + interp * (skeletonB[i].position[2] - skeletonA[i].position[2]);
+        pSkeletonOut[i].position[0] = pSKELETON_A[i].position[0] + interp * (pSKELETON_B[i].position[0] - pSKELETON_A[i].position[0]);
+        pSkeletonOut[i].position[1] = pSKELETON_A[i].position[1] + interp * (pSKELETON_B[i].position[1] - pSKELETON_A[i].position[1]);
+        pSkeletonOut[i].position[2] = pSKELETON_A[i].position[2] + interp * (pSKELETON_B[i].position[2] - pSKELETON_A[i].position[2]);
 
         // Spherical linear interpolation for orientation
-        _skeleton[i].orientation = glm::slerp(skeletonA[i].orientation, skeletonB[i].orientation, interp);
+        pSkeletonOut[i].orientation = glm::slerp(pSKELETON_A[i].orientation, pSKELETON_B[i].orientation, interp);
+    }
+}
+
+// Compute a mesh's final vertex positions given a skeleton.
+inline void
+CSCI441::MD5Model::_skinMesh(
+        const MD5Mesh* pMESH,
+        const MD5Joint* pSKELETON,
+        glm::vec3* pVertices
+) {
+    GLint i, j;
+
+    for(i = 0; i < pMESH->numVertices; ++i) {
+        glm::vec3 finalVertex = {0.0f, 0.0f, 0.0f };
+
+        // Calculate final vertex to draw with weights
+        for(j = 0; j < pMESH->vertices[i].count; ++j) {
+            const MD5Weight *weight = &pMESH->weights[pMESH->vertices[i].start + j];
+            const MD5Joint  *joint  = &pSKELETON[weight->joint];
+
+            // Calculate transformed vertex for this weight
+            glm::vec3 weightedVertex;
+            weightedVertex = glm::rotate(joint->orientation, glm::vec4(weight->position, 0.0f));
+
+            // The sum of all weight->bias should be 1.0
+            finalVertex.x += (joint->position.x + weightedVertex.x) * weight->bias;
+            finalVertex.y += (joint->position.y + weightedVertex.y) * weight->bias;
+            finalVertex.z += (joint->position.z + weightedVertex.z) * weight->bias;
+        }
+
+        pVertices[i] = finalVertex;
     }
 }
 
@@ -1259,4 +1320,127 @@ CSCI441::MD5Model::animate(GLfloat dt)
     _interpolateSkeletons( _animationInfo.lastTime * _animation.frameRate );
 }
 
+inline GLint
+CSCI441::MD5Model::getNumVertices() const
+{
+    GLint numVertices = 0;
+    for(GLint i = 0; i < _numMeshes; ++i) {
+        numVertices += _meshes[i].numVertices;
+    }
+    return numVertices;
+}
+
+inline GLfloat
+CSCI441::MD5Model::getAnimationDuration() const
+{
+    if( !_isAnimated || _animation.frameRate <= 0 ) return 0.0f;
+    return (GLfloat)_animation.numFrames / (GLfloat)_animation.frameRate;
+}
+
+// Sample the animation at a fixed rate and skin every vertex of every
+// mesh for each sample.  Used to bake vertex animation textures.
+[[maybe_unused]]
+inline GLint
+CSCI441::MD5Model::bakeAnimation(
+        const GLfloat SAMPLE_RATE,
+        std::vector<glm::vec3>& positions,
+        std::vector<glm::vec3>& normals
+) const {
+    positions.clear();
+    normals.clear();
+
+    if( !_isAnimated || _animation.numFrames < 1 || _animation.frameRate < 1 || SAMPLE_RATE <= 0.0f ) {
+        fprintf(stderr, "[.md5anim]: Error: model has no animation to bake\n");
+        return 0;
+    }
+
+    const GLint NUM_VERTICES = getNumVertices();
+    GLint numSamples = (GLint)lroundf(getAnimationDuration() * SAMPLE_RATE);
+    if( numSamples < 1 ) numSamples = 1;
+
+    positions.resize( (size_t)numSamples * NUM_VERTICES );
+    normals.resize( (size_t)numSamples * NUM_VERTICES, glm::vec3(0.0f, 0.0f, 0.0f) );
+
+    auto sampleSkeleton = new MD5Joint[_animation.numJoints];
+
+    for(GLint sample = 0; sample < numSamples; ++sample) {
+        // position within the looping animation measured in frames
+        GLfloat framePosition = (GLfloat)sample / SAMPLE_RATE * (GLfloat)_animation.frameRate;
+        GLint currFrame = (GLint)framePosition % _animation.numFrames;
+        GLint nextFrame = (currFrame + 1) % _animation.numFrames;
+
+        _interpolateSkeletons(_animation.skeletonFrames[currFrame],
+                              _animation.skeletonFrames[nextFrame],
+                              _animation.numJoints,
+                              framePosition - floorf(framePosition),
+                              sampleSkeleton);
+
+        glm::vec3 *pSamplePositions = &positions[(size_t)sample * NUM_VERTICES];
+        glm::vec3 *pSampleNormals = &normals[(size_t)sample * NUM_VERTICES];
+
+        GLint meshStart = 0;
+        for(GLint i = 0; i < _numMeshes; ++i) {
+            const MD5Mesh *pMesh = &_meshes[i];
+            _skinMesh(pMesh, sampleSkeleton, pSamplePositions + meshStart);
+
+            // accumulate area weighted face normals, MD5 triangles are wound clockwise
+            for(GLint t = 0; t < pMesh->numTriangles; ++t) {
+                const GLint *index = pMesh->triangles[t].index;
+                const glm::vec3 v0 = pSamplePositions[meshStart + index[0]];
+                const glm::vec3 v1 = pSamplePositions[meshStart + index[1]];
+                const glm::vec3 v2 = pSamplePositions[meshStart + index[2]];
+                const glm::vec3 faceNormal = glm::cross(v2 - v0, v1 - v0);
+                for(GLint k = 0; k < 3; ++k) {
+                    pSampleNormals[meshStart + index[k]] += faceNormal;
+                }
+            }
+
+            meshStart += pMesh->numVertices;
+        }
+
+        for(GLint v = 0; v < NUM_VERTICES; ++v) {
+            GLfloat length = glm::length(pSampleNormals[v]);
+            if( length > 0.0f ) pSampleNormals[v] /= length;
+        }
+    }
+
+    delete[] sampleSkeleton;
+
+    return numSamples;
+}
+
+[[maybe_unused]]
+inline void
+CSCI441::MD5Model::getMeshTopology(
+        std::vector<glm::vec2>& texCoords,
+        std::vector<GLuint>& indices,
+        std::vector<GLint>& meshIndexOffsets,
+        std::vector<GLuint>& diffuseTextures
+) const {
+    texCoords.clear();
+    indices.clear();
+    meshIndexOffsets.clear();
+    diffuseTextures.clear();
+
+    GLuint meshStart = 0;
+    for(GLint i = 0; i < _numMeshes; ++i) {
+        const MD5Mesh *pMesh = &_meshes[i];
+
+        meshIndexOffsets.push_back( (GLint)indices.size() );
+        diffuseTextures.push_back( pMesh->textures[MD5Mesh::TextureMap::DIFFUSE].texHandle );
+
+        for(GLint v = 0; v < pMesh->numVertices; ++v) {
+            texCoords.push_back( pMesh->vertices[v].texCoord );
+        }
+        for(GLint t = 0; t < pMesh->numTriangles; ++t) {
+            for(GLint k = 0; k < 3; ++k) {
+                indices.push_back( meshStart + (GLuint)pMesh->triangles[t].index[k] );
+            }
+        }
+
+        meshStart += (GLuint)pMesh->numVertices;
+    }
+    meshIndexOffsets.push_back( (GLint)indices.size() );
+}
+
 #endif//CSCI441_MD5_MODEL_HPP
@@ -97,11 +97,12 @@ namespace CSCI441 {
          * @param matShinLocation uniform location of material shininess component
          * @param matAmbLocation uniform location of material ambient component
          * @param diffuseTexture texture number to bind diffuse texture map to
+         * @param instanceCount number of instances to draw, the shader distinguishes them through gl_InstanceID
          * @return true if draw succeeded, false otherwise
          */
         [[maybe_unused]] bool draw( GLuint shaderProgramHandle,
                    GLint matDiffLocation = -1, GLint matSpecLocation = -1, GLint matShinLocation = -1, GLint matAmbLocation = -1,
-                   GLenum diffuseTexture = GL_TEXTURE0 ) const;
+                   GLenum diffuseTexture = GL_TEXTURE0, GLsizei instanceCount = 1 ) const;
 
         /**
          * @brief Return the number of vertices the model is made up of.  This value corresponds to the size of the Vertices, TexCoords, and Normals arrays.
@@ -137,6 +138,12 @@ namespace CSCI441 {
 		 * @note For use with IBOs
 		 */
         [[maybe_unused]] [[nodiscard]] GLuint* getIndices() const;
+        /**
+         * @brief Return the vertex array object the model is drawn with.
+         * @return handle of the VAO
+         * @note Lets the caller attach extra attributes, such as per-instance data, before calling draw
+         */
+        [[maybe_unused]] [[nodiscard]] GLuint getVertexArrayHandle() const { return _vaod; }
 
 		/**
 		 * @brief Enable auto-generation of vertex normals
@@ -279,7 +286,7 @@ inline void CSCI441::ModelLoader::setAttributeLocations(GLint positionLocation,
 [[maybe_unused]]
 inline bool CSCI441::ModelLoader::draw( GLuint shaderProgramHandle,
                                         GLint matDiffLocation, GLint matSpecLocation, GLint matShinLocation, GLint matAmbLocation,
-                                        GLenum diffuseTexture ) const {
+                                        GLenum diffuseTexture, GLsizei instanceCount ) const {
     glBindVertexArray( _vaod );
 
     bool result = true;
@@ -311,11 +318,11 @@ inline bool CSCI441::ModelLoader::draw( GLuint shaderProgramHandle,
 					}
 				}
 
-				glDrawElements( GL_TRIANGLES, length, GL_UNSIGNED_INT, (void*)(sizeof(GLuint)*start) );
+				glDrawElementsInstanced( GL_TRIANGLES, length, GL_UNSIGNED_INT, (void*)(sizeof(GLuint)*start), instanceCount );
 			}
 		}
 	} else {
-		glDrawElements( GL_TRIANGLES, static_cast<GLint>(_numIndices), GL_UNSIGNED_INT, (void*)nullptr );
+		glDrawElementsInstanced( GL_TRIANGLES, static_cast<GLint>(_numIndices), GL_UNSIGNED_INT, (void*)nullptr, instanceCount );
 	}
 
 	return result;
@@ -12,6 +12,7 @@
 #ifndef CSCI441_OPENGL_ENGINE_HPP
 #define CSCI441_OPENGL_ENGINE_HPP
 
+#include "GLCallTracer.hpp"
 #include "OpenGLUtils.hpp"
 
 #ifdef CSCI441_USE_GLEW
@@ -83,6 +84,17 @@ namespace CSCI441 {
          */
         [[maybe_unused]] [[nodiscard]] virtual bool isDebuggingEnabled() const noexcept final { return DEBUG; }
 
+        /**
+         * @brief Count every OpenGL call by category and frame with GLCallTracer
+         * @param LOG_FILENAME if not null, also write the name of every call to this file
+         * @note must be called before initialize(); the wrappers are installed once the function
+         * pointers have been loaded and removed at shutdown, after printing a report
+         */
+        [[maybe_unused]] virtual void enableGLCallTracing(const char* LOG_FILENAME = nullptr) final {
+            _traceGLCalls = true;
+            _glCallLogFilename = LOG_FILENAME != nullptr ? LOG_FILENAME : "";
+        }
+
         /**
          * @brief Returns if OpenGL extension exists
          * @param EXT name of extension
@@ -331,12 +343,15 @@ namespace CSCI441 {
 
     private:
         void _setupGLFunctions();           // initialize OpenGL functions
-        void _cleanupGLFunctions() {}       // nothing to be done at this time
+        void _cleanupGLFunctions();         // remove the GL call tracer if installed
 
         bool _isInitialized;                // makes initialization a singleton process
         bool _isCleanedUp;                  // makes cleanup a singleton process
 
         std::set< std::string > _extensions;// set of all available OpenGL extensions
+
+        bool _traceGLCalls = false;         // wrap the function pointers with GLCallTracer
+        std::string _glCallLogFilename;     // where GLCallTracer logs every call, empty for none
     };
 }
 
@@ -452,6 +467,21 @@ inline void CSCI441::OpenGLEngine::_setupGLFunctions() {
         for (int i = 0; i < numExtensions; i++) {
             _extensions.insert((const char*)glGetStringi(GL_EXTENSIONS, i) );
         }
+
+        if(_traceGLCalls) {
+            CSCI441::GLCallTracer::install();
+            if(!_glCallLogFilename.empty()) {
+                CSCI441::GLCallTracer::startLogging(_glCallLogFilename.c_str());
+            }
+        }
+    }
+}
+
+inline void CSCI441::OpenGLEngine::_cleanupGLFunctions() {
+    if(CSCI441::GLCallTracer::isInstalled()) {
+        if(DEBUG) CSCI441::GLCallTracer::printReport();
+        CSCI441::GLCallTracer::stopLogging();
+        CSCI441::GLCallTracer::uninstall();
     }
 }
 
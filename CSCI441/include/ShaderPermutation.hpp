@@ -0,0 +1,141 @@
+/**
+ * @file ShaderPermutation.hpp
+ * @brief Compiles preprocessor variants of a Shader Program on demand and caches them by their defines
+ *
+ * @copyright MIT License
+ *
+ *	These functions, classes, and constants help minimize common
+ *	code that needs to be written.
+ */
+
+#ifndef CSCI441_SHADER_PERMUTATION_HPP
+#define CSCI441_SHADER_PERMUTATION_HPP
+
+#include "ShaderProgram.hpp"
+#include "ShaderUtils.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+
+namespace CSCI441 {
+
+    /**
+     * @brief Owns every compiled variant of a single set of shader sources
+     * @note Each variant is identified by its ShaderDefines.  The first request for a set of
+     * defines starts an asynchronous build of that variant, later requests return the same
+     * program.  Defines are sorted before hashing so the order they are listed in does not
+     * create duplicate variants.
+     */
+    class ShaderPermutationCache final {
+    public:
+        /**
+         * @brief creates a permutation cache for a Vertex Shader and Fragment Shader
+         * @param vertexShaderFilename name of the file corresponding to the vertex shader
+         * @param fragmentShaderFilename name of the file corresponding to the fragment shader
+         */
+        ShaderPermutationCache( const char *vertexShaderFilename,
+                                const char *fragmentShaderFilename );
+        /**
+         * @brief creates a permutation cache for a full graphics pipeline
+         * @param vertexShaderFilename name of the file corresponding to the vertex shader
+         * @param tessellationControlShaderFilename name of the file corresponding to the tessellation control shader
+         * @param tessellationEvaluationShaderFilename name of the file corresponding to the tessellation evaluation shader
+         * @param geometryShaderFilename name of the file corresponding to the geometry shader
+         * @param fragmentShaderFilename name of the file corresponding to the fragment shader
+         */
+        ShaderPermutationCache( const char *vertexShaderFilename,
+                                const char *tessellationControlShaderFilename,
+                                const char *tessellationEvaluationShaderFilename,
+                                const char *geometryShaderFilename,
+                                const char *fragmentShaderFilename );
+        /**
+         * @brief deletes every variant that was compiled
+         */
+        ~ShaderPermutationCache();
+
+        /**
+         * @brief do not allow permutation caches to be copied
+         */
+        ShaderPermutationCache(const ShaderPermutationCache&) = delete;
+        /**
+         * @brief do not allow permutation caches to be copied
+         */
+        ShaderPermutationCache& operator=(const ShaderPermutationCache&) = delete;
+
+        /**
+         * @brief returns the variant compiled with the given defines, starting its build on first use
+         * @param DEFINES preprocessor definitions identifying the variant
+         * @return shader program owned by the cache
+         * @note the returned program may still be compiling, any query or use of it completes the build
+         */
+        [[nodiscard]] ShaderProgram* getVariant(const ShaderDefines& DEFINES);
+
+        /**
+         * @brief returns the number of variants requested so far
+         * @return number of compiled or compiling variants
+         */
+        [[nodiscard]] size_t getNumVariants() const noexcept { return _variants.size(); }
+
+        /**
+         * @brief computes the key a set of defines is cached under
+         * @param DEFINES preprocessor definitions identifying the variant
+         * @return order independent hash of the defines
+         */
+        [[nodiscard]] static uint64_t computeKey(const ShaderDefines& DEFINES);
+
+    private:
+        std::string _shaderFilenames[5];
+        std::unordered_map<uint64_t, ShaderProgram*> _variants;
+    };
+}
+
+//**********************************************************************************
+
+inline CSCI441::ShaderPermutationCache::ShaderPermutationCache( const char *vertexShaderFilename, const char *fragmentShaderFilename )
+    : ShaderPermutationCache(vertexShaderFilename, "", "", "", fragmentShaderFilename) {
+
+}
+
+inline CSCI441::ShaderPermutationCache::ShaderPermutationCache( const char *vertexShaderFilename, const char *tessellationControlShaderFilename, const char *tessellationEvaluationShaderFilename, const char *geometryShaderFilename, const char *fragmentShaderFilename )
+    : _shaderFilenames{ vertexShaderFilename, tessellationControlShaderFilename, tessellationEvaluationShaderFilename, geometryShaderFilename, fragmentShaderFilename } {
+
+}
+
+inline CSCI441::ShaderPermutationCache::~ShaderPermutationCache() {
+    for( auto& [key, pVariant] : _variants ) {
+        delete pVariant;
+    }
+}
+
+inline CSCI441::ShaderProgram* CSCI441::ShaderPermutationCache::getVariant(const ShaderDefines& DEFINES) {
+    const uint64_t key = computeKey(DEFINES);
+    auto variantIter = _variants.find(key);
+    if( variantIter != _variants.end() ) {
+        return variantIter->second;
+    }
+
+    ShaderProgram* pVariant = ShaderProgram::createAsync( _shaderFilenames[0].c_str(), _shaderFilenames[1].c_str(),
+                                                          _shaderFilenames[2].c_str(), _shaderFilenames[3].c_str(),
+                                                          _shaderFilenames[4].c_str(), false, DEFINES );
+    _variants.emplace(key, pVariant);
+    return pVariant;
+}
+
+inline uint64_t CSCI441::ShaderPermutationCache::computeKey(const ShaderDefines& DEFINES) {
+    ShaderDefines sortedDefines = DEFINES;
+    std::sort(sortedDefines.begin(), sortedDefines.end());
+
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for( const auto& [name, value] : sortedDefines ) {
+        hash = CSCI441_INTERNAL::ShaderUtils::hashFNV1a(name.data(), name.length(), hash);
+        hash = CSCI441_INTERNAL::ShaderUtils::hashFNV1a("=", 1, hash);
+        hash = CSCI441_INTERNAL::ShaderUtils::hashFNV1a(value.data(), value.length(), hash);
+        hash = CSCI441_INTERNAL::ShaderUtils::hashFNV1a(";", 1, hash);
+    }
+    return hash;
+}
+
+#endif // CSCI441_SHADER_PERMUTATION_HPP
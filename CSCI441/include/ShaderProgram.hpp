@@ -17,16 +17,80 @@
 
 #include <glm/glm.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
 #include <cstdlib>
+#include <filesystem>
 #include <fstream>
 #include <map>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace CSCI441 {
 
+    /**
+     * @brief Preprocessor definitions injected into every stage of a Shader Program as (name, value) pairs
+     * @note each pair becomes "#define name value" placed directly after the #version directive
+     */
+    using ShaderDefines = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * @brief Name of a uniform along with its hash, computed at compile time for string literals
+     * @note used to resolve a UniformHandle without comparing strings
+     */
+    struct UniformName {
+        /**
+         * @brief name of the uniform as it appears in the shader
+         */
+        const char* name;
+        /**
+         * @brief FNV-1a hash of the name
+         */
+        uint64_t hash;
+
+        /**
+         * @brief hashes the uniform name
+         * @param NAME name of the uniform as it appears in the shader
+         */
+        constexpr UniformName(const char* NAME) : name(NAME), hash(CSCI441_INTERNAL::ShaderUtils::hashStringFNV1a(NAME)) {}
+    };
+
+    /**
+     * @brief Location of a uniform resolved once at setup, typed by the value it holds
+     * @tparam T type of the uniform value (e.g. GLfloat, glm::vec3, glm::mat4)
+     * @note obtain from ShaderProgram::getUniformHandle() and pass to ShaderProgram::setProgramUniform()
+     * in hot paths to skip the name lookup that the const char* overloads perform on every call
+     */
+    template<typename T>
+    class UniformHandle {
+    public:
+        /**
+         * @brief creates an unresolved handle, setting it does nothing
+         */
+        constexpr UniformHandle() : _location(-1) {}
+
+        /**
+         * @brief location of the uniform within its shader program
+         * @return -1 if the uniform was not found
+         */
+        [[nodiscard]] constexpr GLint getLocation() const { return _location; }
+        /**
+         * @brief returns if the uniform was found in the shader program
+         */
+        [[nodiscard]] constexpr bool isValid() const { return _location != -1; }
+
+    private:
+        friend class ShaderProgram;
+        constexpr explicit UniformHandle(const GLint LOCATION) : _location(LOCATION) {}
+        GLint _location;
+    };
+
     /**
      * @class ShaderProgram
      * @brief Handles registration and compilation of Shaders
@@ -44,6 +108,70 @@ namespace CSCI441 {
          */
         [[maybe_unused]] static void disableDebugMessages();
 
+        /**
+         * @brief Enables the on-disk program binary cache for all subsequently created Shader Programs
+         * @param CACHE_DIRECTORY directory to read and write program binaries to, created if it does not exist
+         * @note Programs are keyed by a hash of their GLSL sources, separability, and the GL vendor, renderer,
+         * and version strings.  A missing, stale, or rejected binary falls back to compiling from source.
+         */
+        [[maybe_unused]] static void enableBinaryCache(const char* CACHE_DIRECTORY);
+        /**
+         * @brief Disables the on-disk program binary cache
+         * @note The cache is off by default.
+         */
+        [[maybe_unused]] static void disableBinaryCache();
+        /**
+         * @brief Prints how each Shader Program created so far was built (compiled or loaded from the binary cache)
+         * along with the time spent building it
+         */
+        [[maybe_unused]] static void printStartupReport();
+
+        /**
+         * @brief Starts building a Shader Program from a Vertex Shader and Fragment Shader without waiting for the driver
+         * @param vertexShaderFilename name of the file corresponding to the vertex shader
+         * @param fragmentShaderFilename name of the file corresponding to the fragment shader
+         * @param isSeparable if program is separable
+         * @return shader program whose compile and link may still be in progress
+         * @note The build is finished, blocking if necessary, the first time the program is used or queried.  Start all
+         * programs before loading other assets so the driver's compile work overlaps with the loading.
+         */
+        [[maybe_unused]] static ShaderProgram* createAsync( const char *vertexShaderFilename,
+                                                            const char *fragmentShaderFilename,
+                                                            bool isSeparable = false );
+        /**
+         * @brief Starts building a Shader Program from a Vertex Shader and Fragment Shader with preprocessor definitions
+         * @param vertexShaderFilename name of the file corresponding to the vertex shader
+         * @param fragmentShaderFilename name of the file corresponding to the fragment shader
+         * @param DEFINES definitions injected into each stage after its #version directive
+         * @return shader program whose compile and link may still be in progress
+         */
+        [[maybe_unused]] static ShaderProgram* createAsync( const char *vertexShaderFilename,
+                                                            const char *fragmentShaderFilename,
+                                                            const ShaderDefines& DEFINES );
+        /**
+         * @brief Starts building a Shader Program from any combination of stages without waiting for the driver
+         * @param vertexShaderFilename name of the file corresponding to the vertex shader, empty string if not present
+         * @param tessellationControlShaderFilename name of the file corresponding to the tessellation control shader, empty string if not present
+         * @param tessellationEvaluationShaderFilename name of the file corresponding to the tessellation evaluation shader, empty string if not present
+         * @param geometryShaderFilename name of the file corresponding to the geometry shader, empty string if not present
+         * @param fragmentShaderFilename name of the file corresponding to the fragment shader, empty string if not present
+         * @param isSeparable if program is separable
+         * @param DEFINES definitions injected into each stage after its #version directive
+         * @return shader program whose compile and link may still be in progress
+         */
+        [[maybe_unused]] static ShaderProgram* createAsync( const char *vertexShaderFilename,
+                                                            const char *tessellationControlShaderFilename,
+                                                            const char *tessellationEvaluationShaderFilename,
+                                                            const char *geometryShaderFilename,
+                                                            const char *fragmentShaderFilename,
+                                                            bool isSeparable = false,
+                                                            const ShaderDefines& DEFINES = ShaderDefines() );
+        /**
+         * @brief Asks the driver to use as many threads as it likes for shader compilation
+         * @note Requires GL_KHR_parallel_shader_compile or GL_ARB_parallel_shader_compile, does nothing otherwise
+         */
+        [[maybe_unused]] static void enableParallelShaderCompile();
+
         /**
          * @brief Creates a Shader Program using a Vertex Shader and Fragment Shader
          * @param vertexShaderFilename name of the file corresponding to the vertex shader
@@ -52,6 +180,16 @@ namespace CSCI441 {
         ShaderProgram( const char *vertexShaderFilename,
                        const char *fragmentShaderFilename );
 
+        /**
+         * @brief Creates a Shader Program using a Vertex Shader and Fragment Shader with preprocessor definitions
+         * @param vertexShaderFilename name of the file corresponding to the vertex shader
+         * @param fragmentShaderFilename name of the file corresponding to the fragment shader
+         * @param DEFINES definitions injected into each stage after its #version directive
+         */
+        ShaderProgram( const char *vertexShaderFilename,
+                       const char *fragmentShaderFilename,
+                       const ShaderDefines& DEFINES );
+
         /**
          * @brief Creates a Shader Program using a Vertex Shader and Fragment Shader
          * @param vertexShaderFilename name of the file corresponding to the vertex shader
@@ -165,6 +303,18 @@ namespace CSCI441 {
          */
         virtual ~ShaderProgram();
 
+        /**
+         * @brief returns if an asynchronous build has finished without blocking
+         * @return true if the program can be used without waiting on the driver
+         * @note Polls GL_COMPLETION_STATUS_KHR when parallel shader compile is supported, otherwise always true
+         */
+        [[maybe_unused]] [[nodiscard]] bool isBuildComplete() const;
+        /**
+         * @brief blocks until an asynchronous build has finished and the program has been introspected
+         * @note Called automatically on first use, calling explicitly controls where the wait happens
+         */
+        [[maybe_unused]] void finishBuild() const;
+
         /**
          * @brief do not allow shader programs to be copied
          */
@@ -197,6 +347,16 @@ namespace CSCI441 {
          */
         virtual GLint getUniformLocation( const char *uniformName ) const final;
 
+        /**
+         * @brief Resolves a typed handle to the given uniform to use with setProgramUniform() in hot paths
+         * @tparam T type of the uniform value
+         * @param UNIFORM_NAME name of the uniform, hashed at compile time when given a string literal
+         * @return handle to the uniform, invalid if the uniform is not found
+         * @note Prints an error message to standard error stream if the uniform is not found
+         */
+        template<typename T>
+        [[nodiscard]] UniformHandle<T> getUniformHandle( UniformName UNIFORM_NAME ) const;
+
         /**
          * @brief Returns the index of the given uniform block in this shader program
          * @param uniformBlockName name of the uniform block to get the index for
@@ -799,6 +959,16 @@ namespace CSCI441 {
          */
         virtual void setProgramUniform(GLint uniformLocation, GLuint dim, GLsizei count, const GLuint *value) const final;
 
+        /**
+         * @brief sets the program uniform referenced by a handle resolved with getUniformHandle()
+         * @tparam T type of the uniform value
+         * @param UNIFORM_HANDLE handle of the uniform to set
+         * @param VALUE value to set the uniform to
+         * @note no name lookup is performed, intended for per frame updates
+         */
+        template<typename T>
+        void setProgramUniform(const UniformHandle<T>& UNIFORM_HANDLE, const T& VALUE) const;
+
         /**
          * @brief returns a single value corresponding to which shader stages are present in this shader program
          * @return bitfield of shader stages
@@ -845,12 +1015,18 @@ namespace CSCI441 {
 
         /**
          * @brief caches locations of uniform names within shader program
+         * @note transparent comparator: lookups by std::string_view do not construct a std::string
          */
-        std::map<std::string, GLint> *mpUniformLocationsMap;
+        std::map<std::string, GLint, std::less<>> *mpUniformLocationsMap;
         /**
          * @brief caches locations of attribute names within shader program
+         * @note transparent comparator: lookups by std::string_view do not construct a std::string
          */
-        std::map<std::string, GLint> *mpAttributeLocationsMap;
+        std::map<std::string, GLint, std::less<>> *mpAttributeLocationsMap;
+        /**
+         * @brief caches locations of uniforms within shader program keyed by the hash of their name
+         */
+        std::unordered_map<uint64_t, GLint> *mpUniformLocationsByHashMap;
 
         /**
          * @brief registers a shader program with the GPU
@@ -871,6 +1047,48 @@ namespace CSCI441 {
 
     private:
         void _initialize();
+
+        // stages present in the program, set on both the compile and binary cache paths
+        GLbitfield _programStages;
+
+        // state carried from starting a build to finishing it
+        struct _PendingBuild {
+            bool isPending = false;
+            bool useBinaryCache = false;
+            bool loadedFromCache = false;
+            uint64_t binaryCacheKey = 0;
+            std::string programName;
+            std::chrono::steady_clock::time_point buildStart;
+        } _pendingBuild;
+
+        void _beginRegisterShaderProgram(const char *vertexShaderFilename,
+                                         const char *tessellationControlShaderFilename,
+                                         const char *tessellationEvaluationShaderFilename,
+                                         const char *geometryShaderFilename,
+                                         const char *fragmentShaderFilename,
+                                         bool isSeparable,
+                                         const ShaderDefines& DEFINES );
+        static void _injectDefines(std::string& source, const ShaderDefines& DEFINES);
+        void _finishRegisterShaderProgram();
+        // finishes an outstanding asynchronous build before the program is used or queried
+        void _finishPendingBuild() const;
+        [[nodiscard]] static bool _isParallelShaderCompileSupported();
+
+        // directory of the program binary cache, empty when the cache is disabled
+        static std::string _sBinaryCacheDirectory;
+
+        // how a single program was built during startup
+        struct _StartupRecord {
+            std::string name;
+            bool loadedFromCache;
+            double milliseconds;
+        };
+        static std::vector<_StartupRecord> _sStartupRecords;
+
+        [[nodiscard]] static uint64_t _computeBinaryCacheKey(const std::string SOURCES[5], bool isSeparable);
+        [[nodiscard]] static std::string _binaryCacheFilename(uint64_t key);
+        [[nodiscard]] bool _loadFromBinaryCache(uint64_t key);
+        void _writeToBinaryCache(uint64_t key) const;
     };
 
 }
@@ -878,6 +1096,8 @@ namespace CSCI441 {
 ////////////////////////////////////////////////////////////////////////////////
 
 inline bool CSCI441::ShaderProgram::sDEBUG = true;
+inline std::string CSCI441::ShaderProgram::_sBinaryCacheDirectory;
+inline std::vector<CSCI441::ShaderProgram::_StartupRecord> CSCI441::ShaderProgram::_sStartupRecords;
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::enableDebugMessages() {
@@ -889,12 +1109,116 @@ inline void CSCI441::ShaderProgram::disableDebugMessages() {
     sDEBUG = false;
 }
 
+[[maybe_unused]]
+inline void CSCI441::ShaderProgram::enableBinaryCache(const char* CACHE_DIRECTORY) {
+    std::error_code errorCode;
+    std::filesystem::create_directories(CACHE_DIRECTORY, errorCode);
+    if( errorCode ) {
+        fprintf(stderr, "[ERROR]: Could not create shader binary cache directory %s: %s\n", CACHE_DIRECTORY, errorCode.message().c_str());
+        _sBinaryCacheDirectory.clear();
+        return;
+    }
+    _sBinaryCacheDirectory = CACHE_DIRECTORY;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ShaderProgram::disableBinaryCache() {
+    _sBinaryCacheDirectory.clear();
+}
+
+[[maybe_unused]]
+inline void CSCI441::ShaderProgram::printStartupReport() {
+    GLuint numLoaded = 0;
+    double compileTime = 0.0, loadTime = 0.0;
+
+    printf( "\n[INFO]: /--------------------------------------------------------\\\n");
+    printf( "[INFO]: | Shader Program Startup Report                          |\n");
+    printf( "[INFO]: |--------------------------------------------------------|\n");
+    for( const auto& record : _sStartupRecords ) {
+        // keep the tail of long names, the shader filename is the interesting part
+        const char* name = record.name.c_str();
+        if( record.name.length() > 33 ) name += record.name.length() - 33;
+        printf( "[INFO]: | %-33s %-8s %8.2f ms |\n", name, (record.loadedFromCache ? "loaded" : "compiled"), record.milliseconds );
+        if( record.loadedFromCache ) {
+            numLoaded++;
+            loadTime += record.milliseconds;
+        } else {
+            compileTime += record.milliseconds;
+        }
+    }
+    printf( "[INFO]: |--------------------------------------------------------|\n");
+    printf( "[INFO]: | Compiled: %3zu programs in %10.2f ms                |\n", _sStartupRecords.size() - numLoaded, compileTime );
+    printf( "[INFO]: | Loaded:   %3u programs in %10.2f ms                |\n", numLoaded, loadTime );
+    printf( "[INFO]: \\--------------------------------------------------------/\n\n");
+}
+
+[[maybe_unused]]
+inline CSCI441::ShaderProgram* CSCI441::ShaderProgram::createAsync( const char *vertexShaderFilename, const char *fragmentShaderFilename, const bool isSeparable ) {
+    return createAsync(vertexShaderFilename, "", "", "", fragmentShaderFilename, isSeparable);
+}
+
+[[maybe_unused]]
+inline CSCI441::ShaderProgram* CSCI441::ShaderProgram::createAsync( const char *vertexShaderFilename, const char *fragmentShaderFilename, const ShaderDefines& DEFINES ) {
+    return createAsync(vertexShaderFilename, "", "", "", fragmentShaderFilename, false, DEFINES);
+}
+
+[[maybe_unused]]
+inline CSCI441::ShaderProgram* CSCI441::ShaderProgram::createAsync( const char *vertexShaderFilename, const char *tessellationControlShaderFilename, const char *tessellationEvaluationShaderFilename, const char *geometryShaderFilename, const char *fragmentShaderFilename, const bool isSeparable, const ShaderDefines& DEFINES ) {
+    auto shaderProgram = new CSCI441::ShaderProgram();
+    shaderProgram->_beginRegisterShaderProgram(vertexShaderFilename, tessellationControlShaderFilename, tessellationEvaluationShaderFilename, geometryShaderFilename, fragmentShaderFilename, isSeparable, DEFINES);
+    return shaderProgram;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ShaderProgram::enableParallelShaderCompile() {
+    if( !_isParallelShaderCompileSupported() ) {
+        if( sDEBUG ) printf( "[INFO]: Parallel shader compile not supported, programs will build serially\n" );
+        return;
+    }
+    // 0xFFFFFFFF lets the implementation choose the number of threads
+    glMaxShaderCompilerThreadsKHR(0xFFFFFFFF);
+}
+
+inline bool CSCI441::ShaderProgram::_isParallelShaderCompileSupported() {
+#ifdef CSCI441_USE_GLEW
+    return GLEW_KHR_parallel_shader_compile || GLEW_ARB_parallel_shader_compile;
+#else
+    return GLAD_GL_KHR_parallel_shader_compile || GLAD_GL_ARB_parallel_shader_compile;
+#endif
+}
+
+[[maybe_unused]]
+inline bool CSCI441::ShaderProgram::isBuildComplete() const {
+    if( !_pendingBuild.isPending ) return true;
+    if( !_isParallelShaderCompileSupported() ) return true;
+
+    GLint completionStatus = GL_TRUE;
+    glGetProgramiv(mShaderProgramHandle, GL_COMPLETION_STATUS_KHR, &completionStatus);
+    return completionStatus == GL_TRUE;
+}
+
+[[maybe_unused]]
+inline void CSCI441::ShaderProgram::finishBuild() const {
+    _finishPendingBuild();
+}
+
+inline void CSCI441::ShaderProgram::_finishPendingBuild() const {
+    // the maps and logs are filled in lazily, the program itself is logically unchanged
+    if( _pendingBuild.isPending ) const_cast<ShaderProgram*>(this)->_finishRegisterShaderProgram();
+}
+
 inline CSCI441::ShaderProgram::ShaderProgram( const char *vertexShaderFilename, const char *fragmentShaderFilename ) {
     _initialize();
     mRegisterShaderProgram(vertexShaderFilename, "", "", "", fragmentShaderFilename, false);
 }
 
 [[maybe_unused]]
+inline CSCI441::ShaderProgram::ShaderProgram( const char *vertexShaderFilename, const char *fragmentShaderFilename, const ShaderDefines& DEFINES ) {
+    _initialize();
+    _beginRegisterShaderProgram(vertexShaderFilename, "", "", "", fragmentShaderFilename, false, DEFINES);
+    _finishRegisterShaderProgram();
+}
+
 inline CSCI441::ShaderProgram::ShaderProgram( const char *vertexShaderFilename, const char *fragmentShaderFilename, const bool isSeparable ) {
     _initialize();
     mRegisterShaderProgram(vertexShaderFilename, "", "", "", fragmentShaderFilename, isSeparable);
@@ -1030,89 +1354,170 @@ inline CSCI441::ShaderProgram::ShaderProgram( const char **shaderFilenames,
 }
 
 inline bool CSCI441::ShaderProgram::mRegisterShaderProgram(const char *vertexShaderFilename, const char *tessellationControlShaderFilename, const char *tessellationEvaluationShaderFilename, const char *geometryShaderFilename, const char *fragmentShaderFilename, const bool isSeparable ) {
+    _beginRegisterShaderProgram(vertexShaderFilename, tessellationControlShaderFilename, tessellationEvaluationShaderFilename, geometryShaderFilename, fragmentShaderFilename, isSeparable, ShaderDefines());
+    _finishRegisterShaderProgram();
+
+    /* return handle */
+    return mShaderProgramHandle != 0;
+}
+
+inline void CSCI441::ShaderProgram::_beginRegisterShaderProgram(const char *vertexShaderFilename, const char *tessellationControlShaderFilename, const char *tessellationEvaluationShaderFilename, const char *geometryShaderFilename, const char *fragmentShaderFilename, const bool isSeparable, const ShaderDefines& DEFINES ) {
+    _pendingBuild.buildStart = std::chrono::steady_clock::now();
+
     GLint major, minor;
     glGetIntegerv(GL_MAJOR_VERSION, &major);
     glGetIntegerv(GL_MINOR_VERSION, &minor);
 
     if( sDEBUG ) printf( "\n[INFO]: /--------------------------------------------------------\\\n");
 
-    /* compile each one of our shaders */
-    if( strcmp( vertexShaderFilename, "" ) != 0 ) {
-        if( sDEBUG ) printf( "[INFO]: | Vertex Shader: %39s |\n", vertexShaderFilename );
-        mVertexShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShader(vertexShaderFilename, GL_VERTEX_SHADER );
-    } else {
-        mVertexShaderHandle = 0;
+    /* read in the source of each stage, the sources key the binary cache */
+    const char* shaderFilenames[5] = { vertexShaderFilename, tessellationControlShaderFilename, tessellationEvaluationShaderFilename, geometryShaderFilename, fragmentShaderFilename };
+    std::string shaderSources[5];
+    bool sourcesRead = true;
+    for( int stage = 0; stage < 5; stage++ ) {
+        if( strcmp( shaderFilenames[stage], "" ) != 0 ) {
+            char* shaderString;
+            if( CSCI441_INTERNAL::ShaderUtils::readTextFromFile( shaderFilenames[stage], shaderString ) ) {
+                shaderSources[stage] = shaderString;
+                delete[] shaderString;
+            } else {
+                sourcesRead = false;
+            }
+            /* defines become part of the source, so they also key the binary cache */
+            _injectDefines( shaderSources[stage], DEFINES );
+        }
     }
 
-    if(strcmp(tessellationControlShaderFilename, "" ) != 0 ) {
-        if( sDEBUG ) printf("[INFO]: | Tess Control Shader: %33s |\n", tessellationControlShaderFilename );
-        if( major < 4 ) {
-            printf( "[ERROR]:|   TESSELLATION SHADER NOT SUPPORTED!! UPGRADE TO v4.0+ |\n" );
-            mTessellationControlShaderHandle = 0;
-        } else {
-            mTessellationControlShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShader(tessellationControlShaderFilename, GL_TESS_CONTROL_SHADER );
+    /* name the program after its shader files for the startup report */
+    _pendingBuild.programName.clear();
+    for( const char* shaderFilename : shaderFilenames ) {
+        if( strcmp( shaderFilename, "" ) != 0 ) {
+            if( !_pendingBuild.programName.empty() ) _pendingBuild.programName += "+";
+            _pendingBuild.programName += std::filesystem::path(shaderFilename).filename().string();
         }
-    } else {
-        mTessellationControlShaderHandle = 0;
+    }
+    if( !DEFINES.empty() ) {
+        _pendingBuild.programName += "(" + std::to_string(DEFINES.size()) + "d)";
     }
 
-    if(strcmp(tessellationEvaluationShaderFilename, "" ) != 0 ) {
-        if( sDEBUG ) printf("[INFO]: | Tess Evaluation Shader: %30s |\n", tessellationEvaluationShaderFilename );
-        if( major < 4 ) {
-            printf( "[ERROR]:|   TESSELLATION SHADER NOT SUPPORTED!! UPGRADE TO v4.0+ |\n" );
-            mTessellationEvaluationShaderHandle = 0;
+    _pendingBuild.useBinaryCache = !_sBinaryCacheDirectory.empty() && sourcesRead;
+    _pendingBuild.binaryCacheKey = _pendingBuild.useBinaryCache ? _computeBinaryCacheKey(shaderSources, isSeparable) : 0;
+    _pendingBuild.loadedFromCache = false;
+    _pendingBuild.isPending = true;
+
+    if( _pendingBuild.useBinaryCache && _loadFromBinaryCache(_pendingBuild.binaryCacheKey) ) {
+        _pendingBuild.loadedFromCache = true;
+
+        _programStages = 0;
+        if( !shaderSources[0].empty() ) _programStages |= GL_VERTEX_SHADER_BIT;
+        if( !shaderSources[1].empty() ) _programStages |= GL_TESS_CONTROL_SHADER_BIT;
+        if( !shaderSources[2].empty() ) _programStages |= GL_TESS_EVALUATION_SHADER_BIT;
+        if( !shaderSources[3].empty() ) _programStages |= GL_GEOMETRY_SHADER_BIT;
+        if( !shaderSources[4].empty() ) _programStages |= GL_FRAGMENT_SHADER_BIT;
+
+        if( sDEBUG ) printf( "[INFO]: | Binary Cache: %016" PRIx64 ".bin %19s |\n", _pendingBuild.binaryCacheKey, "" );
+    } else {
+        /* queue compilation of each one of our shaders, status is not checked until the build is finished */
+        if( !shaderSources[0].empty() ) {
+            if( sDEBUG ) printf( "[INFO]: | Vertex Shader: %39s |\n", vertexShaderFilename );
+            mVertexShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShaderFromSource(shaderSources[0].c_str(), GL_VERTEX_SHADER, false );
         } else {
-            mTessellationEvaluationShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShader(tessellationEvaluationShaderFilename, GL_TESS_EVALUATION_SHADER );
+            mVertexShaderHandle = 0;
         }
-    } else {
-        mTessellationEvaluationShaderHandle = 0;
-    }
 
-    if( strcmp( geometryShaderFilename, "" ) != 0 ) {
-        if( sDEBUG ) printf( "[INFO]: | Geometry Shader: %37s |\n", geometryShaderFilename );
-        if( major < 3 || (major == 3 && minor < 2) ) {
-            printf( "[ERROR]:|   GEOMETRY SHADER NOT SUPPORTED!!!    UPGRADE TO v3.2+ |\n" );
+        if( !shaderSources[1].empty() ) {
+            if( sDEBUG ) printf("[INFO]: | Tess Control Shader: %33s |\n", tessellationControlShaderFilename );
+            if( major < 4 ) {
+                printf( "[ERROR]:|   TESSELLATION SHADER NOT SUPPORTED!! UPGRADE TO v4.0+ |\n" );
+                mTessellationControlShaderHandle = 0;
+            } else {
+                mTessellationControlShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShaderFromSource(shaderSources[1].c_str(), GL_TESS_CONTROL_SHADER, false );
+            }
+        } else {
+            mTessellationControlShaderHandle = 0;
+        }
+
+        if( !shaderSources[2].empty() ) {
+            if( sDEBUG ) printf("[INFO]: | Tess Evaluation Shader: %30s |\n", tessellationEvaluationShaderFilename );
+            if( major < 4 ) {
+                printf( "[ERROR]:|   TESSELLATION SHADER NOT SUPPORTED!! UPGRADE TO v4.0+ |\n" );
+                mTessellationEvaluationShaderHandle = 0;
+            } else {
+                mTessellationEvaluationShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShaderFromSource(shaderSources[2].c_str(), GL_TESS_EVALUATION_SHADER, false );
+            }
+        } else {
+            mTessellationEvaluationShaderHandle = 0;
+        }
+
+        if( !shaderSources[3].empty() ) {
+            if( sDEBUG ) printf( "[INFO]: | Geometry Shader: %37s |\n", geometryShaderFilename );
+            if( major < 3 || (major == 3 && minor < 2) ) {
+                printf( "[ERROR]:|   GEOMETRY SHADER NOT SUPPORTED!!!    UPGRADE TO v3.2+ |\n" );
+                mGeometryShaderHandle = 0;
+            } else {
+                mGeometryShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShaderFromSource(shaderSources[3].c_str(), GL_GEOMETRY_SHADER, false );
+            }
+        } else {
             mGeometryShaderHandle = 0;
+        }
+
+        if( !shaderSources[4].empty() ) {
+            if( sDEBUG ) printf( "[INFO]: | Fragment Shader: %37s |\n", fragmentShaderFilename );
+            mFragmentShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShaderFromSource(shaderSources[4].c_str(), GL_FRAGMENT_SHADER, false );
         } else {
-            mGeometryShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShader(geometryShaderFilename, GL_GEOMETRY_SHADER );
+            mFragmentShaderHandle = 0;
         }
-    } else {
-        mGeometryShaderHandle = 0;
-    }
+        /* get a handle to a shader program */
+        mShaderProgramHandle = glCreateProgram();
 
-    if( strcmp( fragmentShaderFilename, "" ) != 0 ) {
-        if( sDEBUG ) printf( "[INFO]: | Fragment Shader: %37s |\n", fragmentShaderFilename );
-        mFragmentShaderHandle = CSCI441_INTERNAL::ShaderUtils::compileShader(fragmentShaderFilename, GL_FRAGMENT_SHADER );
-    } else {
-        mFragmentShaderHandle = 0;
-    }
-    /* get a handle to a shader program */
-    mShaderProgramHandle = glCreateProgram();
+        /* if program is separable, make it so */
+        if( isSeparable ) {
+            glProgramParameteri(mShaderProgramHandle, GL_PROGRAM_SEPARABLE, GL_TRUE );
+        }
 
-    /* if program is separable, make it so */
-    if( isSeparable ) {
-        glProgramParameteri(mShaderProgramHandle, GL_PROGRAM_SEPARABLE, GL_TRUE );
-    }
+        /* let the driver know we intend to read the binary back out */
+        if( _pendingBuild.useBinaryCache ) {
+            glProgramParameteri(mShaderProgramHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
+        }
 
-    /* attach the vertex and fragment shaders to the shader program */
-    if(mVertexShaderHandle != 0 ) {
-        glAttachShader(mShaderProgramHandle, mVertexShaderHandle );
-    }
-    if(mTessellationControlShaderHandle != 0 ) {
-        glAttachShader(mShaderProgramHandle, mTessellationControlShaderHandle );
-    }
-    if(mTessellationEvaluationShaderHandle != 0 ) {
-        glAttachShader(mShaderProgramHandle, mTessellationEvaluationShaderHandle );
-    }
-    if(mGeometryShaderHandle != 0 ) {
-        glAttachShader(mShaderProgramHandle, mGeometryShaderHandle );
-    }
-    if(mFragmentShaderHandle != 0 ) {
-        glAttachShader(mShaderProgramHandle, mFragmentShaderHandle );
+        /* attach the vertex and fragment shaders to the shader program */
+        if(mVertexShaderHandle != 0 ) {
+            glAttachShader(mShaderProgramHandle, mVertexShaderHandle );
+        }
+        if(mTessellationControlShaderHandle != 0 ) {
+            glAttachShader(mShaderProgramHandle, mTessellationControlShaderHandle );
+        }
+        if(mTessellationEvaluationShaderHandle != 0 ) {
+            glAttachShader(mShaderProgramHandle, mTessellationEvaluationShaderHandle );
+        }
+        if(mGeometryShaderHandle != 0 ) {
+            glAttachShader(mShaderProgramHandle, mGeometryShaderHandle );
+        }
+        if(mFragmentShaderHandle != 0 ) {
+            glAttachShader(mShaderProgramHandle, mFragmentShaderHandle );
+        }
+
+        /* link all the programs together on the GPU, drivers supporting parallel compilation return immediately */
+        glLinkProgram(mShaderProgramHandle );
+
+        _programStages = 0;
+        if( mVertexShaderHandle != 0                 ) _programStages |= GL_VERTEX_SHADER_BIT;
+        if( mTessellationControlShaderHandle != 0    ) _programStages |= GL_TESS_CONTROL_SHADER_BIT;
+        if( mTessellationEvaluationShaderHandle != 0 ) _programStages |= GL_TESS_EVALUATION_SHADER_BIT;
+        if( mGeometryShaderHandle != 0               ) _programStages |= GL_GEOMETRY_SHADER_BIT;
+        if( mFragmentShaderHandle != 0               ) _programStages |= GL_FRAGMENT_SHADER_BIT;
     }
+}
 
-    /* link all the programs together on the GPU */
-    glLinkProgram(mShaderProgramHandle );
+inline void CSCI441::ShaderProgram::_finishRegisterShaderProgram() {
+    if( !_pendingBuild.isPending ) return;
+    _pendingBuild.isPending = false;
+
+    /* check the shader logs, blocks until each compile has completed */
+    const GLuint shaderHandles[5] = { mVertexShaderHandle, mTessellationControlShaderHandle, mTessellationEvaluationShaderHandle, mGeometryShaderHandle, mFragmentShaderHandle };
+    for( GLuint shaderHandle : shaderHandles ) {
+        if( shaderHandle != 0 ) CSCI441_INTERNAL::ShaderUtils::printShaderLog( shaderHandle );
+    }
 
     if( sDEBUG ) printf( "[INFO]: | Shader Program: %41s", "|\n" );
 
@@ -1142,7 +1547,8 @@ inline bool CSCI441::ShaderProgram::mRegisterShaderProgram(const char *vertexSha
     }
 
     // map uniforms
-    mpUniformLocationsMap = new std::map<std::string, GLint>();
+    mpUniformLocationsMap = new std::map<std::string, GLint, std::less<>>();
+    mpUniformLocationsByHashMap = new std::unordered_map<uint64_t, GLint>();
     GLint numUniforms;
     glGetProgramiv(mShaderProgramHandle, GL_ACTIVE_UNIFORMS, &numUniforms);
     if( numUniforms > 0 ) {
@@ -1164,11 +1570,19 @@ inline bool CSCI441::ShaderProgram::mRegisterShaderProgram(const char *vertexSha
                 location = glGetUniformLocation(mShaderProgramHandle, name);
             }
             mpUniformLocationsMap->emplace(name, location );
+            mpUniformLocationsByHashMap->emplace(CSCI441_INTERNAL::ShaderUtils::hashStringFNV1a(name), location );
+            // arrays are reported as "name[0]", also allow looking up the first element by its base name
+            if( actual_length > 3 && strcmp(name + actual_length - 3, "[0]") == 0 ) {
+                name[actual_length - 3] = '\0';
+                GLint baseLocation = glGetUniformLocation(mShaderProgramHandle, name);
+                mpUniformLocationsMap->emplace(name, baseLocation );
+                mpUniformLocationsByHashMap->emplace(CSCI441_INTERNAL::ShaderUtils::hashStringFNV1a(name), baseLocation );
+            }
         }
     }
 
     // map attributes
-    mpAttributeLocationsMap = new std::map<std::string, GLint>();
+    mpAttributeLocationsMap = new std::map<std::string, GLint, std::less<>>();
     GLint numAttributes;
     glGetProgramiv(mShaderProgramHandle, GL_ACTIVE_ATTRIBUTES, &numAttributes );
     if( numAttributes > 0 ) {
@@ -1201,26 +1615,156 @@ inline bool CSCI441::ShaderProgram::mRegisterShaderProgram(const char *vertexSha
     GLint linkStatus;
     glGetProgramiv(mShaderProgramHandle, GL_LINK_STATUS, &linkStatus );
 
+    /* store freshly linked programs so the next launch can skip compilation */
+    if( linkStatus == 1 && _pendingBuild.useBinaryCache && !_pendingBuild.loadedFromCache ) {
+        _writeToBinaryCache(_pendingBuild.binaryCacheKey);
+    }
+
     /* print shader info for uniforms & attributes */
     if(linkStatus == 1) {
-        CSCI441_INTERNAL::ShaderUtils::printShaderProgramInfo(mShaderProgramHandle, mVertexShaderHandle != 0,
-                                                              mTessellationControlShaderHandle != 0,
-                                                              mTessellationEvaluationShaderHandle != 0,
-                                                              mGeometryShaderHandle != 0, mFragmentShaderHandle != 0,
+        CSCI441_INTERNAL::ShaderUtils::printShaderProgramInfo(mShaderProgramHandle,
+                                                              (_programStages & GL_VERTEX_SHADER_BIT) != 0,
+                                                              (_programStages & GL_TESS_CONTROL_SHADER_BIT) != 0,
+                                                              (_programStages & GL_TESS_EVALUATION_SHADER_BIT) != 0,
+                                                              (_programStages & GL_GEOMETRY_SHADER_BIT) != 0,
+                                                              (_programStages & GL_FRAGMENT_SHADER_BIT) != 0,
                                                               false, true);
     }
-    /* return handle */
-    return mShaderProgramHandle != 0;
+
+    /* record how long this program took to build, for asynchronous builds this includes time overlapped with other work */
+    _sStartupRecords.push_back( { _pendingBuild.programName, _pendingBuild.loadedFromCache,
+                                  std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _pendingBuild.buildStart).count() } );
+}
+
+inline void CSCI441::ShaderProgram::_injectDefines(std::string& source, const ShaderDefines& DEFINES) {
+    if( DEFINES.empty() || source.empty() ) return;
+
+    // #version must remain the first directive, so insert on the line after it
+    size_t insertPosition = 0;
+    size_t versionPosition = source.find("#version");
+    if( versionPosition != std::string::npos ) {
+        size_t endOfLine = source.find('\n', versionPosition);
+        insertPosition = (endOfLine == std::string::npos) ? source.length() : endOfLine + 1;
+    }
+    const auto nextLineNumber = std::count(source.begin(), source.begin() + (std::ptrdiff_t)insertPosition, '\n') + 1;
+
+    std::string defineBlock;
+    for( const auto& define : DEFINES ) {
+        defineBlock += "#define " + define.first + " " + define.second + "\n";
+    }
+    // keep compiler messages pointing at the lines of the file on disk
+    defineBlock += "#line " + std::to_string(nextLineNumber) + "\n";
+
+    if( insertPosition == source.length() && source.back() != '\n' ) source += "\n";
+    source.insert(insertPosition, defineBlock);
+}
+
+inline uint64_t CSCI441::ShaderProgram::_computeBinaryCacheKey(const std::string SOURCES[5], const bool isSeparable) {
+    uint64_t key = CSCI441_INTERNAL::ShaderUtils::hashFNV1a(nullptr, 0);
+
+    // binaries are only valid for the driver that produced them
+    const GLenum DRIVER_STRINGS[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+    for( GLenum driverString : DRIVER_STRINGS ) {
+        const auto value = reinterpret_cast<const char*>( glGetString(driverString) );
+        if( value != nullptr ) key = CSCI441_INTERNAL::ShaderUtils::hashFNV1a(value, strlen(value) + 1, key);
+    }
+
+    // hash the length along with the text so that moving code between stages changes the key
+    for( int stage = 0; stage < 5; stage++ ) {
+        const uint64_t length = SOURCES[stage].length();
+        key = CSCI441_INTERNAL::ShaderUtils::hashFNV1a(&length, sizeof(length), key);
+        key = CSCI441_INTERNAL::ShaderUtils::hashFNV1a(SOURCES[stage].data(), SOURCES[stage].length(), key);
+    }
+
+    const unsigned char separable = isSeparable ? 1 : 0;
+    return CSCI441_INTERNAL::ShaderUtils::hashFNV1a(&separable, sizeof(separable), key);
+}
+
+inline std::string CSCI441::ShaderProgram::_binaryCacheFilename(const uint64_t key) {
+    char filename[32];
+    snprintf(filename, sizeof(filename), "%016" PRIx64 ".bin", key);
+    return (std::filesystem::path(_sBinaryCacheDirectory) / filename).string();
+}
+
+inline bool CSCI441::ShaderProgram::_loadFromBinaryCache(const uint64_t key) {
+    std::ifstream inputStream(_binaryCacheFilename(key), std::ios::binary);
+    if( !inputStream.is_open() ) return false;
+
+    // header is the key the binary was stored under followed by the driver's binary format
+    uint64_t storedKey = 0;
+    GLenum format = 0;
+    inputStream.read( reinterpret_cast<char*>(&storedKey), sizeof(storedKey) );
+    inputStream.read( reinterpret_cast<char*>(&format), sizeof(format) );
+    std::istreambuf_iterator<char> startIt(inputStream), endIt;
+    std::vector<char> buffer(startIt, endIt);
+    inputStream.close();
+
+    if( storedKey != key || buffer.empty() ) return false;
+
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, format, buffer.data(), (GLsizei)buffer.size() );
+
+    // drivers may reject a binary at any time, e.g. after an update, so fall back to compiling
+    GLint status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if( status == GL_FALSE ) {
+        if( sDEBUG ) printf( "[INFO]: | Binary Cache: stale binary rejected by driver          |\n" );
+        glDeleteProgram(program);
+        return false;
+    }
+
+    mShaderProgramHandle = program;
+    return true;
+}
+
+inline void CSCI441::ShaderProgram::_writeToBinaryCache(const uint64_t key) const {
+    GLint length = 0;
+    glGetProgramiv(mShaderProgramHandle, GL_PROGRAM_BINARY_LENGTH, &length);
+    if( length <= 0 ) return;
+
+    std::vector<GLubyte> buffer(length);
+    GLenum format = 0;
+    glGetProgramBinary(mShaderProgramHandle, length, nullptr, &format, buffer.data());
+
+    std::ofstream out(_binaryCacheFilename(key), std::ios::binary);
+    if( !out.is_open() ) {
+        fprintf(stderr, "[ERROR]: Could not write shader binary cache file %s\n", _binaryCacheFilename(key).c_str());
+        return;
+    }
+    out.write( reinterpret_cast<const char*>(&key), sizeof(key) );
+    out.write( reinterpret_cast<const char*>(&format), sizeof(format) );
+    out.write( reinterpret_cast<const char*>(buffer.data()), length );
+    out.close();
 }
 
 inline GLint CSCI441::ShaderProgram::getUniformLocation( const char *uniformName ) const {
+    _finishPendingBuild();
     GLint uniformLoc = glGetUniformLocation(mShaderProgramHandle, uniformName );
     if( uniformLoc == -1 )
         fprintf(stderr, "[ERROR]: Could not find uniform \"%s\" for Shader Program %u\n", uniformName, mShaderProgramHandle );
     return uniformLoc;
 }
 
+template<typename T>
+inline CSCI441::UniformHandle<T> CSCI441::ShaderProgram::getUniformHandle( const UniformName UNIFORM_NAME ) const {
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsByHashMap->find(UNIFORM_NAME.hash);
+    if( uniformIter == mpUniformLocationsByHashMap->end() ) {
+        fprintf(stderr, "[ERROR]: Could not find uniform \"%s\" for Shader Program %u\n", UNIFORM_NAME.name, mShaderProgramHandle );
+        return UniformHandle<T>();
+    }
+    return UniformHandle<T>(uniformIter->second);
+}
+
+template<typename T>
+inline void CSCI441::ShaderProgram::setProgramUniform( const UniformHandle<T>& UNIFORM_HANDLE, const T& VALUE ) const {
+    if( UNIFORM_HANDLE.isValid() ) {
+        setProgramUniform( UNIFORM_HANDLE.getLocation(), VALUE );
+    }
+}
+
 inline GLint CSCI441::ShaderProgram::getUniformBlockIndex( const char *uniformBlockName ) const {
+    _finishPendingBuild();
     GLint uniformBlockLoc = glGetUniformBlockIndex(mShaderProgramHandle, uniformBlockName );
     if( uniformBlockLoc == -1 )
         fprintf(stderr, "[ERROR]: Could not find uniform block \"%s\" for Shader Program %u\n", uniformBlockName, mShaderProgramHandle );
@@ -1284,7 +1828,8 @@ inline void CSCI441::ShaderProgram::setUniformBlockBinding( const char *uniformB
 
 [[maybe_unused]]
 inline GLint CSCI441::ShaderProgram::getAttributeLocation( const char *attributeName ) const {
-    auto attribIter = mpAttributeLocationsMap->find(attributeName);
+    _finishPendingBuild();
+    auto attribIter = mpAttributeLocationsMap->find(std::string_view(attributeName));
     if(attribIter == mpAttributeLocationsMap->end() ) {
         fprintf(stderr, "[ERROR]: Could not find attribute \"%s\" for Shader Program %u\n", attributeName, mShaderProgramHandle );
         return -1;
@@ -1403,17 +1948,20 @@ inline GLuint CSCI441::ShaderProgram::getNumAttributes() const {
 }
 
 inline GLuint CSCI441::ShaderProgram::getShaderProgramHandle() const {
+    _finishPendingBuild();
     return mShaderProgramHandle;
 }
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::useProgram() const {
+    _finishPendingBuild();
     glUseProgram(mShaderProgramHandle );
 }
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLfloat v0 ) const  {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform1f(mShaderProgramHandle, uniformIter->second, v0 );
     } else {
@@ -1423,7 +1971,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLfloat v0, GLfloat v1 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform2f(mShaderProgramHandle, uniformIter->second, v0, v1 );
     } else {
@@ -1438,7 +1987,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLfloat v0, GLfloat v1, GLfloat v2 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform3f(mShaderProgramHandle, uniformIter->second, v0, v1, v2 );
     } else {
@@ -1453,7 +2003,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform4f(mShaderProgramHandle, uniformIter->second, v0, v1, v2, v3 );
     } else {
@@ -1467,7 +2018,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 }
 
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, GLuint dim, GLsizei count, const GLfloat *value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         switch(dim) {
             case 1:
@@ -1493,7 +2045,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, G
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLint v0 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform1i(mShaderProgramHandle, uniformIter->second, v0 );
     } else {
@@ -1503,7 +2056,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLint v0, GLint v1 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform2i(mShaderProgramHandle, uniformIter->second, v0, v1 );
     } else {
@@ -1513,7 +2067,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, glm::ivec2 value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform2iv(mShaderProgramHandle, uniformIter->second, 1, &value[0] );
     } else {
@@ -1523,7 +2078,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, g
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLint v0, GLint v1, GLint v2 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform3i(mShaderProgramHandle, uniformIter->second, v0, v1, v2 );
     } else {
@@ -1533,7 +2089,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, glm::ivec3 value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform3iv(mShaderProgramHandle, uniformIter->second, 1, &value[0] );
     } else {
@@ -1543,7 +2100,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, g
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLint v0, GLint v1, GLint v2, GLint v3 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform4i(mShaderProgramHandle, uniformIter->second, v0, v1, v2, v3 );
     } else {
@@ -1553,7 +2111,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, glm::ivec4 value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform4iv(mShaderProgramHandle, uniformIter->second, 1, &value[0] );
     } else {
@@ -1563,7 +2122,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, g
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, GLuint dim, GLsizei count, const GLint *value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         switch(dim) {
             case 1:
@@ -1589,7 +2149,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, G
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLuint v0 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform1ui(mShaderProgramHandle, uniformIter->second, v0 );
     } else {
@@ -1599,7 +2160,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLuint v0, GLuint v1 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform2ui(mShaderProgramHandle, uniformIter->second, v0, v1 );
     } else {
@@ -1609,7 +2171,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, glm::uvec2 value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform2uiv(mShaderProgramHandle, uniformIter->second, 1, &value[0] );
     } else {
@@ -1619,7 +2182,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, g
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLuint v0, GLuint v1, GLuint v2 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform3ui(mShaderProgramHandle, uniformIter->second, v0, v1, v2 );
     } else {
@@ -1629,7 +2193,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, glm::uvec3 value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform3uiv(mShaderProgramHandle, uniformIter->second, 1, &value[0] );
     } else {
@@ -1639,7 +2204,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, g
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, GLuint v0, GLuint v1, GLuint v2, GLuint v3 ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform4ui(mShaderProgramHandle, uniformIter->second, v0, v1, v2, v3 );
     } else {
@@ -1649,7 +2215,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, glm::uvec4 value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniform4uiv(mShaderProgramHandle, uniformIter->second, 1, &value[0] );
     } else {
@@ -1659,7 +2226,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, g
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, GLuint dim, GLsizei count, const GLuint *value) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         switch(dim) {
             case 1:
@@ -1685,7 +2253,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform(const char* uniformName, G
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat2 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix2fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1695,7 +2264,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat3 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix3fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1705,7 +2275,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat4 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix4fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1715,7 +2286,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat2x3 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix2x3fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1725,7 +2297,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat3x2 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix3x2fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1735,7 +2308,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat2x4 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix2x4fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1745,7 +2319,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat4x2 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix4x2fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1755,7 +2330,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat3x4 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix3x4fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1765,7 +2341,8 @@ inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName,
 
 [[maybe_unused]]
 inline void CSCI441::ShaderProgram::setProgramUniform( const char *uniformName, glm::mat4x3 mtx ) const {
-    auto uniformIter = mpUniformLocationsMap->find(uniformName);
+    _finishPendingBuild();
+    auto uniformIter = mpUniformLocationsMap->find(std::string_view(uniformName));
     if(uniformIter != mpUniformLocationsMap->end()) {
         glProgramUniformMatrix4x3fv(mShaderProgramHandle, uniformIter->second, 1, GL_FALSE, &mtx[0][0] );
     } else {
@@ -1985,13 +2562,7 @@ inline void CSCI441::ShaderProgram::setProgramUniform( GLint uniformLocation, gl
 
 [[maybe_unused]]
 inline GLbitfield CSCI441::ShaderProgram::getProgramStages() const {
-    GLbitfield shaderBits = 0;
-    if( mVertexShaderHandle != 0                 ) shaderBits |= GL_VERTEX_SHADER_BIT;
-    if( mTessellationControlShaderHandle != 0    ) shaderBits |= GL_TESS_CONTROL_SHADER_BIT;
-    if( mTessellationEvaluationShaderHandle != 0 ) shaderBits |= GL_TESS_EVALUATION_SHADER_BIT;
-    if( mGeometryShaderHandle != 0               ) shaderBits |= GL_GEOMETRY_SHADER_BIT;
-    if( mFragmentShaderHandle != 0               ) shaderBits |= GL_FRAGMENT_SHADER_BIT;
-    return shaderBits;
+    return _programStages;
 }
 
 inline CSCI441::ShaderProgram::ShaderProgram() {
@@ -2007,6 +2578,8 @@ inline void CSCI441::ShaderProgram::_initialize() {
     mShaderProgramHandle = 0;
     mpUniformLocationsMap = nullptr;
     mpAttributeLocationsMap = nullptr;
+    mpUniformLocationsByHashMap = nullptr;
+    _programStages = 0;
 }
 
 inline CSCI441::ShaderProgram::~ShaderProgram() {
@@ -2014,6 +2587,15 @@ inline CSCI441::ShaderProgram::~ShaderProgram() {
     int infoLogLength = 0;
     int maxLength = 1000;
 
+    // an unfinished asynchronous build still owns its shader objects
+    if( _pendingBuild.isPending ) {
+        glDeleteShader(mVertexShaderHandle );
+        glDeleteShader(mTessellationControlShaderHandle );
+        glDeleteShader(mTessellationEvaluationShaderHandle );
+        glDeleteShader(mGeometryShaderHandle );
+        glDeleteShader(mFragmentShaderHandle );
+    }
+
     glDeleteProgram(mShaderProgramHandle );
 
     // create a buffer of designated length
@@ -2031,6 +2613,7 @@ inline CSCI441::ShaderProgram::~ShaderProgram() {
 
     delete mpUniformLocationsMap;
     delete mpAttributeLocationsMap;
+    delete mpUniformLocationsByHashMap;
     delete[] infoLog;
 }
 
@@ -20,6 +20,7 @@
     #include <glad/gl.h>
 #endif
 
+#include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <fstream>
@@ -63,6 +64,25 @@ namespace CSCI441_INTERNAL::ShaderUtils {
     // GLuint shader handle if compilation successful.  -1 otherwise
     GLuint compileShader( const char *filename, GLenum shaderType );
 
+    // Compiles the associated shader type from shader source already in memory
+    // const char* null terminated GLSL source
+    // GLenum type of shader source corresponds to
+    // GLboolean if the shader log should be checked, which waits for compilation to finish (defaults to true)
+    // GLuint shader handle
+    GLuint compileShaderFromSource( const char *source, GLenum shaderType, GLboolean checkLog = true );
+
+    // Computes the 64-bit FNV-1a hash of a block of memory
+    // const void* start of the data to hash
+    // size_t number of bytes to hash
+    // uint64_t hash to continue from, allows several blocks to be combined (defaults to the FNV offset basis)
+    // uint64_t resulting hash
+    uint64_t hashFNV1a( const void *data, size_t length, uint64_t hash = 0xcbf29ce484222325ULL );
+
+    // Computes the 64-bit FNV-1a hash of a null terminated string, usable at compile time
+    // const char* string to hash
+    // uint64_t resulting hash, equal to hashFNV1a() over the characters of the string
+    constexpr uint64_t hashStringFNV1a( const char *str );
+
     // Prints the shader log for the associated Shader handle
     void printShaderLog( GLuint shaderHandle );
 
@@ -800,23 +820,15 @@ inline GLuint CSCI441_INTERNAL::ShaderUtils::compileShader(
         const char *filename,
         const GLenum shaderType
 ) {
-	GLuint shaderHandle = glCreateShader( shaderType );	char *shaderString;
+	char *shaderString;
 
     // read in each text file and store the contents in a string
     if( readTextFromFile( filename, shaderString ) ) {
-
-		// send the contents of each program to the GPU
-		glShaderSource( shaderHandle, 1, (const char**)&shaderString, nullptr );
+		GLuint shaderHandle = compileShaderFromSource( shaderString, shaderType );
 
 		// we are good programmers so free up the memory used by each buffer
 		delete [] shaderString;
 
-		// compile each shader on the GPU
-		glCompileShader( shaderHandle );
-
-		// check the shader log
-		printShaderLog( shaderHandle );
-
 		// return the handle of our shader
 		return shaderHandle;
 	} else {
@@ -824,4 +836,48 @@ inline GLuint CSCI441_INTERNAL::ShaderUtils::compileShader(
 	}
 }
 
+inline GLuint CSCI441_INTERNAL::ShaderUtils::compileShaderFromSource(
+        const char *source,
+        const GLenum shaderType,
+        const GLboolean checkLog
+) {
+	GLuint shaderHandle = glCreateShader( shaderType );
+
+	// send the contents of each program to the GPU
+	glShaderSource( shaderHandle, 1, &source, nullptr );
+
+	// compile each shader on the GPU
+	glCompileShader( shaderHandle );
+
+	// check the shader log
+	if( checkLog ) printShaderLog( shaderHandle );
+
+	// return the handle of our shader
+	return shaderHandle;
+}
+
+inline uint64_t CSCI441_INTERNAL::ShaderUtils::hashFNV1a(
+        const void *data,
+        const size_t length,
+        uint64_t hash
+) {
+    const auto *bytes = static_cast<const unsigned char*>(data);
+    for( size_t i = 0; i < length; i++ ) {
+        hash ^= bytes[i];
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+constexpr uint64_t CSCI441_INTERNAL::ShaderUtils::hashStringFNV1a(
+        const char *str
+) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for( ; *str != '\0'; str++ ) {
+        hash ^= static_cast<unsigned char>(*str);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
 #endif // CSCI441_SHADER_UTILS_HPP
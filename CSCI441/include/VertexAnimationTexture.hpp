@@ -0,0 +1,405 @@
+/**
+ * @file VertexAnimationTexture.hpp
+ * @brief Bakes MD5 animations into float textures and plays them back with instanced draws
+ *
+ * @copyright MIT License
+ *
+ *	These functions, classes, and constants help minimize common
+ *	code that needs to be written.
+ */
+
+#ifndef CSCI441_VERTEX_ANIMATION_TEXTURE_HPP
+#define CSCI441_VERTEX_ANIMATION_TEXTURE_HPP
+
+#include "MD5Model.hpp"
+
+#ifdef CSCI441_USE_GLEW
+    #include <GL/glew.h>
+#else
+    #include <glad/gl.h>
+#endif
+
+#include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
+#include <glm/vec4.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <vector>
+
+namespace CSCI441 {
+
+    /**
+     * @brief Plays back a skinned MD5 animation entirely in the vertex shader.
+     * @note The animation is sampled at a fixed rate and every skinned vertex position and
+     * normal is stored in a float texture.  Vertex n of sample s lives at texel
+     * (n % width, s * rowsPerSample + n / width).  The vertex shader looks up its own
+     * position with gl_VertexID so many figures, each at their own phase of the clip,
+     * are drawn with a single instanced call per mesh.
+     * @note see shaders/vat.v.glsl for the matching vertex shader
+     */
+    class VertexAnimationTexture final {
+    public:
+        /**
+         * @brief per instance data used to place and time each figure
+         */
+        struct Instance {
+            /**
+             * @brief world position of the figure (xyz) and its rotation about the Y axis in radians (w)
+             */
+            glm::vec4 positionHeading = {0.0f, 0.0f, 0.0f, 0.0f};
+            /**
+             * @brief time offset into the clip in seconds (x) and playback speed multiplier (y)
+             */
+            glm::vec2 phaseSpeed = {0.0f, 1.0f};
+        };
+
+        /**
+         * @brief texture unit the diffuse map is bound to when drawing
+         */
+        static constexpr GLint DIFFUSE_TEXTURE_UNIT = 0;
+        /**
+         * @brief texture unit the baked positions are bound to when drawing
+         */
+        static constexpr GLint POSITION_TEXTURE_UNIT = 1;
+        /**
+         * @brief texture unit the baked normals are bound to when drawing
+         */
+        static constexpr GLint NORMAL_TEXTURE_UNIT = 2;
+
+        /**
+         * @brief Enables the summary printed by bake()
+         * @note Debug messages are on by default.
+         */
+        [[maybe_unused]] static void enableDebugMessages() { sDEBUG = true; }
+        /**
+         * @brief Disables the summary printed by bake()
+         * @note Debug messages are on by default.
+         */
+        [[maybe_unused]] static void disableDebugMessages() { sDEBUG = false; }
+
+        /**
+         * @brief initializes an empty vertex animation texture
+         */
+        VertexAnimationTexture();
+        /**
+         * @brief deletes all GPU resources
+         */
+        ~VertexAnimationTexture();
+
+        /**
+         * @brief do not allow copying, the object owns GPU handles
+         */
+        VertexAnimationTexture(const VertexAnimationTexture&) = delete;
+        /**
+         * @brief do not allow copying, the object owns GPU handles
+         */
+        VertexAnimationTexture& operator=(const VertexAnimationTexture&) = delete;
+
+        /**
+         * @brief samples the model's animation and uploads the skinned vertices to the GPU
+         * @param MODEL loaded MD5 model with a compatible animation
+         * @param SAMPLE_RATE number of samples to store per second of animation
+         * @returns true if the animation was baked and uploaded successfully
+         */
+        [[nodiscard]] bool bake(const MD5Model& MODEL, GLfloat SAMPLE_RATE = 30.0f);
+
+        /**
+         * @brief creates the VAO holding mesh topology and per instance attributes
+         * @param vTexCoordAttribLoc location of the per vertex texture coordinate attribute
+         * @param iPositionHeadingAttribLoc location of the per instance vec4 position & heading attribute
+         * @param iPhaseSpeedAttribLoc location of the per instance vec2 phase & speed attribute
+         * @note must be called after bake()
+         */
+        [[maybe_unused]] void allocVertexArrays(GLint vTexCoordAttribLoc, GLint iPositionHeadingAttribLoc, GLint iPhaseSpeedAttribLoc);
+
+        /**
+         * @brief uploads the figures to draw
+         * @param NUM_INSTANCES number of entries in pINSTANCES
+         * @param pINSTANCES array of per instance placement and timing
+         * @note may be called every frame, the buffer is only reallocated when it grows
+         */
+        [[maybe_unused]] void setInstances(GLsizei NUM_INSTANCES, const Instance* pINSTANCES);
+
+        /**
+         * @brief draws every instance, one instanced draw call per mesh
+         * @note the shader program must be in use and have its sampler and clip uniforms set
+         */
+        [[maybe_unused]] void draw() const;
+
+        /**
+         * @brief number of vertices skinned per sample
+         */
+        [[nodiscard]] GLint getNumVertices() const { return _numVertices; }
+        /**
+         * @brief number of samples stored in the texture
+         */
+        [[nodiscard]] GLint getNumSamples() const { return _numSamples; }
+        /**
+         * @brief samples stored per second of animation
+         */
+        [[nodiscard]] GLfloat getSampleRate() const { return _sampleRate; }
+        /**
+         * @brief width in texels of the baked textures
+         */
+        [[nodiscard]] GLint getTextureWidth() const { return _textureWidth; }
+        /**
+         * @brief number of texture rows occupied by a single sample
+         */
+        [[nodiscard]] GLint getRowsPerSample() const { return _rowsPerSample; }
+        /**
+         * @brief handle of the baked position texture
+         */
+        [[nodiscard]] GLuint getPositionTextureHandle() const { return _positionTexture; }
+        /**
+         * @brief handle of the baked normal texture
+         */
+        [[nodiscard]] GLuint getNormalTextureHandle() const { return _normalTexture; }
+
+    private:
+        /**
+         * @brief if DEBUG information should be printed or not
+         * @note defaults to true
+         */
+        inline static bool sDEBUG = true;
+
+        GLint _numVertices;
+        GLint _numSamples;
+        GLfloat _sampleRate;
+        GLint _textureWidth;
+        GLint _rowsPerSample;
+
+        GLuint _positionTexture;
+        GLuint _normalTexture;
+
+        std::vector<glm::vec2> _texCoords;
+        std::vector<GLuint> _indices;
+        std::vector<GLint> _meshIndexOffsets;
+        std::vector<GLuint> _diffuseTextures;
+
+        GLuint _vao;
+        GLuint _vbo;
+        GLuint _ibo;
+        GLuint _instanceVBO;
+        GLsizei _numInstances;
+        GLsizei _instanceCapacity;
+
+        static GLuint _uploadSamples(const std::vector<glm::vec3>& SAMPLES, GLint WIDTH, GLint ROWS_PER_SAMPLE, GLint NUM_VERTICES, GLint NUM_SAMPLES, GLint internalFormat);
+        void _freeTextures();
+        void _freeVertexArrays();
+    };
+}
+
+//----------------------------------------------------------------------------------------------------
+
+inline CSCI441::VertexAnimationTexture::VertexAnimationTexture()
+    : _numVertices(0),
+      _numSamples(0),
+      _sampleRate(0.0f),
+      _textureWidth(0),
+      _rowsPerSample(0),
+      _positionTexture(0),
+      _normalTexture(0),
+      _vao(0),
+      _vbo(0),
+      _ibo(0),
+      _instanceVBO(0),
+      _numInstances(0),
+      _instanceCapacity(0)
+{
+
+}
+
+inline CSCI441::VertexAnimationTexture::~VertexAnimationTexture()
+{
+    _freeVertexArrays();
+    _freeTextures();
+}
+
+inline bool
+CSCI441::VertexAnimationTexture::bake(
+        const MD5Model& MODEL,
+        const GLfloat SAMPLE_RATE
+) {
+    _freeTextures();
+
+    std::vector<glm::vec3> positions, normals;
+    const GLint NUM_SAMPLES = MODEL.bakeAnimation(SAMPLE_RATE, positions, normals);
+    if( NUM_SAMPLES == 0 ) {
+        fprintf(stderr, "[ERROR]: Could not bake vertex animation texture, model has no animation\n");
+        return false;
+    }
+
+    GLint maxTextureSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+
+    const GLint NUM_VERTICES = MODEL.getNumVertices();
+    const GLint WIDTH = NUM_VERTICES < maxTextureSize ? NUM_VERTICES : maxTextureSize;
+    const GLint ROWS_PER_SAMPLE = (NUM_VERTICES + WIDTH - 1) / WIDTH;
+    if( (GLint64)ROWS_PER_SAMPLE * NUM_SAMPLES > maxTextureSize ) {
+        fprintf(stderr, "[ERROR]: Vertex animation texture of %d x %d exceeds GL_MAX_TEXTURE_SIZE of %d, lower the sample rate\n",
+                WIDTH, ROWS_PER_SAMPLE * NUM_SAMPLES, maxTextureSize);
+        return false;
+    }
+
+    _numVertices = NUM_VERTICES;
+    _numSamples = NUM_SAMPLES;
+    _sampleRate = SAMPLE_RATE;
+    _textureWidth = WIDTH;
+    _rowsPerSample = ROWS_PER_SAMPLE;
+
+    // positions need full precision, normals are fine at half
+    _positionTexture = _uploadSamples(positions, WIDTH, ROWS_PER_SAMPLE, NUM_VERTICES, NUM_SAMPLES, GL_RGB32F);
+    _normalTexture = _uploadSamples(normals, WIDTH, ROWS_PER_SAMPLE, NUM_VERTICES, NUM_SAMPLES, GL_RGB16F);
+
+    MODEL.getMeshTopology(_texCoords, _indices, _meshIndexOffsets, _diffuseTextures);
+
+    if( sDEBUG ) printf("[INFO]: Baked vertex animation texture %d x %d (%d vertices, %d samples)\n",
+           WIDTH, ROWS_PER_SAMPLE * NUM_SAMPLES, NUM_VERTICES, NUM_SAMPLES);
+
+    return true;
+}
+
+inline GLuint
+CSCI441::VertexAnimationTexture::_uploadSamples(
+        const std::vector<glm::vec3>& SAMPLES,
+        const GLint WIDTH,
+        const GLint ROWS_PER_SAMPLE,
+        const GLint NUM_VERTICES,
+        const GLint NUM_SAMPLES,
+        const GLint internalFormat
+) {
+    // pad each sample out to a whole number of rows
+    std::vector<glm::vec3> texels( (size_t)WIDTH * ROWS_PER_SAMPLE * NUM_SAMPLES, glm::vec3(0.0f, 0.0f, 0.0f) );
+    for(GLint s = 0; s < NUM_SAMPLES; ++s) {
+        std::copy( SAMPLES.begin() + (ptrdiff_t)s * NUM_VERTICES,
+                   SAMPLES.begin() + (ptrdiff_t)(s + 1) * NUM_VERTICES,
+                   texels.begin() + (ptrdiff_t)s * WIDTH * ROWS_PER_SAMPLE );
+    }
+
+    GLuint texHandle;
+    glGenTextures(1, &texHandle);
+    glBindTexture(GL_TEXTURE_2D, texHandle);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, WIDTH, ROWS_PER_SAMPLE * NUM_SAMPLES, 0, GL_RGB, GL_FLOAT, texels.data());
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    return texHandle;
+}
+
+[[maybe_unused]]
+inline void
+CSCI441::VertexAnimationTexture::allocVertexArrays(
+        const GLint vTexCoordAttribLoc,
+        const GLint iPositionHeadingAttribLoc,
+        const GLint iPhaseSpeedAttribLoc
+) {
+    _freeVertexArrays();
+
+    glGenVertexArrays(1, &_vao);
+    glBindVertexArray(_vao);
+
+    // per vertex - positions come from the texture so only texture coordinates are stored
+    glGenBuffers(1, &_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(sizeof(glm::vec2) * _texCoords.size()), _texCoords.data(), GL_STATIC_DRAW);
+    if( vTexCoordAttribLoc >= 0 ) {
+        glEnableVertexAttribArray(vTexCoordAttribLoc);
+        glVertexAttribPointer(vTexCoordAttribLoc, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    }
+
+    glGenBuffers(1, &_ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)(sizeof(GLuint) * _indices.size()), _indices.data(), GL_STATIC_DRAW);
+
+    // per instance
+    glGenBuffers(1, &_instanceVBO);
+    glBindBuffer(GL_ARRAY_BUFFER, _instanceVBO);
+    if( iPositionHeadingAttribLoc >= 0 ) {
+        glEnableVertexAttribArray(iPositionHeadingAttribLoc);
+        glVertexAttribPointer(iPositionHeadingAttribLoc, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)offsetof(Instance, positionHeading));
+        glVertexAttribDivisor(iPositionHeadingAttribLoc, 1);
+    }
+    if( iPhaseSpeedAttribLoc >= 0 ) {
+        glEnableVertexAttribArray(iPhaseSpeedAttribLoc);
+        glVertexAttribPointer(iPhaseSpeedAttribLoc, 2, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)offsetof(Instance, phaseSpeed));
+        glVertexAttribDivisor(iPhaseSpeedAttribLoc, 1);
+    }
+
+    glBindVertexArray(0);
+}
+
+[[maybe_unused]]
+inline void
+CSCI441::VertexAnimationTexture::setInstances(
+        const GLsizei NUM_INSTANCES,
+        const Instance* pINSTANCES
+) {
+    if( _instanceVBO == 0 ) {
+        fprintf(stderr, "[ERROR]: VertexAnimationTexture::allocVertexArrays() must be called before setInstances()\n");
+        return;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, _instanceVBO);
+    if( NUM_INSTANCES > _instanceCapacity ) {
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(sizeof(Instance) * NUM_INSTANCES), pINSTANCES, GL_DYNAMIC_DRAW);
+        _instanceCapacity = NUM_INSTANCES;
+    } else if( NUM_INSTANCES > 0 ) {
+        glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr)(sizeof(Instance) * NUM_INSTANCES), pINSTANCES);
+    }
+    _numInstances = NUM_INSTANCES;
+}
+
+[[maybe_unused]]
+inline void
+CSCI441::VertexAnimationTexture::draw() const
+{
+    if( _vao == 0 || _numInstances == 0 ) return;
+
+    glActiveTexture(GL_TEXTURE0 + POSITION_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _positionTexture);
+    glActiveTexture(GL_TEXTURE0 + NORMAL_TEXTURE_UNIT);
+    glBindTexture(GL_TEXTURE_2D, _normalTexture);
+    glActiveTexture(GL_TEXTURE0 + DIFFUSE_TEXTURE_UNIT);
+
+    glBindVertexArray(_vao);
+    for(size_t i = 0; i + 1 < _meshIndexOffsets.size(); ++i) {
+        glBindTexture(GL_TEXTURE_2D, _diffuseTextures[i]);
+        glDrawElementsInstanced(GL_TRIANGLES,
+                                _meshIndexOffsets[i + 1] - _meshIndexOffsets[i],
+                                GL_UNSIGNED_INT,
+                                (void*)(sizeof(GLuint) * _meshIndexOffsets[i]),
+                                _numInstances);
+    }
+    glBindVertexArray(0);
+}
+
+inline void
+CSCI441::VertexAnimationTexture::_freeTextures()
+{
+    glDeleteTextures(1, &_positionTexture);
+    glDeleteTextures(1, &_normalTexture);
+    _positionTexture = 0;
+    _normalTexture = 0;
+    _numVertices = 0;
+    _numSamples = 0;
+}
+
+inline void
+CSCI441::VertexAnimationTexture::_freeVertexArrays()
+{
+    glDeleteVertexArrays(1, &_vao);
+    glDeleteBuffers(1, &_vbo);
+    glDeleteBuffers(1, &_ibo);
+    glDeleteBuffers(1, &_instanceVBO);
+    _vao = _vbo = _ibo = _instanceVBO = 0;
+    _numInstances = 0;
+    _instanceCapacity = 0;
+}
+
+#endif // CSCI441_VERTEX_ANIMATION_TEXTURE_HPP
@@ -44,6 +44,21 @@ namespace CSCI441 {
      */
     void setVertexAttributeLocations( GLint positionLocation, GLint normalLocation = -1, GLint texCoordLocation = -1 );
 
+    /**
+     * @brief Sets how many instances of each object the draw functions submit
+     * @param instanceCount number of instances per draw call, 1 draws a single object
+     * @note The shader distinguishes the instances through gl_InstanceID.  The count stays in
+     * effect for every following draw until it is set again.  The teapot always draws one instance.
+     * @pre instanceCount must be greater than zero
+     */
+    [[maybe_unused]] void setDrawInstanceCount( GLsizei instanceCount );
+
+    /**
+     * @brief Returns how many instances of each object the draw functions submit
+     * @return instance count set by setDrawInstanceCount(), 1 by default
+     */
+    [[maybe_unused]] [[nodiscard]] GLsizei getDrawInstanceCount();
+
     /**
      * @brief deletes the VAOs stored for all object types
      */
@@ -356,6 +371,7 @@ namespace CSCI441_INTERNAL {
     inline GLint _positionAttributeLocation = -1;
     inline GLint _normalAttributeLocation = -1;
     inline GLint _texCoordAttributeLocation = -1;
+    inline GLsizei _instanceCount = 1;
 
     void generateCubeVAOFlat( GLfloat sideLength );
     void generateCubeVAOIndexed( GLfloat sideLength );
@@ -502,6 +518,18 @@ inline void CSCI441::setVertexAttributeLocations( GLint positionLocation, GLint
     CSCI441_INTERNAL::setTeapotAttributeLocations(positionLocation, normalLocation, texCoordLocation);
 }
 
+[[maybe_unused]]
+inline void CSCI441::setDrawInstanceCount( GLsizei instanceCount ) {
+    assert( instanceCount > 0 );
+
+    CSCI441_INTERNAL::_instanceCount = instanceCount;
+}
+
+[[maybe_unused]]
+inline GLsizei CSCI441::getDrawInstanceCount() {
+    return CSCI441_INTERNAL::_instanceCount;
+}
+
 [[maybe_unused]]
 inline void CSCI441::deleteObjectVAOs() {
     CSCI441_INTERNAL::deleteObjectVAOs();
@@ -796,7 +824,7 @@ inline void CSCI441_INTERNAL::drawCubeFlat( GLfloat sideLength, GLenum renderMod
         glVertexAttribPointer( CSCI441_INTERNAL::_texCoordAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, (void*)(sizeof(glm::vec3) * NUM_VERTICES * 2) );
     }
 
-    glDrawArrays( GL_TRIANGLES, 0, 36 );
+    glDrawArraysInstanced( GL_TRIANGLES, 0, 36, CSCI441_INTERNAL::_instanceCount );
 
     glPolygonMode( GL_FRONT, currentPolygonMode[0] );
     glPolygonMode( GL_BACK, currentPolygonMode[1] );
@@ -828,7 +856,7 @@ inline void CSCI441_INTERNAL::drawCubeIndexed( GLfloat sideLength, GLenum render
         glVertexAttribPointer( CSCI441_INTERNAL::_texCoordAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, (void*)(sizeof(glm::vec3) * NUM_VERTICES * 2) );
     }
 
-    glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, (void*)nullptr);
+    glDrawElementsInstanced(GL_TRIANGLES, 36, GL_UNSIGNED_SHORT, (void*)nullptr, CSCI441_INTERNAL::_instanceCount);
 
     glPolygonMode( GL_FRONT, currentPolygonMode[0] );
     glPolygonMode( GL_BACK, currentPolygonMode[1] );
@@ -862,7 +890,7 @@ inline void CSCI441_INTERNAL::drawCylinder( GLfloat base, GLfloat top, GLfloat h
     }
 
     for(GLuint stackNum = 0; stackNum < stacks; stackNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+1)*2*stackNum), static_cast<GLint>((slices+1)*2) );
+        glDrawArraysInstanced( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+1)*2*stackNum), static_cast<GLint>((slices+1)*2), CSCI441_INTERNAL::_instanceCount );
     }
 
     glPolygonMode( GL_FRONT, currentPolygonMode[0] );
@@ -897,7 +925,7 @@ inline void CSCI441_INTERNAL::drawPartialDisk(GLfloat innerRadius, GLfloat outer
     }
 
     for(GLuint ringNum = 0; ringNum < rings; ringNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+1)*2*ringNum), static_cast<GLint>((slices+1)*2) );
+        glDrawArraysInstanced( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+1)*2*ringNum), static_cast<GLint>((slices+1)*2), CSCI441_INTERNAL::_instanceCount );
     }
 
     glPolygonMode( GL_FRONT, currentPolygonMode[0] );
@@ -931,13 +959,13 @@ inline void CSCI441_INTERNAL::drawSphere( GLfloat radius, GLuint stacks, GLuint
         glVertexAttribPointer( CSCI441_INTERNAL::_texCoordAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, (void*)(sizeof(glm::vec3) * NUM_VERTICES * 2) );
     }
 
-    glDrawArrays( GL_TRIANGLE_FAN, 0, static_cast<GLint>(slices+2) );
+    glDrawArraysInstanced( GL_TRIANGLE_FAN, 0, static_cast<GLint>(slices+2), CSCI441_INTERNAL::_instanceCount );
 
     for(GLuint stackNum = 1; stackNum < stacks-1; stackNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>((slices+1)*2) );
+        glDrawArraysInstanced( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>((slices+1)*2), CSCI441_INTERNAL::_instanceCount );
     }
 
-    glDrawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2) + (stacks-2)*(slices+1)*2), static_cast<GLint>(slices+2) );
+    glDrawArraysInstanced( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2) + (stacks-2)*(slices+1)*2), static_cast<GLint>(slices+2), CSCI441_INTERNAL::_instanceCount );
 
     glPolygonMode( GL_FRONT, currentPolygonMode[0] );
     glPolygonMode( GL_BACK, currentPolygonMode[1] );
@@ -970,13 +998,13 @@ inline void CSCI441_INTERNAL::drawHalfSphere( GLfloat radius, GLuint stacks, GLu
         glVertexAttribPointer( CSCI441_INTERNAL::_texCoordAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, (void*)(sizeof(glm::vec3) * NUM_VERTICES * 2) );
     }
 
-    glDrawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2)/2), static_cast<GLint>((slices+2)/2) );
+    glDrawArraysInstanced( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2)/2), static_cast<GLint>((slices+2)/2), CSCI441_INTERNAL::_instanceCount );
 
     for(GLuint stackNum = 1; stackNum < stacks-1; stackNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>(slices+2) );
+        glDrawArraysInstanced( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>(slices+2), CSCI441_INTERNAL::_instanceCount );
     }
 
-    glDrawArrays( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2) + (stacks-2)*(slices+1)*2), static_cast<GLint>((slices+2)/2) );
+    glDrawArraysInstanced( GL_TRIANGLE_FAN, static_cast<GLint>((slices+2) + (stacks-2)*(slices+1)*2), static_cast<GLint>((slices+2)/2), CSCI441_INTERNAL::_instanceCount );
 
     glPolygonMode( GL_FRONT, currentPolygonMode[0] );
     glPolygonMode( GL_BACK, currentPolygonMode[1] );
@@ -1011,10 +1039,10 @@ inline void CSCI441_INTERNAL::drawDome( GLfloat radius, GLuint stacks, GLuint sl
         glVertexAttribPointer( CSCI441_INTERNAL::_texCoordAttributeLocation, 2, GL_FLOAT, GL_FALSE, 0, (void*)(sizeof(glm::vec3) * NUM_VERTICES * 2) );
     }
 
-    glDrawArrays( GL_TRIANGLE_FAN, 0, static_cast<GLint>(slices+2) );
+    glDrawArraysInstanced( GL_TRIANGLE_FAN, 0, static_cast<GLint>(slices+2), CSCI441_INTERNAL::_instanceCount );
 
     for(GLuint stackNum = (stacks-1)/2; stackNum < stacks-1; stackNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>((slices+1)*2) );
+        glDrawArraysInstanced( GL_TRIANGLE_STRIP, static_cast<GLint>((slices+2) + (stackNum-1)*((slices+1)*2)), static_cast<GLint>((slices+1)*2), CSCI441_INTERNAL::_instanceCount );
     }
 
     glPolygonMode( GL_FRONT, currentPolygonMode[0] );
@@ -1049,7 +1077,7 @@ inline void CSCI441_INTERNAL::drawTorus( GLfloat innerRadius, GLfloat outerRadiu
     }
 
     for(GLuint ringNum = 0; ringNum < rings; ringNum++) {
-        glDrawArrays( GL_TRIANGLE_STRIP, static_cast<GLint>(ringNum*sides*4), static_cast<GLint>(sides*4) );
+        glDrawArraysInstanced( GL_TRIANGLE_STRIP, static_cast<GLint>(ringNum*sides*4), static_cast<GLint>(sides*4), CSCI441_INTERNAL::_instanceCount );
     }
 
     glPolygonMode( GL_FRONT, currentPolygonMode[0] );
@@ -23,6 +23,8 @@
     #include <glad/gl.h>
 #endif
 
+#include <glm/glm.hpp>
+
 #include <cstdio>
 #include <cstdlib>
 #include <cmath>
@@ -1,4 +1,4 @@
-#include "ArcballCam.h"
+#include "Arcballcam.h"
 #include <glm/gtc/type_ptr.hpp>
 #include <cmath>
 
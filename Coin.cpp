@@ -1,54 +1,18 @@
 #include "Coin.h"
 
 #include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
 
-#include <objects.hpp>
-#include <OpenGLUtils.hpp>
-
-Coin::Coin(GLuint shaderProgramHandle, GLint mvpMtxUniformLocation, GLint normalMtxUniformLocation)
-    : _shaderProgramHandle(shaderProgramHandle),
-    _isActive(true){
-
-    _shaderProgramUniformLocations.mvpMtx = mvpMtxUniformLocation;
-    _shaderProgramUniformLocations.normalMtx = normalMtxUniformLocation;
-
-    _shaderProgramUniformLocations.materialAmbientColor  = glGetUniformLocation(_shaderProgramHandle, "materialAmbientColor");
-    _shaderProgramUniformLocations.materialDiffuseColor  = glGetUniformLocation(_shaderProgramHandle, "materialDiffuseColor");
-    _shaderProgramUniformLocations.materialSpecularColor = glGetUniformLocation(_shaderProgramHandle, "materialSpecularColor");
-    _shaderProgramUniformLocations.materialShininess     = glGetUniformLocation(_shaderProgramHandle, "materialShininess");
+Coin::Coin()
+    : _isActive(true){
 
     _colorBody = glm::vec3(1.0f, 0.84f, 0.0f); // Color dorado
     _scaleBody = glm::vec3(1.0f);  // Ajusta el tamaño según tus necesidades
 }
 
-void Coin::drawCoin(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) {
+void Coin::emitDrawItems(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 coinMtx = modelMtx;
     coinMtx = glm::scale(coinMtx, _scaleBody);
 
-    _computeAndSendMatrixUniforms(coinMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorBody, 32.0f);
-
     // Dibujar una esfera para representar la moneda
-    CSCI441::drawSolidSphere(1.0f, 20, 20);
-}
-
-void Coin::_computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
-    glm::mat4 mvpMtx = projMtx * viewMtx * modelMtx;
-    glProgramUniformMatrix4fv(_shaderProgramHandle, _shaderProgramUniformLocations.mvpMtx, 1, GL_FALSE, glm::value_ptr(mvpMtx));
-
-    glm::mat3 normalMtx = glm::mat3(glm::transpose(glm::inverse(modelMtx)));
-    glProgramUniformMatrix3fv(_shaderProgramHandle, _shaderProgramUniformLocations.normalMtx, 1, GL_FALSE, glm::value_ptr(normalMtx));
-}
-
-void Coin::_setMaterialColors(glm::vec3 color, float shininess) const {
-    glm::vec3 ambientColor  = color * 0.2f;
-    glm::vec3 diffuseColor  = color;
-    glm::vec3 specularColor = glm::vec3(0.5f);
-
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialAmbientColor, 1, glm::value_ptr(ambientColor));
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialDiffuseColor, 1, glm::value_ptr(diffuseColor));
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialSpecularColor, 1, glm::value_ptr(specularColor));
-    glProgramUniform1f(_shaderProgramHandle, _shaderProgramUniformLocations.materialShininess, shininess);
+    drawItems.push_back(DrawItem::make(DrawMesh::SPHERE, coinMtx, _colorBody, 32.0f));
 }
@@ -1,15 +1,18 @@
 #ifndef COIN_H
 #define COIN_H
 
-#include <glad/gl.h>
+#include "Render/FramePacket.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
 
+#include <vector>
+
 class Coin {
 public:
- Coin(GLuint shaderProgramHandle, GLint mvpMtxUniformLocation, GLint normalMtxUniformLocation);
+ Coin();
 
- void drawCoin(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx);
+ // Agrega la moneda al paquete del frame
+ void emitDrawItems(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const;
 
 
  void deactivate() { _isActive = false; }
@@ -18,21 +21,9 @@ public:
 
 private:
  bool _isActive;
- GLuint _shaderProgramHandle;
- struct ShaderProgramUniformLocations {
-  GLint mvpMtx;
-  GLint normalMtx;
-  GLint materialAmbientColor;
-  GLint materialDiffuseColor;
-  GLint materialSpecularColor;
-  GLint materialShininess;
- } _shaderProgramUniformLocations;
 
  glm::vec3 _colorBody;
  glm::vec3 _scaleBody;
-
- void _computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
- void _setMaterialColors(glm::vec3 color, float shininess) const;
 };
 
 #endif // COIN_H
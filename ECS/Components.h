@@ -0,0 +1,48 @@
+#ifndef ECS_COMPONENTS_H
+#define ECS_COMPONENTS_H
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+
+/*
+ *  Componentes de datos compartidos por varios sistemas. Los modelos (Aaron_Inti, Coin,
+ *  Zombie) también se guardan como componentes, tal cual.
+ */
+namespace ECS {
+
+    /**
+     * @brief Posición y orientación alrededor de Y.
+     */
+    struct Transform {
+        glm::vec3 position = glm::vec3(0.0f);
+        float heading = 0.0f;
+    };
+
+    /**
+     * @brief Objeto que pertenece a un tile del mundo y se descarga con él.
+     */
+    struct TileSlot {
+        int tileX = 0, tileZ = 0;
+        int slot = 0;                       // número del objeto dentro de su tile
+    };
+
+    /**
+     * @brief Copia del modelo cargado del modo de estrés (StressScene).
+     */
+    struct ModelInstance {
+        glm::vec3 color = glm::vec3(1.0f);
+    };
+
+    /**
+     * @brief Estado del nivel de detalle de la IA de un agente.
+     */
+    struct AgentSchedule {
+        uint32_t phase = 0;                 // reparte los turnos dentro de su grupo
+        float pendingTime = 0.0f;           // tiempo acumulado mientras espera su turno
+        uint8_t group = 0;                  // AgentUpdateScheduler::Group de este tick
+        float timeStep = 0.0f;              // tiempo a simular en este tick; 0 si no le toca
+    };
+}
+
+#endif // ECS_COMPONENTS_H
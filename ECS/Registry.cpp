@@ -0,0 +1,192 @@
+#include "Registry.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+namespace ECS {
+
+    namespace {
+        void* allocateColumn(const detail::ComponentInfo& info, size_t capacity) {
+            return ::operator new(info.size * capacity, std::align_val_t(info.alignment));
+        }
+
+        void freeColumn(const detail::ComponentInfo& info, void* data) {
+            ::operator delete(data, std::align_val_t(info.alignment));
+        }
+    }
+
+    uint32_t detail::nextComponentId() {
+        static std::atomic<uint32_t> nextId{0};
+        const uint32_t id = nextId.fetch_add(1);
+        if (id >= MAX_COMPONENT_TYPES) {
+            fprintf(stderr, "[ERROR]: More than %u ECS component types\n", MAX_COMPONENT_TYPES);
+            std::abort();
+        }
+        return id;
+    }
+
+    Registry::~Registry() {
+        clear();
+        for (const std::unique_ptr<Archetype>& archetype : _archetypes) {
+            for (const Column& column : archetype->columns) {
+                if (column.data != nullptr) freeColumn(*column.info, column.data);
+            }
+        }
+    }
+
+    void Registry::destroy(Entity entity) {
+        _checkAlive(entity, "destroy");
+        if (!isAlive(entity)) return;
+
+        Record& record = _records[entity.index];
+        Archetype& archetype = *_archetypes[record.archetype];
+        const uint32_t row = record.row;
+        const uint32_t lastRow = static_cast<uint32_t>(archetype.entities.size() - 1);
+
+        // La última fila ocupa el hueco para que la tabla siga contigua
+        for (const Column& column : archetype.columns) {
+            if (column.info->trivial) {
+                if (row != lastRow) memcpy(column.at(row), column.at(lastRow), column.info->size);
+                continue;
+            }
+            column.info->destroy(column.at(row));
+            if (row != lastRow) {
+                column.info->moveConstruct(column.at(row), column.at(lastRow));
+                column.info->destroy(column.at(lastRow));
+            }
+        }
+        if (row != lastRow) {
+            const Entity moved = archetype.entities[lastRow];
+            archetype.entities[row] = moved;
+            _records[moved.index].row = row;
+        }
+        archetype.entities.pop_back();
+
+        // El índice vuelve con otra generación: las referencias viejas quedan inválidas
+        record.archetype = UINT32_MAX;
+        ++record.generation;
+        _freeIndices.push_back(entity.index);
+        --_numEntities;
+    }
+
+    void Registry::clear() {
+        for (const std::unique_ptr<Archetype>& archetype : _archetypes) {
+            for (const Column& column : archetype->columns) {
+                if (column.info->trivial) continue;
+                for (size_t row = 0; row < archetype->entities.size(); ++row) {
+                    column.info->destroy(column.at(row));
+                }
+            }
+            for (const Entity& entity : archetype->entities) {
+                _records[entity.index].archetype = UINT32_MAX;
+                ++_records[entity.index].generation;
+                _freeIndices.push_back(entity.index);
+            }
+            archetype->entities.clear();
+        }
+        _numEntities = 0;
+    }
+
+    void Registry::_reportStaleEntity(Entity entity, const char* operation) const {
+        if (entity.index < _records.size()) {
+            fprintf(stderr, "[ERROR]: ECS %s() on a destroyed entity (index %u, generation %u, current generation %u)\n",
+                    operation, entity.index, entity.generation, _records[entity.index].generation);
+        } else {
+            fprintf(stderr, "[ERROR]: ECS %s() on an entity that was never created (index %u)\n", operation, entity.index);
+        }
+        std::abort();
+    }
+
+    void Registry::_reserveEntities(size_t count) {
+        // Los índices libres cubren parte; el resto serán registros nuevos
+        if (count > _freeIndices.size()) {
+            _records.reserve(_records.size() + count - _freeIndices.size());
+        }
+        _freeIndices.reserve(_records.capacity());
+    }
+
+    uint32_t Registry::_findOrCreateArchetype(const detail::ComponentInfo* const* infos, size_t numComponents) {
+        uint64_t mask = 0;
+        for (size_t i = 0; i < numComponents; ++i) {
+            mask |= uint64_t(1) << infos[i]->id;
+        }
+
+        const auto found = _archetypeByMask.find(mask);
+        if (found != _archetypeByMask.end()) return found->second;
+
+        // Un tipo repetido deja menos bits que componentes
+        if (std::bitset<MAX_COMPONENT_TYPES>(mask).count() != numComponents) {
+            fprintf(stderr, "[ERROR]: ECS entity created with the same component type twice\n");
+            std::abort();
+        }
+
+        // Columnas ordenadas por tipo, sin importar el orden en que se pasaron los componentes
+        std::unique_ptr<Archetype> archetype(new Archetype());
+        archetype->mask = mask;
+        std::fill(std::begin(archetype->columnOf), std::end(archetype->columnOf), static_cast<int8_t>(-1));
+        for (size_t i = 0; i < numComponents; ++i) {
+            archetype->columns.push_back({ infos[i], nullptr });
+        }
+        std::sort(archetype->columns.begin(), archetype->columns.end(),
+                  [](const Column& a, const Column& b) { return a.info->id < b.info->id; });
+        for (size_t i = 0; i < archetype->columns.size(); ++i) {
+            archetype->columnOf[archetype->columns[i].info->id] = static_cast<int8_t>(i);
+        }
+
+        const uint32_t index = static_cast<uint32_t>(_archetypes.size());
+        _archetypes.push_back(std::move(archetype));
+        _archetypeByMask.emplace(mask, index);
+        return index;
+    }
+
+    Entity Registry::_allocateEntity() {
+        Entity entity;
+        if (!_freeIndices.empty()) {
+            entity.index = _freeIndices.back();
+            _freeIndices.pop_back();
+        } else {
+            entity.index = static_cast<uint32_t>(_records.size());
+            _records.emplace_back();
+        }
+        entity.generation = _records[entity.index].generation;
+        ++_numEntities;
+        return entity;
+    }
+
+    uint32_t Registry::_appendRow(uint32_t archetypeIndex, Entity entity) {
+        Archetype& archetype = *_archetypes[archetypeIndex];
+        if (archetype.entities.size() == archetype.capacity) {
+            _reserve(archetype, std::max<size_t>(archetype.capacity * 2, 16));
+        }
+        const uint32_t row = static_cast<uint32_t>(archetype.entities.size());
+        archetype.entities.push_back(entity);
+
+        Record& record = _records[entity.index];
+        record.archetype = archetypeIndex;
+        record.row = row;
+        return row;
+    }
+
+    void Registry::_reserve(Archetype& archetype, size_t capacity) {
+        for (Column& column : archetype.columns) {
+            void* data = allocateColumn(*column.info, capacity);
+            if (column.info->trivial) {
+                if (!archetype.entities.empty()) memcpy(data, column.data, archetype.entities.size() * column.info->size);
+            } else {
+                for (size_t row = 0; row < archetype.entities.size(); ++row) {
+                    void* destination = static_cast<std::byte*>(data) + row * column.info->size;
+                    column.info->moveConstruct(destination, column.at(row));
+                    column.info->destroy(column.at(row));
+                }
+            }
+            if (column.data != nullptr) freeColumn(*column.info, column.data);
+            column.data = data;
+        }
+        archetype.entities.reserve(capacity);
+        archetype.capacity = capacity;
+    }
+}
@@ -0,0 +1,281 @@
+#ifndef ECS_REGISTRY_H
+#define ECS_REGISTRY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ECS {
+
+    /**
+     * @brief Referencia a una entidad. Al destruirla su índice se reutiliza con otra
+     * generación, así que las referencias viejas dejan de ser válidas en lugar de apuntar a otra
+     * entidad.
+     */
+    struct Entity {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
+
+        bool isValid() const { return index != UINT32_MAX; }
+        bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+        bool operator!=(const Entity& other) const { return !(*this == other); }
+    };
+
+    // Máximo de tipos de componente distintos en todo el programa
+    constexpr uint32_t MAX_COMPONENT_TYPES = 64;
+
+    namespace detail {
+        /**
+         * @brief Cómo mover y destruir un componente sin conocer su tipo.
+         */
+        struct ComponentInfo {
+            uint32_t id;
+            size_t size;
+            size_t alignment;
+            bool trivial;                   // se mueve con memcpy y no hace falta destruirlo
+            void (*moveConstruct)(void* destination, void* source);
+            void (*destroy)(void* component);
+        };
+
+        uint32_t nextComponentId();
+
+        template<typename C>
+        const ComponentInfo& componentInfo() {
+            static const ComponentInfo INFO = {
+                nextComponentId(), sizeof(C), alignof(C),
+                std::is_trivially_copyable_v<C> && std::is_trivially_destructible_v<C>,
+                [](void* destination, void* source) { new (destination) C(std::move(*static_cast<C*>(source))); },
+                [](void* component) { static_cast<C*>(component)->~C(); }
+            };
+            return INFO;
+        }
+
+        template<typename C>
+        uint32_t componentId() { return componentInfo<C>().id; }
+    }
+
+    /**
+     * @class Registry
+     * @brief Entidades agrupadas por arquetipo: todas las que tienen exactamente los mismos
+     * tipos de componente comparten una tabla con un arreglo contiguo por tipo.
+     *
+     * each() recorre solo las tablas que tienen los componentes pedidos y, dentro de cada una,
+     * los arreglos en orden, así que un sistema lee la memoria de corrido. Destruir una entidad
+     * mueve la última fila de su tabla a su lugar, así que las tablas nunca tienen huecos.
+     *
+     * Las tablas nunca se achican: las filas que deja una entidad destruida las reutiliza la
+     * siguiente del mismo arquetipo, así que crear y destruir en ráfagas no pasa por el
+     * allocator una vez que la tabla alcanzó su tamaño (o después de reserve()).
+     *
+     * Usar una entidad ya destruida en get() o destroy() es un error: en debug se reporta y el
+     * programa aborta; en release get() devuelve nullptr y destroy() no hace nada. isAlive()
+     * es la forma de preguntar.
+     *
+     * No es seguro para varios hilos; tampoco se puede crear ni destruir entidades durante un
+     * each().
+     */
+    class Registry {
+    public:
+        Registry() = default;
+        ~Registry();
+
+        Registry(const Registry&) = delete;
+        Registry& operator=(const Registry&) = delete;
+
+        /**
+         * @brief Crea una entidad con los componentes dados; cada tipo a lo sumo una vez.
+         */
+        template<typename... Cs>
+        Entity create(Cs&&... components);
+
+        /**
+         * @brief Deja lugar para count entidades con exactamente los componentes Cs, de modo que
+         * crearlas no reserve memoria.
+         */
+        template<typename... Cs>
+        void reserve(size_t count);
+
+        /**
+         * @brief Destruye la entidad y sus componentes.
+         */
+        void destroy(Entity entity);
+
+        bool isAlive(Entity entity) const {
+            return entity.index < _records.size() && _records[entity.index].generation == entity.generation
+                && _records[entity.index].archetype != UINT32_MAX;
+        }
+
+        /**
+         * @brief Componente de una entidad; nullptr si no tiene ese componente.
+         */
+        template<typename C>
+        C* get(Entity entity);
+
+        template<typename C>
+        const C* get(Entity entity) const { return const_cast<Registry*>(this)->get<C>(entity); }
+
+        /**
+         * @brief Llama a function(Cs&...) o function(Entity, Cs&...) para cada entidad que
+         * tenga todos los componentes Cs.
+         */
+        template<typename... Cs, typename F>
+        void each(F&& function);
+
+        template<typename... Cs, typename F>
+        void each(F&& function) const { const_cast<Registry*>(this)->each<Cs...>(std::forward<F>(function)); }
+
+        /**
+         * @brief Número de entidades con todos los componentes Cs.
+         */
+        template<typename... Cs>
+        size_t count() const;
+
+        /**
+         * @brief Destruye todas las entidades.
+         */
+        void clear();
+
+        size_t getNumEntities() const { return _numEntities; }
+        size_t getNumArchetypes() const { return _archetypes.size(); }
+
+    private:
+        // Arreglo contiguo de un tipo de componente dentro de un arquetipo
+        struct Column {
+            const detail::ComponentInfo* info;
+            void* data = nullptr;
+
+            void* at(size_t row) const { return static_cast<std::byte*>(data) + row * info->size; }
+        };
+
+        struct Archetype {
+            uint64_t mask = 0;                              // un bit por tipo de componente
+            std::vector<Column> columns;
+            int8_t columnOf[MAX_COMPONENT_TYPES];           // columna de cada tipo; -1 si no está
+            std::vector<Entity> entities;                   // la entidad de cada fila
+            size_t capacity = 0;
+        };
+
+        // Dónde vive cada entidad; archetype == UINT32_MAX si el índice está libre
+        struct Record {
+            uint32_t generation = 0;
+            uint32_t archetype = UINT32_MAX;
+            uint32_t row = 0;
+        };
+
+        template<typename... Cs>
+        static uint64_t _maskOf() { return (uint64_t(0) | ... | (uint64_t(1) << detail::componentId<Cs>())); }
+
+        template<typename... Cs, typename F>
+        static void _eachIn(Archetype& archetype, F& function);
+
+        // En debug, aborta si la entidad ya no existe
+        void _checkAlive(Entity entity, const char* operation) const {
+#ifndef NDEBUG
+            if (!isAlive(entity)) _reportStaleEntity(entity, operation);
+#else
+            (void)entity;
+            (void)operation;
+#endif
+        }
+        [[noreturn]] void _reportStaleEntity(Entity entity, const char* operation) const;
+        void _reserveEntities(size_t count);
+
+        uint32_t _findOrCreateArchetype(const detail::ComponentInfo* const* infos, size_t numComponents);
+        Entity _allocateEntity();
+        uint32_t _appendRow(uint32_t archetypeIndex, Entity entity);
+        static void _reserve(Archetype& archetype, size_t capacity);
+
+        std::vector<std::unique_ptr<Archetype>> _archetypes;
+        std::unordered_map<uint64_t, uint32_t> _archetypeByMask;
+        std::vector<Record> _records;
+        std::vector<uint32_t> _freeIndices;
+        size_t _numEntities = 0;
+        uint64_t _lastCreatedMask = 0;                  // ninguna entidad tiene máscara 0
+        uint32_t _lastCreatedArchetype = 0;
+    };
+
+    template<typename... Cs>
+    Entity Registry::create(Cs&&... components) {
+        static_assert(sizeof...(Cs) > 0, "An entity needs at least one component");
+        const detail::ComponentInfo* infos[] = { &detail::componentInfo<std::decay_t<Cs>>()... };
+        uint64_t mask = 0;
+        for (const detail::ComponentInfo* info : infos) {
+            mask |= uint64_t(1) << info->id;
+        }
+        // Las oleadas crean muchas entidades seguidas del mismo arquetipo
+        if (mask != _lastCreatedMask) {
+            _lastCreatedArchetype = _findOrCreateArchetype(infos, sizeof...(Cs));
+            _lastCreatedMask = mask;
+        }
+        const uint32_t archetypeIndex = _lastCreatedArchetype;
+        Archetype& archetype = *_archetypes[archetypeIndex];
+
+        const Entity entity = _allocateEntity();
+        const uint32_t row = _appendRow(archetypeIndex, entity);
+        size_t component = 0;
+        (new (archetype.columns[archetype.columnOf[infos[component++]->id]].at(row))
+             std::decay_t<Cs>(std::forward<Cs>(components)), ...);
+        return entity;
+    }
+
+    template<typename... Cs>
+    void Registry::reserve(size_t count) {
+        static_assert(sizeof...(Cs) > 0, "An entity needs at least one component");
+        const detail::ComponentInfo* infos[] = { &detail::componentInfo<Cs>()... };
+        Archetype& archetype = *_archetypes[_findOrCreateArchetype(infos, sizeof...(Cs))];
+        if (count > archetype.capacity) _reserve(archetype, count);
+        _reserveEntities(count);
+    }
+
+    template<typename C>
+    C* Registry::get(Entity entity) {
+        _checkAlive(entity, "get");
+        if (!isAlive(entity)) return nullptr;
+        const Record& record = _records[entity.index];
+        const Archetype& archetype = *_archetypes[record.archetype];
+        const int column = archetype.columnOf[detail::componentId<C>()];
+        if (column < 0) return nullptr;
+        return static_cast<C*>(archetype.columns[static_cast<size_t>(column)].at(record.row));
+    }
+
+    template<typename... Cs, typename F>
+    void Registry::each(F&& function) {
+        const uint64_t required = _maskOf<Cs...>();
+        for (const std::unique_ptr<Archetype>& archetype : _archetypes) {
+            if ((archetype->mask & required) == required && !archetype->entities.empty()) {
+                _eachIn<Cs...>(*archetype, function);
+            }
+        }
+    }
+
+    template<typename... Cs, typename F>
+    void Registry::_eachIn(Archetype& archetype, F& function) {
+        const std::tuple<Cs*...> columns(static_cast<Cs*>(archetype.columns[archetype.columnOf[detail::componentId<Cs>()]].data)...);
+        const size_t numRows = archetype.entities.size();
+        for (size_t row = 0; row < numRows; ++row) {
+            if constexpr (std::is_invocable_v<F&, Entity, Cs&...>) {
+                function(archetype.entities[row], std::get<Cs*>(columns)[row]...);
+            } else {
+                function(std::get<Cs*>(columns)[row]...);
+            }
+        }
+    }
+
+    template<typename... Cs>
+    size_t Registry::count() const {
+        const uint64_t required = _maskOf<Cs...>();
+        size_t total = 0;
+        for (const std::unique_ptr<Archetype>& archetype : _archetypes) {
+            if ((archetype->mask & required) == required) total += archetype->entities.size();
+        }
+        return total;
+    }
+}
+
+#endif // ECS_REGISTRY_H
@@ -0,0 +1,96 @@
+#include "AgentUpdateScheduler.h"
+
+#include <algorithm>
+#include <cstdio>
+
+void AgentUpdateScheduler::setSettings(const Settings& settings) {
+    _settings = settings;
+    _settings.farDistance = std::max(_settings.farDistance, _settings.nearDistance);
+    _settings.midInterval = std::max(_settings.midInterval, 1);
+    _settings.farInterval = std::max(_settings.farInterval, 1);
+    _settings.offscreenInterval = std::max(_settings.offscreenInterval, 1);
+    _settings.groupBudget = std::max(_settings.groupBudget, 1);
+}
+
+void AgentUpdateScheduler::beginTick(const glm::vec3& eyePosition, const glm::mat4& viewProjectionMatrix) {
+    // Cierra las estadísticas del tick anterior
+    if (_tickNumber > 0) {
+        ++_numTicks;
+        _totalAgents += _tick.getNumAgents();
+        _totalUpdated += _tick.getNumUpdated();
+        _maxUpdated = std::max(_maxUpdated, _tick.getNumUpdated());
+    }
+    ++_tickNumber;
+    _tick = TickStats();
+    _eyePosition = eyePosition;
+
+    // Planos del frustum a partir de las filas de la matriz, normalizados para medir distancias
+    const glm::mat4& m = viewProjectionMatrix;
+    const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+    const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+    const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+    const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+    _frustumPlanes[0] = row3 + row0;
+    _frustumPlanes[1] = row3 - row0;
+    _frustumPlanes[2] = row3 + row1;
+    _frustumPlanes[3] = row3 - row1;
+    _frustumPlanes[4] = row3 + row2;
+    _frustumPlanes[5] = row3 - row2;
+    for (glm::vec4& plane : _frustumPlanes) {
+        const float length = glm::length(glm::vec3(plane));
+        if (length > 0.0f) plane /= length;
+    }
+}
+
+AgentUpdateScheduler::Group AgentUpdateScheduler::classify(const glm::vec3& position) {
+    Group group = NEAR;
+    const glm::vec3 offset = position - _eyePosition;
+    const float distanceSquared = glm::dot(offset, offset);
+    if (distanceSquared > _settings.nearDistance * _settings.nearDistance) {
+        bool visible = true;
+        for (const glm::vec4& plane : _frustumPlanes) {
+            if (glm::dot(glm::vec3(plane), position) + plane.w < -_settings.boundingRadius) {
+                visible = false;
+                break;
+            }
+        }
+        if (!visible)                                                               group = OFFSCREEN;
+        else if (distanceSquared > _settings.farDistance * _settings.farDistance)   group = FAR;
+        else                                                                        group = MID;
+    }
+    ++_tick.agents[group];
+    return group;
+}
+
+void AgentUpdateScheduler::planTick() {
+    _tick.interval[NEAR] = 1;
+    _tick.interval[MID] = _settings.midInterval;
+    _tick.interval[FAR] = _settings.farInterval;
+    _tick.interval[OFFSCREEN] = _settings.offscreenInterval;
+
+    // Un grupo lejano numeroso espera más entre turnos en lugar de gastar más por tick
+    const uint32_t budget = static_cast<uint32_t>(_settings.groupBudget);
+    for (int group = MID; group < NUM_GROUPS; ++group) {
+        const int neededInterval = static_cast<int>((_tick.agents[group] + budget - 1) / budget);
+        _tick.interval[group] = std::max(_tick.interval[group], neededInterval);
+    }
+}
+
+bool AgentUpdateScheduler::shouldUpdate(Group group, uint32_t phase, float deltaTime, float& pendingTime, float& elapsedTime) {
+    pendingTime += deltaTime;
+
+    const uint64_t interval = _settings.enabled ? static_cast<uint64_t>(_tick.interval[group]) : 1;
+    if (interval > 1 && (_tickNumber + phase) % interval != 0) return false;
+
+    elapsedTime = pendingTime;
+    pendingTime = 0.0f;
+    ++_tick.updated[group];
+    return true;
+}
+
+void AgentUpdateScheduler::printReport() const {
+    if (_numTicks == 0) return;
+    fprintf(stdout, "[INFO]: Zombie updates: %.1f of %.1f agents per tick on average, at most %u\n",
+            static_cast<double>(_totalUpdated) / static_cast<double>(_numTicks),
+            static_cast<double>(_totalAgents) / static_cast<double>(_numTicks), _maxUpdated);
+}
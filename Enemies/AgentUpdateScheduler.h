@@ -0,0 +1,119 @@
+#ifndef ENEMIES_AGENT_UPDATE_SCHEDULER_H
+#define ENEMIES_AGENT_UPDATE_SCHEDULER_H
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @class AgentUpdateScheduler
+ * @brief Nivel de detalle de la IA: decide qué zombies se actualizan en cada tick.
+ *
+ * Cada agente cae en un grupo según su distancia a la cámara activa y si está dentro de su
+ * frustum. Los cercanos se actualizan en todos los ticks; los lejanos y los que no se ven, uno
+ * de cada interval ticks, repartidos por turnos para que la carga sea pareja entre ticks. Un
+ * agente que espera su turno acumula el tiempo y lo recibe entero cuando le toca.
+ *
+ * Si un grupo lejano crece, su intervalo se alarga para no superar groupBudget
+ * actualizaciones por tick; como el grupo cercano está limitado por el espacio alrededor de la
+ * cámara, el costo por tick queda acotado sin importar el tamaño de la horda.
+ *
+ * Uso en cada tick: beginTick(), classify() para cada agente, planTick() y después
+ * shouldUpdate() para cada agente en el mismo orden.
+ */
+class AgentUpdateScheduler {
+public:
+    /**
+     * @brief Grupos de agentes según distancia y visibilidad.
+     */
+    enum Group {
+        NEAR,
+        MID,
+        FAR,
+        OFFSCREEN,
+        NUM_GROUPS
+    };
+
+    /**
+     * @brief Distancias, intervalos y presupuesto.
+     */
+    struct Settings {
+        bool enabled = true;                // false: todos los agentes se actualizan en todos los ticks
+        float nearDistance = 30.0f;         // hasta aquí, en todos los ticks
+        float farDistance = 80.0f;          // hasta aquí, uno de cada midInterval
+        int midInterval = 2;
+        int farInterval = 4;
+        int offscreenInterval = 8;          // fuera del frustum, a cualquier distancia mayor que nearDistance
+        int groupBudget = 128;              // máximo de actualizaciones por tick de cada grupo que no es NEAR
+        float boundingRadius = 1.5f;        // radio de un agente para la prueba contra el frustum
+    };
+
+    /**
+     * @brief Cuántos agentes hubo y cuántos se actualizaron en un tick.
+     */
+    struct TickStats {
+        uint32_t agents[NUM_GROUPS] = {};
+        uint32_t updated[NUM_GROUPS] = {};
+        int interval[NUM_GROUPS] = {};
+
+        uint32_t getNumAgents() const { return agents[NEAR] + agents[MID] + agents[FAR] + agents[OFFSCREEN]; }
+        uint32_t getNumUpdated() const { return updated[NEAR] + updated[MID] + updated[FAR] + updated[OFFSCREEN]; }
+    };
+
+    AgentUpdateScheduler() = default;
+
+    void setSettings(const Settings& settings);
+
+    /**
+     * @brief Empieza un tick con la cámara activa.
+     *
+     * @param eyePosition Posición de la cámara.
+     * @param viewProjectionMatrix Proyección por vista de la cámara; define el frustum.
+     */
+    void beginTick(const glm::vec3& eyePosition, const glm::mat4& viewProjectionMatrix);
+
+    /**
+     * @brief Grupo de un agente en este tick; lo cuenta para planTick().
+     */
+    Group classify(const glm::vec3& position);
+
+    /**
+     * @brief Fija el intervalo de cada grupo según cuántos agentes tiene.
+     */
+    void planTick();
+
+    /**
+     * @brief Acumula deltaTime y decide si al agente le toca actualizarse.
+     *
+     * @param group Lo que devolvió classify() para el agente.
+     * @param phase Número estable del agente; reparte los turnos dentro de su grupo.
+     * @param deltaTime Duración del tick.
+     * @param pendingTime Tiempo acumulado del agente; si le toca, queda en 0.
+     * @param elapsedTime Si le toca, el tiempo acumulado desde su última actualización.
+     * @return true si el agente se actualiza en este tick.
+     */
+    bool shouldUpdate(Group group, uint32_t phase, float deltaTime, float& pendingTime, float& elapsedTime);
+
+    const TickStats& getLastTickStats() const { return _tick; }
+
+    /**
+     * @brief Imprime el promedio y el máximo de actualizaciones por tick.
+     */
+    void printReport() const;
+
+private:
+    Settings _settings;
+    glm::vec3 _eyePosition = glm::vec3(0.0f);
+    glm::vec4 _frustumPlanes[6];
+    uint64_t _tickNumber = 0;
+    TickStats _tick;
+
+    // Estadísticas
+    uint64_t _numTicks = 0;
+    uint64_t _totalAgents = 0;
+    uint64_t _totalUpdated = 0;
+    uint32_t _maxUpdated = 0;
+};
+
+#endif // ENEMIES_AGENT_UPDATE_SCHEDULER_H
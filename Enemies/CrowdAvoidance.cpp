@@ -0,0 +1,400 @@
+#include "CrowdAvoidance.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    constexpr float EPSILON = 1.0e-5f;
+
+    // Máximo de celdas de la retícula; si los agentes están más dispersos se agrandan las celdas
+    constexpr size_t MAX_GRID_CELLS = 1u << 20;
+
+    float det(const glm::vec2& a, const glm::vec2& b) { return a.x * b.y - a.y * b.x; }
+    float lengthSquared(const glm::vec2& v) { return glm::dot(v, v); }
+
+    // Programación lineal en 2D sobre los semiplanos ORCA (van den Berg et al., "Reciprocal
+    // n-body collision avoidance"): la velocidad más cercana a la preferida dentro de todos
+    // los semiplanos y del círculo de velocidad máxima
+
+    // Óptimo sobre la recta lineNo respetando las anteriores
+    template<typename Lines>
+    bool linearProgram1(const Lines& lines, size_t lineNo, float radius, const glm::vec2& optVelocity,
+                        bool directionOpt, glm::vec2& result) {
+        const float dotProduct = glm::dot(lines[lineNo].point, lines[lineNo].direction);
+        const float discriminant = dotProduct * dotProduct + radius * radius - lengthSquared(lines[lineNo].point);
+        if (discriminant < 0.0f) return false;     // la recta no corta el círculo de velocidad máxima
+
+        const float sqrtDiscriminant = std::sqrt(discriminant);
+        float tLeft = -dotProduct - sqrtDiscriminant;
+        float tRight = -dotProduct + sqrtDiscriminant;
+
+        for (size_t i = 0; i < lineNo; ++i) {
+            const float denominator = det(lines[lineNo].direction, lines[i].direction);
+            const float numerator = det(lines[i].direction, lines[lineNo].point - lines[i].point);
+            if (std::abs(denominator) <= EPSILON) {
+                // Rectas paralelas
+                if (numerator < 0.0f) return false;
+                continue;
+            }
+            const float t = numerator / denominator;
+            if (denominator >= 0.0f) tRight = std::min(tRight, t);
+            else                     tLeft = std::max(tLeft, t);
+            if (tLeft > tRight) return false;
+        }
+
+        if (directionOpt) {
+            result = lines[lineNo].point + (glm::dot(optVelocity, lines[lineNo].direction) > 0.0f ? tRight : tLeft) * lines[lineNo].direction;
+        } else {
+            const float t = std::clamp(glm::dot(lines[lineNo].direction, optVelocity - lines[lineNo].point), tLeft, tRight);
+            result = lines[lineNo].point + t * lines[lineNo].direction;
+        }
+        return true;
+    }
+
+    // Devuelve lines.size() si hay solución, o la primera recta que la hace imposible
+    template<typename Lines>
+    size_t linearProgram2(const Lines& lines, float radius, const glm::vec2& optVelocity, bool directionOpt,
+                          glm::vec2& result) {
+        if (directionOpt) {
+            result = optVelocity * radius;
+        } else if (lengthSquared(optVelocity) > radius * radius) {
+            result = glm::normalize(optVelocity) * radius;
+        } else {
+            result = optVelocity;
+        }
+
+        for (size_t i = 0; i < lines.size(); ++i) {
+            if (det(lines[i].direction, lines[i].point - result) > 0.0f) {
+                const glm::vec2 previousResult = result;
+                if (!linearProgram1(lines, i, radius, optVelocity, directionOpt, result)) {
+                    result = previousResult;
+                    return i;
+                }
+            }
+        }
+        return lines.size();
+    }
+
+    // Sin solución (multitud demasiado densa): la velocidad que menos viola el peor semiplano
+    template<typename Lines>
+    void linearProgram3(const Lines& lines, size_t beginLine, float radius, Lines& projectedLines, glm::vec2& result) {
+        float distance = 0.0f;
+        for (size_t i = beginLine; i < lines.size(); ++i) {
+            if (det(lines[i].direction, lines[i].point - result) <= distance) continue;
+
+            projectedLines.clear();
+            for (size_t j = 0; j < i; ++j) {
+                typename Lines::value_type line;
+                const float determinant = det(lines[i].direction, lines[j].direction);
+                if (std::abs(determinant) <= EPSILON) {
+                    if (glm::dot(lines[i].direction, lines[j].direction) > 0.0f) continue;     // mismo sentido
+                    line.point = 0.5f * (lines[i].point + lines[j].point);
+                } else {
+                    line.point = lines[i].point + (det(lines[j].direction, lines[i].point - lines[j].point) / determinant) * lines[i].direction;
+                }
+                line.direction = glm::normalize(lines[j].direction - lines[i].direction);
+                projectedLines.push_back(line);
+            }
+
+            const glm::vec2 previousResult = result;
+            if (linearProgram2(projectedLines, radius, glm::vec2(-lines[i].direction.y, lines[i].direction.x), true, result) < projectedLines.size()) {
+                // Solo puede fallar por redondeo; se conserva el resultado anterior
+                result = previousResult;
+            }
+            distance = det(lines[i].direction, lines[i].point - result);
+        }
+    }
+}
+
+CrowdAvoidance::~CrowdAvoidance() {
+    stop();
+}
+
+void CrowdAvoidance::start(const Settings& settings) {
+    stop();
+
+    _settings = settings;
+    _settings.radius = std::max(_settings.radius, 0.0f);
+    _settings.neighborDistance = std::max(_settings.neighborDistance, 2.0f * _settings.radius + EPSILON);
+    _settings.maxNeighbors = std::max(_settings.maxNeighbors, 0);
+    _settings.timeHorizon = std::max(_settings.timeHorizon, EPSILON);
+    _settings.agentsPerChunk = std::max(_settings.agentsPerChunk, 1);
+
+    int numThreads = _settings.numThreads > 0 ? _settings.numThreads
+                                              : static_cast<int>(std::thread::hardware_concurrency());
+    numThreads = std::clamp(numThreads, 1, 64);
+
+    _arenas.resize(static_cast<size_t>(numThreads));
+    _stopping = false;
+    _busyWorkers = 0;
+    for (int i = 1; i < numThreads; ++i) {
+        _workers.emplace_back(&CrowdAvoidance::_workerMain, this, static_cast<size_t>(i), _generation);
+    }
+}
+
+void CrowdAvoidance::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _workAvailable.notify_all();
+    for (std::thread& worker : _workers) {
+        worker.join();
+    }
+    _workers.clear();
+}
+
+void CrowdAvoidance::reserve(size_t numAgents, float extent) {
+    _positions.reserve(numAgents);
+    _velocities.reserve(numAgents);
+    _preferredVelocities.reserve(numAgents);
+    _timeSteps.reserve(numAgents);
+    _newVelocities.reserve(numAgents);
+    _activeAgents.reserve(numAgents);
+    _agentCells.reserve(numAgents);
+    _cellAgents.reserve(numAgents);
+
+    // Las mismas celdas que usaría _buildGrid() con agentes en las dos esquinas
+    float cellSize = _settings.neighborDistance;
+    while ((static_cast<size_t>(extent / cellSize) + 1) * (static_cast<size_t>(extent / cellSize) + 1) > MAX_GRID_CELLS) {
+        cellSize *= 2.0f;
+    }
+    const size_t numCells = (static_cast<size_t>(extent / cellSize) + 1) * (static_cast<size_t>(extent / cellSize) + 1);
+    _cellStart.reserve(numCells + 1);
+    _cellCursor.reserve(numCells);
+}
+
+void CrowdAvoidance::clear() {
+    _positions.clear();
+    _velocities.clear();
+    _preferredVelocities.clear();
+    _timeSteps.clear();
+}
+
+void CrowdAvoidance::addAgent(const glm::vec2& position, const glm::vec2& velocity, const glm::vec2& preferredVelocity, float timeStep) {
+    _positions.push_back(position);
+    _velocities.push_back(velocity);
+    _preferredVelocities.push_back(preferredVelocity);
+    _timeSteps.push_back(timeStep);
+}
+
+void CrowdAvoidance::solve() {
+    const size_t numAgents = _positions.size();
+    _newVelocities.resize(numAgents);
+
+    // Los agentes sin paso conservan su velocidad y solo cuentan como vecinos
+    _activeAgents.clear();
+    for (size_t i = 0; i < numAgents; ++i) {
+        if (_timeSteps[i] > 0.0f) {
+            _activeAgents.push_back(static_cast<uint32_t>(i));
+        } else {
+            _newVelocities[i] = _velocities[i];
+        }
+    }
+
+    if (!_settings.enabled || _arenas.empty()) {
+        for (const uint32_t i : _activeAgents) {
+            const float speed = glm::length(_preferredVelocities[i]);
+            _newVelocities[i] = speed > _settings.maxSpeed ? _preferredVelocities[i] * (_settings.maxSpeed / speed) : _preferredVelocities[i];
+        }
+        return;
+    }
+    if (_activeAgents.empty()) return;
+
+    _buildGrid();
+    // Los hilos auxiliares están esperando: nadie usa los arenas del tick anterior
+    _arenas.reset();
+
+    _numChunks = (_activeAgents.size() + static_cast<size_t>(_settings.agentsPerChunk) - 1) / static_cast<size_t>(_settings.agentsPerChunk);
+    _nextChunk.store(0, std::memory_order_relaxed);
+
+    // Con un solo bloque no vale la pena despertar a nadie
+    const bool parallel = _numChunks > 1 && !_workers.empty();
+    if (parallel) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_generation;
+            _busyWorkers = static_cast<int>(_workers.size());
+        }
+        _workAvailable.notify_all();
+    }
+
+    _solveChunks(_arenas[0]);
+
+    if (parallel) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _workDone.wait(lock, [this] { return _busyWorkers == 0; });
+    }
+}
+
+void CrowdAvoidance::_buildGrid() {
+    const size_t numAgents = _positions.size();
+
+    glm::vec2 minimum = _positions[0], maximum = _positions[0];
+    for (const glm::vec2& position : _positions) {
+        minimum = glm::min(minimum, position);
+        maximum = glm::max(maximum, position);
+    }
+
+    // Con celdas de lado neighborDistance todos los vecinos están en las 3 x 3 celdas alrededor
+    _gridCellSize = _settings.neighborDistance;
+    const glm::vec2 extent = maximum - minimum;
+    while ((static_cast<size_t>(extent.x / _gridCellSize) + 1) * (static_cast<size_t>(extent.y / _gridCellSize) + 1) > MAX_GRID_CELLS) {
+        _gridCellSize *= 2.0f;
+    }
+    _gridOrigin = minimum;
+    _gridWidth = static_cast<int>(extent.x / _gridCellSize) + 1;
+    _gridHeight = static_cast<int>(extent.y / _gridCellSize) + 1;
+
+    // Ordenamiento por conteo: los agentes de cada celda quedan contiguos y en orden de llegada
+    const size_t numCells = static_cast<size_t>(_gridWidth) * _gridHeight;
+    // La retícula crece cuando los agentes se dispersan; crecer al doble evita pedir memoria
+    // en cada tick en que se agranda un poco
+    if (_cellStart.capacity() < numCells + 1) {
+        _cellStart.reserve(std::min(2 * (numCells + 1), MAX_GRID_CELLS + 1));
+        _cellCursor.reserve(_cellStart.capacity());
+    }
+    _cellStart.assign(numCells + 1, 0);
+    _agentCells.resize(numAgents);
+    for (size_t i = 0; i < numAgents; ++i) {
+        const glm::vec2 cell = (_positions[i] - _gridOrigin) / _gridCellSize;
+        const int cellX = std::min(static_cast<int>(cell.x), _gridWidth - 1);
+        const int cellZ = std::min(static_cast<int>(cell.y), _gridHeight - 1);
+        _agentCells[i] = static_cast<uint32_t>(cellZ * _gridWidth + cellX);
+        ++_cellStart[_agentCells[i] + 1];
+    }
+    for (size_t cell = 0; cell < numCells; ++cell) {
+        _cellStart[cell + 1] += _cellStart[cell];
+    }
+    _cellAgents.resize(numAgents);
+    _cellCursor.assign(_cellStart.begin(), _cellStart.end() - 1);
+    for (size_t i = 0; i < numAgents; ++i) {
+        _cellAgents[_cellCursor[_agentCells[i]]++] = static_cast<uint32_t>(i);
+    }
+}
+
+void CrowdAvoidance::_solveChunks(FrameArena& arena) {
+    const size_t agentsPerChunk = static_cast<size_t>(_settings.agentsPerChunk);
+    for (size_t chunk = _nextChunk.fetch_add(1, std::memory_order_relaxed); chunk < _numChunks;
+         chunk = _nextChunk.fetch_add(1, std::memory_order_relaxed)) {
+        const size_t end = std::min((chunk + 1) * agentsPerChunk, _activeAgents.size());
+        for (size_t i = chunk * agentsPerChunk; i < end; ++i) {
+            // Lo que reserva un agente se devuelve al terminar: el arena no crece con los agentes
+            const FrameArena::Marker marker = arena.mark();
+            _solveAgent(_activeAgents[i], arena);
+            arena.rewind(marker);
+        }
+    }
+}
+
+void CrowdAvoidance::_solveAgent(size_t agent, FrameArena& arena) {
+    const glm::vec2 position = _positions[agent];
+    const glm::vec2 velocity = _velocities[agent];
+    const float neighborDistanceSquared = _settings.neighborDistance * _settings.neighborDistance;
+    const size_t maxNeighbors = static_cast<size_t>(_settings.maxNeighbors);
+
+    // Los maxNeighbors más cercanos, en las 3 x 3 celdas alrededor; con distancias iguales
+    // gana el índice menor, así el resultado no depende del orden de la búsqueda
+    FrameVector<std::pair<float, uint32_t>> neighbors{ ArenaAllocator<std::pair<float, uint32_t>>(arena) };
+    neighbors.reserve(maxNeighbors);
+    const int cellX = static_cast<int>(_agentCells[agent] % static_cast<uint32_t>(_gridWidth));
+    const int cellZ = static_cast<int>(_agentCells[agent] / static_cast<uint32_t>(_gridWidth));
+    for (int z = std::max(cellZ - 1, 0); z <= std::min(cellZ + 1, _gridHeight - 1); ++z) {
+        for (int x = std::max(cellX - 1, 0); x <= std::min(cellX + 1, _gridWidth - 1); ++x) {
+            const size_t cell = static_cast<size_t>(z) * _gridWidth + x;
+            for (uint32_t k = _cellStart[cell]; k < _cellStart[cell + 1]; ++k) {
+                const uint32_t other = _cellAgents[k];
+                if (other == agent) continue;
+                const std::pair<float, uint32_t> candidate(lengthSquared(_positions[other] - position), other);
+                if (candidate.first >= neighborDistanceSquared) continue;
+                if (neighbors.size() == maxNeighbors) {
+                    if (maxNeighbors == 0 || !(candidate < neighbors.back())) continue;
+                    neighbors.pop_back();
+                }
+                neighbors.insert(std::upper_bound(neighbors.begin(), neighbors.end(), candidate), candidate);
+            }
+        }
+    }
+
+    // Un semiplano de velocidades permitidas por vecino; cada uno asume la mitad del desvío
+    const float invTimeHorizon = 1.0f / _settings.timeHorizon;
+    const float combinedRadius = 2.0f * _settings.radius;
+    const float combinedRadiusSquared = combinedRadius * combinedRadius;
+    FrameVector<Line> lines{ ArenaAllocator<Line>(arena) };
+    lines.reserve(neighbors.size());
+    for (const std::pair<float, uint32_t>& neighbor : neighbors) {
+        const glm::vec2 relativePosition = _positions[neighbor.second] - position;
+        const glm::vec2 relativeVelocity = velocity - _velocities[neighbor.second];
+        const float distanceSquared = neighbor.first;
+
+        Line line;
+        glm::vec2 u;
+        if (distanceSquared > combinedRadiusSquared) {
+            // Sin contacto: se proyecta la velocidad relativa sobre el cono truncado de colisión
+            const glm::vec2 w = relativeVelocity - invTimeHorizon * relativePosition;
+            const float wLengthSquared = lengthSquared(w);
+            const float dotProduct = glm::dot(w, relativePosition);
+
+            if (dotProduct < 0.0f && dotProduct * dotProduct > combinedRadiusSquared * wLengthSquared) {
+                // Sobre el círculo que corta el cono
+                const float wLength = std::sqrt(wLengthSquared);
+                const glm::vec2 unitW = w / wLength;
+                line.direction = glm::vec2(unitW.y, -unitW.x);
+                u = (combinedRadius * invTimeHorizon - wLength) * unitW;
+            } else {
+                // Sobre uno de los lados del cono
+                const float leg = std::sqrt(distanceSquared - combinedRadiusSquared);
+                if (det(relativePosition, w) > 0.0f) {
+                    line.direction = glm::vec2(relativePosition.x * leg - relativePosition.y * combinedRadius,
+                                               relativePosition.x * combinedRadius + relativePosition.y * leg) / distanceSquared;
+                } else {
+                    line.direction = -glm::vec2(relativePosition.x * leg + relativePosition.y * combinedRadius,
+                                                -relativePosition.x * combinedRadius + relativePosition.y * leg) / distanceSquared;
+                }
+                u = glm::dot(relativeVelocity, line.direction) * line.direction - relativeVelocity;
+            }
+        } else {
+            // Ya se superponen: separarlos dentro de su próximo paso
+            const float invTimeStep = 1.0f / std::max(_timeSteps[agent], EPSILON);
+            const glm::vec2 w = relativeVelocity - invTimeStep * relativePosition;
+            const float wLength = std::max(glm::length(w), EPSILON);
+            const glm::vec2 unitW = w / wLength;
+            line.direction = glm::vec2(unitW.y, -unitW.x);
+            u = (combinedRadius * invTimeStep - wLength) * unitW;
+        }
+        line.point = velocity + 0.5f * u;
+        lines.push_back(line);
+    }
+
+    glm::vec2 newVelocity;
+    const size_t lineFail = linearProgram2(lines, _settings.maxSpeed, _preferredVelocities[agent], false, newVelocity);
+    if (lineFail < lines.size()) {
+        FrameVector<Line> projectedLines{ ArenaAllocator<Line>(arena) };
+        projectedLines.reserve(lines.size());
+        linearProgram3(lines, lineFail, _settings.maxSpeed, projectedLines, newVelocity);
+    }
+    // Cada hilo escribe solo las velocidades de sus propios bloques
+    _newVelocities[agent] = newVelocity;
+}
+
+void CrowdAvoidance::_workerMain(size_t workerIndex, uint64_t lastGeneration) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workAvailable.wait(lock, [&] { return _stopping || _generation != lastGeneration; });
+            if (_stopping) return;
+            lastGeneration = _generation;
+        }
+
+        _solveChunks(_arenas[workerIndex]);
+
+        bool lastWorker;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            lastWorker = --_busyWorkers == 0;
+        }
+        if (lastWorker) {
+            _workDone.notify_one();
+        }
+    }
+}
@@ -0,0 +1,143 @@
+#ifndef ENEMIES_CROWD_AVOIDANCE_H
+#define ENEMIES_CROWD_AVOIDANCE_H
+
+#include "../Memory/FrameArena.h"
+
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @class CrowdAvoidance
+ * @brief Evasión local entre zombies con velocidades recíprocas (ORCA).
+ *
+ * Cada agente trae su velocidad preferida (la del campo de direcciones) y recibe la velocidad
+ * más parecida a ella que no choca con ningún vecino durante timeHorizon segundos, suponiendo
+ * que cada vecino hace la mitad del esfuerzo. Los vecinos se buscan en una retícula uniforme
+ * de lado neighborDistance, así que el costo por tick crece linealmente con los agentes.
+ *
+ * Los agentes se resuelven por bloques en paralelo: la velocidad de cada uno solo depende del
+ * estado del tick anterior, así que el resultado no depende del número de hilos. Los agentes
+ * agregados sin paso de tiempo no se resuelven: conservan su velocidad y los demás los evitan.
+ */
+class CrowdAvoidance {
+public:
+    /**
+     * @brief Vecindario, horizonte e hilos.
+     */
+    struct Settings {
+        bool enabled = true;                // false: cada agente toma su velocidad preferida
+        float radius = 0.9f;                // radio de cada agente
+        float maxSpeed = 2.0f;              // velocidad máxima resultante
+        float neighborDistance = 4.0f;      // solo se evitan los vecinos a esta distancia
+        int maxNeighbors = 10;              // los más cercanos dentro de neighborDistance
+        float timeHorizon = 2.0f;           // segundos hacia adelante sin choques
+        int numThreads = 0;                 // 0: uno por núcleo
+        int agentsPerChunk = 256;           // agentes por bloque repartido entre hilos
+    };
+
+    CrowdAvoidance() = default;
+    ~CrowdAvoidance();
+
+    CrowdAvoidance(const CrowdAvoidance&) = delete;
+    CrowdAvoidance& operator=(const CrowdAvoidance&) = delete;
+
+    /**
+     * @brief Lanza los hilos auxiliares; quien llama a solve() también resuelve bloques.
+     */
+    void start(const Settings& settings);
+
+    /**
+     * @brief Detiene los hilos auxiliares.
+     */
+    void stop();
+
+    /**
+     * @brief Reserva lugar para numAgents agentes dentro de un cuadrado de lado extent: hasta
+     * ahí, addAgent() y solve() no piden memoria al heap.
+     */
+    void reserve(size_t numAgents, float extent);
+
+    /**
+     * @brief Descarta los agentes del tick anterior.
+     */
+    void clear();
+
+    /**
+     * @brief Agrega un agente en el plano XZ.
+     *
+     * @param position Posición actual.
+     * @param velocity Velocidad con la que se movió en el tick anterior.
+     * @param preferredVelocity Velocidad que tomaría sin vecinos.
+     * @param timeStep Tiempo que avanzará con la nueva velocidad; los agentes que ya se
+     * superponen se separan en él. 0 si no se actualiza en este tick.
+     */
+    void addAgent(const glm::vec2& position, const glm::vec2& velocity, const glm::vec2& preferredVelocity, float timeStep);
+
+    /**
+     * @brief Calcula la nueva velocidad de los agentes con paso de tiempo.
+     */
+    void solve();
+
+    size_t getNumAgents() const { return _positions.size(); }
+    const glm::vec2& getVelocity(size_t agent) const { return _newVelocities[agent]; }
+    int getNumThreads() const { return static_cast<int>(_workers.size()) + 1; }
+    // Memoria de trabajo de cada hilo; se vacía al empezar cada solve()
+    const FrameArenas& getFrameArenas() const { return _arenas; }
+
+private:
+    // Semiplano de velocidades permitidas: a la izquierda de direction, pasando por point
+    struct Line {
+        glm::vec2 point;
+        glm::vec2 direction;
+    };
+
+    void _buildGrid();
+    void _solveChunks(FrameArena& arena);
+    void _solveAgent(size_t agent, FrameArena& arena);
+    // lastGeneration es la generación al lanzar el hilo: si solve() la sube antes de que el hilo
+    // arranque, el hilo igual ve ese trabajo como pendiente
+    void _workerMain(size_t workerIndex, uint64_t lastGeneration);
+
+    Settings _settings;
+
+    // Agentes del tick
+    std::vector<glm::vec2> _positions;
+    std::vector<glm::vec2> _velocities;
+    std::vector<glm::vec2> _preferredVelocities;
+    std::vector<float> _timeSteps;
+    std::vector<glm::vec2> _newVelocities;
+    std::vector<uint32_t> _activeAgents;    // los que se resuelven en este tick
+
+    // Retícula de vecinos: los agentes de la celda c son _cellAgents[_cellStart[c] .. _cellStart[c + 1])
+    glm::vec2 _gridOrigin = glm::vec2(0.0f);
+    float _gridCellSize = 1.0f;
+    int _gridWidth = 0, _gridHeight = 0;
+    std::vector<uint32_t> _cellStart;
+    std::vector<uint32_t> _cellAgents;
+    std::vector<uint32_t> _agentCells;
+    std::vector<uint32_t> _cellCursor;
+
+    FrameArenas _arenas;                    // uno por hilo; el 0 es el de quien llama
+
+    // Reparto de bloques con los hilos auxiliares
+    std::mutex _mutex;
+    std::condition_variable _workAvailable;
+    std::condition_variable _workDone;
+    uint64_t _generation = 0;
+    int _busyWorkers = 0;
+    bool _stopping = false;
+    std::atomic<size_t> _nextChunk{0};
+    size_t _numChunks = 0;
+
+    std::vector<std::thread> _workers;
+};
+
+#endif // ENEMIES_CROWD_AVOIDANCE_H
@@ -0,0 +1,232 @@
+#include "FlowField.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace {
+    constexpr float INFINITE_COST = std::numeric_limits<float>::infinity();
+
+    // Vecinas en 8 direcciones: primero las ortogonales
+    constexpr int NEIGHBOR_DX[8] = { 1, -1, 0, 0, 1, -1, 1, -1 };
+    constexpr int NEIGHBOR_DZ[8] = { 0, 0, 1, -1, 1, 1, -1, -1 };
+    constexpr float NEIGHBOR_LENGTH[8] = { 1.0f, 1.0f, 1.0f, 1.0f, 1.41421356f, 1.41421356f, 1.41421356f, 1.41421356f };
+
+    // Una diagonal solo se puede tomar si las dos ortogonales que rodea están libres, así
+    // nadie corta la esquina de un obstáculo
+    bool canMove(const FlowField::Field& field, int x, int z, int direction) {
+        const int n = field.cellsPerSide;
+        const int nx = x + NEIGHBOR_DX[direction], nz = z + NEIGHBOR_DZ[direction];
+        if (nx < 0 || nz < 0 || nx >= n || nz >= n) return false;
+        if (std::isinf(field.costs[static_cast<size_t>(nz) * n + nx])) return false;
+        if (direction < 4) return true;
+        return !std::isinf(field.costs[static_cast<size_t>(z) * n + nx]) && !std::isinf(field.costs[static_cast<size_t>(nz) * n + x]);
+    }
+}
+
+FlowField::~FlowField() {
+    stop();
+}
+
+void FlowField::start(const Settings& settings) {
+    stop();
+
+    _settings = settings;
+    _settings.cellsPerSide = std::clamp(_settings.cellsPerSide, 3, 1024);
+    _settings.cellSize = std::max(_settings.cellSize, 0.01f);
+    _requestedCell = glm::ivec2(INT32_MIN);
+    _stopping = false;
+
+    if (_settings.asynchronous) {
+        _worker = std::thread(&FlowField::_workerMain, this);
+    }
+}
+
+void FlowField::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _hasRequest = false;
+        _requestTiles.clear();
+    }
+    _requestAvailable.notify_all();
+    if (_worker.joinable()) {
+        _worker.join();
+    }
+
+    _hasReady = false;
+    _current = Field();
+    _ready = Field();
+}
+
+void FlowField::update(const glm::vec3& goal, const std::vector<std::shared_ptr<Terrain>>& terrainTiles) {
+    const glm::ivec2 cell(static_cast<int>(std::floor(goal.x / _settings.cellSize)),
+                          static_cast<int>(std::floor(goal.z / _settings.cellSize)));
+    const bool cellChanged = cell != _requestedCell;
+    _requestedCell = cell;
+
+    if (!_settings.asynchronous) {
+        if (cellChanged) {
+            build(_settings, glm::vec2(goal.x, goal.z), terrainTiles, _current, _heap);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        // El campo terminado se intercambia con el actual: ninguno de los dos reserva memoria
+        if (_hasReady) {
+            std::swap(_current, _ready);
+            _hasReady = false;
+        }
+        if (cellChanged) {
+            // Si había una petición sin empezar se reemplaza; solo importa la más reciente
+            _hasRequest = true;
+            _requestGoal = glm::vec2(goal.x, goal.z);
+            // La lista crece de una vez hasta el máximo de tiles; copiar sin lugar reservaría
+            // cada vez que se carga un tile
+            _requestTiles.reserve(terrainTiles.capacity());
+            _requestTiles = terrainTiles;
+        }
+    }
+    if (cellChanged) {
+        _requestAvailable.notify_one();
+    }
+}
+
+void FlowField::build(const Settings& settings, const glm::vec2& goal, const std::vector<std::shared_ptr<Terrain>>& terrainTiles,
+                      Field& field, std::vector<std::pair<float, int>>& heap) {
+    const int n = settings.cellsPerSide;
+    const float cellSize = settings.cellSize;
+    const size_t numCells = static_cast<size_t>(n) * n;
+
+    // La ventana queda alineada a la retícula de celdas con el héroe en la celda central
+    const glm::vec2 goalCell = glm::floor(goal / cellSize);
+    field.origin = (goalCell - static_cast<float>(n / 2)) * cellSize;
+    field.cellSize = cellSize;
+    field.cellsPerSide = n;
+
+    // Alturas: cada tile rellena las celdas cuyo centro cae dentro de él
+    field.heights.assign(numCells, std::numeric_limits<float>::quiet_NaN());
+    for (const std::shared_ptr<Terrain>& tile : terrainTiles) {
+        const glm::vec2 tileMin = tile->getCenter() - tile->getHalfSize();
+        const glm::vec2 tileMax = tile->getCenter() + tile->getHalfSize();
+        const int x0 = std::max(static_cast<int>(std::ceil((tileMin.x - field.origin.x) / cellSize - 0.5f)), 0);
+        const int z0 = std::max(static_cast<int>(std::ceil((tileMin.y - field.origin.y) / cellSize - 0.5f)), 0);
+        const int x1 = std::min(static_cast<int>(std::floor((tileMax.x - field.origin.x) / cellSize - 0.5f)), n - 1);
+        const int z1 = std::min(static_cast<int>(std::floor((tileMax.y - field.origin.y) / cellSize - 0.5f)), n - 1);
+        for (int z = z0; z <= z1; ++z) {
+            for (int x = x0; x <= x1; ++x) {
+                const glm::vec2 center = field.origin + (glm::vec2(x, z) + 0.5f) * cellSize;
+                field.heights[static_cast<size_t>(z) * n + x] = tile->getHeight(center.x, center.y);
+            }
+        }
+    }
+
+    // Costos: la pendiente hacia las vecinas encarece la celda y, si es excesiva, la bloquea
+    field.costs.resize(numCells);
+    for (int z = 0; z < n; ++z) {
+        for (int x = 0; x < n; ++x) {
+            const size_t index = static_cast<size_t>(z) * n + x;
+            const float height = field.heights[index];
+            if (std::isnan(height)) {
+                field.costs[index] = INFINITE_COST;
+                continue;
+            }
+            float slope = 0.0f;
+            for (int direction = 0; direction < 4; ++direction) {
+                const int nx = x + NEIGHBOR_DX[direction], nz = z + NEIGHBOR_DZ[direction];
+                if (nx < 0 || nz < 0 || nx >= n || nz >= n) continue;
+                const float neighborHeight = field.heights[static_cast<size_t>(nz) * n + nx];
+                if (!std::isnan(neighborHeight)) {
+                    slope = std::max(slope, std::abs(neighborHeight - height) / cellSize);
+                }
+            }
+            field.costs[index] = slope > settings.maxSlope ? INFINITE_COST : 1.0f + settings.slopeCost * slope;
+        }
+    }
+
+    // El héroe puede estar en una celda empinada; la meta nunca es un obstáculo
+    const int goalX = n / 2, goalZ = n / 2;
+    const size_t goalIndex = static_cast<size_t>(goalZ) * n + goalX;
+    if (std::isinf(field.costs[goalIndex])) field.costs[goalIndex] = 1.0f;
+
+    // Integración: Dijkstra desde la meta; el paso entre dos celdas cuesta la distancia por
+    // el promedio de sus costos
+    field.integration.assign(numCells, INFINITE_COST);
+    field.integration[goalIndex] = 0.0f;
+    heap.clear();
+    heap.emplace_back(-0.0f, static_cast<int>(goalIndex));
+    while (!heap.empty()) {
+        // Montículo de máximos con distancias negadas
+        std::pop_heap(heap.begin(), heap.end());
+        const float distance = -heap.back().first;
+        const int index = heap.back().second;
+        heap.pop_back();
+        if (distance > field.integration[static_cast<size_t>(index)]) continue;
+
+        const int x = index % n, z = index / n;
+        for (int direction = 0; direction < 8; ++direction) {
+            if (!canMove(field, x, z, direction)) continue;
+            const int neighbor = (z + NEIGHBOR_DZ[direction]) * n + x + NEIGHBOR_DX[direction];
+            const float step = NEIGHBOR_LENGTH[direction] * 0.5f * (field.costs[static_cast<size_t>(index)] + field.costs[static_cast<size_t>(neighbor)]);
+            if (distance + step < field.integration[static_cast<size_t>(neighbor)]) {
+                field.integration[static_cast<size_t>(neighbor)] = distance + step;
+                heap.emplace_back(-(distance + step), neighbor);
+                std::push_heap(heap.begin(), heap.end());
+            }
+        }
+    }
+
+    // Direcciones: hacia la vecina con menor costo acumulado
+    field.directions.assign(numCells, glm::vec2(0.0f));
+    for (int z = 0; z < n; ++z) {
+        for (int x = 0; x < n; ++x) {
+            const size_t index = static_cast<size_t>(z) * n + x;
+            if (index == goalIndex || std::isinf(field.integration[index])) continue;
+
+            float best = field.integration[index];
+            int bestDirection = -1;
+            for (int direction = 0; direction < 8; ++direction) {
+                if (!canMove(field, x, z, direction)) continue;
+                const float neighborIntegration = field.integration[static_cast<size_t>(z + NEIGHBOR_DZ[direction]) * n + x + NEIGHBOR_DX[direction]];
+                if (neighborIntegration < best) {
+                    best = neighborIntegration;
+                    bestDirection = direction;
+                }
+            }
+            if (bestDirection >= 0) {
+                field.directions[index] = glm::vec2(NEIGHBOR_DX[bestDirection], NEIGHBOR_DZ[bestDirection]) / NEIGHBOR_LENGTH[bestDirection];
+            }
+        }
+    }
+}
+
+void FlowField::_workerMain() {
+    Field building;
+    std::vector<std::pair<float, int>> heap;
+    std::vector<std::shared_ptr<Terrain>> tiles;
+
+    for (;;) {
+        glm::vec2 goal;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _requestAvailable.wait(lock, [this] { return _stopping || _hasRequest; });
+            if (_stopping) return;
+            goal = _requestGoal;
+            tiles.swap(_requestTiles);
+            // La lista que vuelve a la simulación reserva aquí, no en su frame
+            _requestTiles.reserve(tiles.capacity());
+            _hasRequest = false;
+        }
+
+        build(_settings, goal, tiles, building, heap);
+        // Soltar los tiles aquí: si la simulación ya los descartó, el último shared_ptr es este
+        tiles.clear();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            std::swap(_ready, building);
+            _hasReady = true;
+        }
+    }
+}
@@ -0,0 +1,128 @@
+#ifndef ENEMIES_FLOW_FIELD_H
+#define ENEMIES_FLOW_FIELD_H
+
+#include "../Terrain/Terrain.h"
+
+#include <glm/glm.hpp>
+
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @class FlowField
+ * @brief Campo de direcciones hacia el héroe que comparten todos los zombies.
+ *
+ * Una ventana de cellsPerSide x cellsPerSide celdas centrada en el héroe guarda, para cada
+ * celda, la dirección hacia la vecina más cercana al héroe según un campo de integración
+ * (Dijkstra en 8 direcciones sobre el costo de cruzar cada celda). Las celdas demasiado
+ * empinadas o fuera del terreno cargado son obstáculos. Cada zombie consulta su dirección en
+ * O(1), así que el costo por zombie no depende del tamaño de la horda.
+ *
+ * El campo se reconstruye solo cuando el héroe cambia de celda, en un hilo de fondo; mientras
+ * tanto los zombies siguen el último campo terminado.
+ */
+class FlowField {
+public:
+    /**
+     * @brief Tamaño de la ventana y criterio de obstáculos.
+     */
+    struct Settings {
+        int cellsPerSide = 128;             // celdas por lado de la ventana
+        float cellSize = 2.0f;              // lado de una celda en unidades de mundo
+        float maxSlope = 1.0f;              // desnivel / distancia a partir del que una celda es intransitable
+        float slopeCost = 4.0f;             // costo extra de cruzar una celda por unidad de pendiente
+        bool asynchronous = true;           // false: se construye en update(), para reproducir grabaciones igual
+    };
+
+    /**
+     * @brief Un campo terminado; inmutable mientras los zombies lo consultan.
+     */
+    struct Field {
+        glm::vec2 origin = glm::vec2(0.0f); // esquina de la celda (0, 0)
+        float cellSize = 1.0f;
+        int cellsPerSide = 0;
+        std::vector<float> heights;         // altura en el centro de cada celda; NaN fuera del terreno cargado
+        std::vector<float> costs;           // costo de cruzar cada celda; infinito en los obstáculos
+        std::vector<float> integration;     // costo acumulado hasta el héroe; infinito si no se llega
+        std::vector<glm::vec2> directions;  // unitaria hacia la vecina más barata; 0 en la meta e inalcanzables
+
+        /**
+         * @brief Dirección en el plano XZ para un punto; (0, 0) fuera de la ventana.
+         */
+        glm::vec2 sample(float x, float z) const {
+            const int cellX = static_cast<int>(std::floor((x - origin.x) / cellSize));
+            const int cellZ = static_cast<int>(std::floor((z - origin.y) / cellSize));
+            if (cellX < 0 || cellZ < 0 || cellX >= cellsPerSide || cellZ >= cellsPerSide) return glm::vec2(0.0f);
+            return directions[static_cast<size_t>(cellZ) * cellsPerSide + cellX];
+        }
+    };
+
+    FlowField() = default;
+    ~FlowField();
+
+    FlowField(const FlowField&) = delete;
+    FlowField& operator=(const FlowField&) = delete;
+
+    /**
+     * @brief Lanza el hilo de fondo si settings.asynchronous.
+     */
+    void start(const Settings& settings);
+
+    /**
+     * @brief Detiene el hilo de fondo y descarta los campos.
+     */
+    void stop();
+
+    /**
+     * @brief Adopta el último campo terminado y, si el héroe cambió de celda, pide uno nuevo.
+     *
+     * @param goal Posición del héroe.
+     * @param terrainTiles Tiles residentes; el hilo de fondo los mantiene vivos mientras muestrea sus alturas.
+     */
+    void update(const glm::vec3& goal, const std::vector<std::shared_ptr<Terrain>>& terrainTiles);
+
+    /**
+     * @brief Dirección hacia el héroe desde un punto, según el campo actual.
+     */
+    glm::vec2 sample(float x, float z) const { return _current.sample(x, z); }
+
+    /**
+     * @brief Construye un campo completo en el hilo que llama.
+     *
+     * @param settings Tamaño de la ventana y criterio de obstáculos.
+     * @param goal Posición del héroe en el plano XZ.
+     * @param terrainTiles Tiles de los que se muestrean las alturas.
+     * @param field Destino; reutiliza su memoria.
+     * @param heap Montículo de trabajo de Dijkstra; se reutiliza entre construcciones.
+     */
+    static void build(const Settings& settings, const glm::vec2& goal, const std::vector<std::shared_ptr<Terrain>>& terrainTiles,
+                      Field& field, std::vector<std::pair<float, int>>& heap);
+
+private:
+    void _workerMain();
+
+    Settings _settings;
+    Field _current;                         // solo lo lee la simulación
+    glm::ivec2 _requestedCell = glm::ivec2(INT32_MIN);
+    std::vector<std::pair<float, int>> _heap;   // montículo de la construcción síncrona
+
+    // Compartido con el hilo de fondo
+    std::mutex _mutex;
+    std::condition_variable _requestAvailable;
+    bool _hasRequest = false;
+    glm::vec2 _requestGoal = glm::vec2(0.0f);
+    std::vector<std::shared_ptr<Terrain>> _requestTiles;
+    Field _ready;                           // último campo terminado, aún no adoptado
+    bool _hasReady = false;
+    bool _stopping = false;
+
+    std::thread _worker;
+};
+
+#endif // ENEMIES_FLOW_FIELD_H
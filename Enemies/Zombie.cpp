@@ -1,20 +1,8 @@
 #include "Zombie.h"
 #include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
-#include <objects.hpp>
 #include <OpenGLUtils.hpp>
 
-Zombie::Zombie(GLuint shaderProgramHandle, GLint mvpMtxUniformLocation, GLint normalMtxUniformLocation)
-    : _shaderProgramHandle(shaderProgramHandle) {
-
-    _shaderProgramUniformLocations.mvpMtx    = mvpMtxUniformLocation;
-    _shaderProgramUniformLocations.normalMtx = normalMtxUniformLocation;
-
-    _shaderProgramUniformLocations.materialAmbientColor  = glGetUniformLocation(_shaderProgramHandle, "materialAmbientColor");
-    _shaderProgramUniformLocations.materialDiffuseColor  = glGetUniformLocation(_shaderProgramHandle, "materialDiffuseColor");
-    _shaderProgramUniformLocations.materialSpecularColor = glGetUniformLocation(_shaderProgramHandle, "materialSpecularColor");
-    _shaderProgramUniformLocations.materialShininess     = glGetUniformLocation(_shaderProgramHandle, "materialShininess");
-
+Zombie::Zombie() {
 
     _colorBody = glm::vec3(0.0f, 0.0f, 1.0f); // Cuerpo azul
     _colorHead = glm::vec3(0.0f, 1.0f, 0.0f); // Cabeza verde
@@ -25,106 +13,119 @@ Zombie::Zombie(GLuint shaderProgramHandle, GLint mvpMtxUniformLocation, GLint no
     position = glm::vec3(0.0f);
 }
 
-void Zombie::drawVehicle(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) {
+void Zombie::emitDrawItems(glm::mat4 modelMtx, std::vector<DrawItem>& drawItems) const {
 
     modelMtx = glm::translate(modelMtx, position);
     modelMtx = glm::rotate(modelMtx, rotationAngle, CSCI441::Y_AXIS);
 
-    _drawBody(modelMtx, viewMtx, projMtx);
-    _drawArmRight(modelMtx, viewMtx, projMtx);
-    _drawArmLeft(modelMtx, viewMtx, projMtx);
-    _drawHead(modelMtx, viewMtx, projMtx);
-    _drawFace(modelMtx, viewMtx, projMtx);
-    _drawCones(modelMtx, viewMtx, projMtx);
-    _drawBag(modelMtx, viewMtx, projMtx);
+    _emitBody(modelMtx, drawItems);
+    _emitArmRight(modelMtx, drawItems);
+    _emitArmLeft(modelMtx, drawItems);
+    _emitHead(modelMtx, drawItems);
+    _emitFace(modelMtx, drawItems);
+    _emitCones(modelMtx, drawItems);
+    _emitBag(modelMtx, drawItems);
 }
 
-void Zombie::moveForward() {
+void Zombie::moveForward(float deltaTime) {
+    // Los zombies lejanos se actualizan cada varios ticks con todo el tiempo acumulado: el paso
+    // se recorta al límite para que el brazo no lo pase
+    const float step = _armSwingSpeed * deltaTime;
 
     if (_leftArmSwingForward) {
-        _leftArmAngle += _armSwingSpeed;
+        _leftArmAngle += step;
         if (_leftArmAngle >= _armSwingLimit) {
+            _leftArmAngle = _armSwingLimit;
             _leftArmSwingForward = false;
         }
     } else {
-        _leftArmAngle -= _armSwingSpeed;
+        _leftArmAngle -= step;
         if (_leftArmAngle <= -_armSwingLimit) {
+            _leftArmAngle = -_armSwingLimit;
             _leftArmSwingForward = true;
         }
     }
 
     if (_rightArmSwingForward) {
-        _rightArmAngle += _armSwingSpeed;
+        _rightArmAngle += step;
         if (_rightArmAngle >= _armSwingLimit) {
+            _rightArmAngle = _armSwingLimit;
             _rightArmSwingForward = false;
         }
     } else {
-        _rightArmAngle -= _armSwingSpeed;
+        _rightArmAngle -= step;
         if (_rightArmAngle <= -_armSwingLimit) {
+            _rightArmAngle = -_armSwingLimit;
             _rightArmSwingForward = true;
         }
     }
 }
 
-void Zombie::moveBackward() {
+void Zombie::moveBackward(float deltaTime) {
+    const float step = _armSwingSpeed * deltaTime;
+
     if (_leftArmSwingForward) {
-        _leftArmAngle += _armSwingSpeed;
+        _leftArmAngle += step;
         if (_leftArmAngle >= _armSwingLimit) {
+            _leftArmAngle = _armSwingLimit;
             _leftArmSwingForward = false;
         }
     } else {
-        _leftArmAngle -= _armSwingSpeed;
+        _leftArmAngle -= step;
         if (_leftArmAngle <= -_armSwingLimit) {
+            _leftArmAngle = -_armSwingLimit;
             _leftArmSwingForward = true;
         }
     }
 
     if (_rightArmSwingForward) {
-        _rightArmAngle += _armSwingSpeed;
+        _rightArmAngle += step;
         if (_rightArmAngle >= _armSwingLimit) {
+            _rightArmAngle = _armSwingLimit;
             _rightArmSwingForward = false;
         }
     } else {
-        _rightArmAngle -= _armSwingSpeed;
+        _rightArmAngle -= step;
         if (_rightArmAngle <= -_armSwingLimit) {
+            _rightArmAngle = -_armSwingLimit;
             _rightArmSwingForward = true;
         }
     }
 }
 
-void Zombie::update(float deltaTime) {
-    // Implementa aquí la lógica de actualización del zombie.
-    // Por ejemplo, hacer que el zombie patrulle girando y moviéndose lentamente.
-
-    // Rotación continua
-    float rotationSpeed = glm::radians(20.0f); // 20 grados por segundo
-    rotationAngle += rotationSpeed * deltaTime;
-
-    // Mantener el ángulo dentro de [0, 2π]
-    if (rotationAngle > glm::two_pi<float>())
-        rotationAngle -= glm::two_pi<float>();
-    else if (rotationAngle < 0.0f)
-        rotationAngle += glm::two_pi<float>();
-
-    // Movimiento lento hacia adelante
-    float moveSpeed = 1.0f * deltaTime; // 1 unidad por segundo
-    position += glm::vec3(0.0f, 0.0f, -moveSpeed); // Mover hacia adelante en el eje Z
+void Zombie::update(float deltaTime, const glm::vec2& velocity) {
+    _velocity = velocity;
+
+    // Sin dirección (fuera del campo, inalcanzable o cerrado por otros zombies): patrulla
+    // girando en su lugar
+    const float minimumSpeed = 0.05f;
+    if (glm::dot(velocity, velocity) < minimumSpeed * minimumSpeed) {
+        float rotationSpeed = glm::radians(20.0f); // 20 grados por segundo
+        rotationAngle += rotationSpeed * deltaTime;
+
+        // Mantener el ángulo dentro de [0, 2π]
+        if (rotationAngle > glm::two_pi<float>())
+            rotationAngle -= glm::two_pi<float>();
+        else if (rotationAngle < 0.0f)
+            rotationAngle += glm::two_pi<float>();
+        return;
+    }
 
-    // Opcional: Agregar límites de movimiento o lógica adicional
+    // Avanza mirando hacia donde camina; el frente del modelo es -Z
+    position.x += velocity.x * deltaTime;
+    position.z += velocity.y * deltaTime;
+    rotationAngle = atan2f(-velocity.x, -velocity.y);
+    moveForward(deltaTime);
 }
 
-void Zombie::_drawBody(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Zombie::_emitBody(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 bodyMtx = modelMtx;
     bodyMtx = glm::scale(bodyMtx, glm::vec3(0.8f, 2.0f, 0.5f));
 
-    _computeAndSendMatrixUniforms(bodyMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorBody, 64.0f);
-
-    CSCI441::drawSolidCube(1.0f);
+    drawItems.push_back(DrawItem::make(DrawMesh::CUBE, bodyMtx, _colorBody, 64.0f));
 }
 
-void Zombie::_drawArmLeft(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Zombie::_emitArmLeft(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 armMtx = modelMtx;
 
     armMtx = glm::translate(armMtx, glm::vec3(-0.55f, 0.7f, 0.0f));
@@ -135,14 +136,10 @@ void Zombie::_drawArmLeft(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projM
 
     armMtx = glm::scale(armMtx, glm::vec3(0.30f, 0.9f, 0.3f));
 
-    _computeAndSendMatrixUniforms(armMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorArm, 64.0f); // Usar color de brazos
-
-    CSCI441::drawSolidCube(1.0f);
+    drawItems.push_back(DrawItem::make(DrawMesh::CUBE, armMtx, _colorArm, 64.0f)); // Usar color de brazos
 }
 
-void Zombie::_drawArmRight(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Zombie::_emitArmRight(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 armMtx = modelMtx;
 
     armMtx = glm::translate(armMtx, glm::vec3(0.55f, 0.7f, 0.0f));
@@ -153,49 +150,33 @@ void Zombie::_drawArmRight(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 proj
 
     armMtx = glm::scale(armMtx, glm::vec3(0.30f, 0.9f, 0.3f));
 
-    _computeAndSendMatrixUniforms(armMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorArm, 64.0f); // Usar color de brazos
-
-    CSCI441::drawSolidCube(1.0f);
+    drawItems.push_back(DrawItem::make(DrawMesh::CUBE, armMtx, _colorArm, 64.0f)); // Usar color de brazos
 }
 
-void Zombie::_drawHead(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Zombie::_emitHead(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 headMtx = modelMtx;
     headMtx = glm::translate(headMtx, glm::vec3(0.0f, 1.1f, 0.0f));
     headMtx = glm::scale(headMtx, glm::vec3(0.8f));
 
-    _computeAndSendMatrixUniforms(headMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorHead, 16.0f);
-
-    CSCI441::drawSolidSphere(1.0f, 20, 20);
+    drawItems.push_back(DrawItem::make(DrawMesh::SPHERE, headMtx, _colorHead, 16.0f));
 }
 
-void Zombie::_drawFace(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Zombie::_emitFace(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 faceMtx = modelMtx;
     faceMtx = glm::translate(faceMtx, glm::vec3(0.0f, 1.1f, -0.18f));
     faceMtx = glm::scale(faceMtx, glm::vec3(0.7f));
 
-    _computeAndSendMatrixUniforms(faceMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorFace, 16.0f);
-
-    CSCI441::drawSolidSphere(1.0f, 20, 20);
+    drawItems.push_back(DrawItem::make(DrawMesh::SPHERE, faceMtx, _colorFace, 16.0f));
 }
 
-void Zombie::_drawCones(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Zombie::_emitCones(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
 
     glm::mat4 coneRightMtx = modelMtx;
     coneRightMtx = glm::translate(coneRightMtx, glm::vec3(0.7f, 1.0f, 0.0f));
     coneRightMtx = glm::rotate(coneRightMtx, glm::radians(-90.0f), CSCI441::Z_AXIS);
     coneRightMtx = glm::scale(coneRightMtx, glm::vec3(0.25f, 0.6f, 0.25f));
 
-    _computeAndSendMatrixUniforms(coneRightMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorFace, 16.0f);
-
-    CSCI441::drawSolidCone(1.0f, 1.0f, 20, 20);
+    drawItems.push_back(DrawItem::make(DrawMesh::CONE, coneRightMtx, _colorFace, 16.0f));
 
 
     glm::mat4 coneLeftMtx = modelMtx;
@@ -203,40 +184,13 @@ void Zombie::_drawCones(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx
     coneLeftMtx = glm::rotate(coneLeftMtx, glm::radians(90.0f), CSCI441::Z_AXIS);
     coneLeftMtx = glm::scale(coneLeftMtx, glm::vec3(0.25f, 0.6f, 0.25f));
 
-    _computeAndSendMatrixUniforms(coneLeftMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorFace, 32.0f);
-
-    CSCI441::drawSolidCone(1.0f, 1.0f, 20, 20);
+    drawItems.push_back(DrawItem::make(DrawMesh::CONE, coneLeftMtx, _colorFace, 32.0f));
 }
 
-void Zombie::_drawBag(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Zombie::_emitBag(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 bagMtx = modelMtx;
     bagMtx = glm::translate(bagMtx, glm::vec3(0.0f, 0.0f, 0.35f));
     bagMtx = glm::scale(bagMtx, glm::vec3(0.4f, 0.6f, 0.3f));
 
-    _computeAndSendMatrixUniforms(bagMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorBag, 64.0f);
-
-    CSCI441::drawSolidCube(1.0f);
-}
-
-void Zombie::_computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
-    glm::mat4 mvpMtx = projMtx * viewMtx * modelMtx;
-    glProgramUniformMatrix4fv(_shaderProgramHandle, _shaderProgramUniformLocations.mvpMtx, 1, GL_FALSE, glm::value_ptr(mvpMtx));
-
-    glm::mat3 normalMtx = glm::transpose(glm::inverse(glm::mat3(modelMtx)));
-    glProgramUniformMatrix3fv(_shaderProgramHandle, _shaderProgramUniformLocations.normalMtx, 1, GL_FALSE, glm::value_ptr(normalMtx));
-}
-
-void Zombie::_setMaterialColors(glm::vec3 color, float shininess) const {
-    glm::vec3 ambientColor  = color * 0.2f;
-    glm::vec3 diffuseColor  = color;
-    glm::vec3 specularColor = glm::vec3(0.5f);
-
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialAmbientColor, 1, glm::value_ptr(ambientColor));
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialDiffuseColor, 1, glm::value_ptr(diffuseColor));
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialSpecularColor, 1, glm::value_ptr(specularColor));
-    glProgramUniform1f(_shaderProgramHandle, _shaderProgramUniformLocations.materialShininess, shininess);
+    drawItems.push_back(DrawItem::make(DrawMesh::CUBE, bagMtx, _colorBag, 64.0f));
 }
@@ -1,40 +1,41 @@
 #ifndef ZOMBIE_H
 #define ZOMBIE_H
 
-#include <glad/gl.h> // Mantener esta inclusión
+#include "../Render/FramePacket.h"
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <vector>
+
 class Zombie {
 public:
-    Zombie(GLuint shaderProgramHandle, GLint mvpMtxUniformLocation, GLint normalMtxUniformLocation);
+    // Velocidad con la que persigue al héroe, en unidades por segundo
+    static constexpr float WALK_SPEED = 1.5f;
+
+    Zombie();
 
-    void drawVehicle(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx);
+    // Agrega las piezas del zombie al paquete del frame
+    void emitDrawItems(glm::mat4 modelMtx, std::vector<DrawItem>& drawItems) const;
 
-    void moveForward();
-    void moveBackward();
+    // Balancean los brazos; deltaTime en segundos
+    void moveForward(float deltaTime);
+    void moveBackward(float deltaTime);
 
     glm::vec3 getPosition() const { return position; }
+    void setPosition(const glm::vec3& newPosition) { position = newPosition; }
     float getRotationAngle() const { return rotationAngle; }
+    glm::vec2 getVelocity() const { return _velocity; }
 
     /**
      * @brief Actualiza el estado del zombie.
      * @param deltaTime Tiempo transcurrido desde la última actualización.
+     * @param velocity Velocidad en el plano XZ, en unidades por segundo; casi nula lo deja
+     * girando en su lugar. La altura la ajusta quien lo llama.
      */
-    void update(float deltaTime); // Declaración del método update
+    void update(float deltaTime, const glm::vec2& velocity);
 
 private:
-    GLuint _shaderProgramHandle;
-    struct ShaderProgramUniformLocations {
-        GLint mvpMtx;
-        GLint normalMtx;
-        GLint materialAmbientColor;
-        GLint materialDiffuseColor;
-        GLint materialSpecularColor;
-        GLint materialShininess;
-    } _shaderProgramUniformLocations;
-
     glm::vec3 _colorBody;
     glm::vec3 _colorHead;
     glm::vec3 _colorFace;
@@ -43,23 +44,21 @@ private:
 
     glm::vec3 position;
     float rotationAngle = 0.0f;
+    glm::vec2 _velocity = glm::vec2(0.0f);
 
-    void _drawBody(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-    void _drawArmRight(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-    void _drawArmLeft(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-    void _drawHead(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-    void _drawFace(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-    void _drawCones(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-    void _drawBag(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-
-    void _computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-    void _setMaterialColors(glm::vec3 color, float shininess) const;
+    void _emitBody(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const;
+    void _emitArmRight(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const;
+    void _emitArmLeft(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const;
+    void _emitHead(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const;
+    void _emitFace(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const;
+    void _emitCones(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const;
+    void _emitBag(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const;
 
     float _leftArmAngle = 0.0f;
     float _rightArmAngle = 0.0f;
     bool _leftArmSwingForward = true;
     bool _rightArmSwingForward = false;
-    float _armSwingSpeed = glm::radians(1.0f);
+    float _armSwingSpeed = glm::radians(60.0f);     // por segundo: el grado por frame de antes a 60 Hz
     float _armSwingLimit = glm::radians(30.0f);
 };
 
@@ -1,24 +1,13 @@
 #include "Aaron_Inti.h"
 
 #include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
 
-#include <objects.hpp>
 #include <OpenGLUtils.hpp>
 
-Aaron_Inti::Aaron_Inti(GLuint shaderProgramHandle, GLint mvpMtxUniformLocation, GLint normalMtxUniformLocation)
-    : _shaderProgramHandle(shaderProgramHandle) {
+Aaron_Inti::Aaron_Inti() {
     _propAngle = 0.0f;
     _propAngleRotationSpeed = _PI / 16.0f;
 
-    _shaderProgramUniformLocations.mvpMtx    = mvpMtxUniformLocation;
-    _shaderProgramUniformLocations.normalMtx = normalMtxUniformLocation;
-
-    _shaderProgramUniformLocations.materialAmbientColor  = glGetUniformLocation(_shaderProgramHandle, "materialAmbientColor");
-    _shaderProgramUniformLocations.materialDiffuseColor  = glGetUniformLocation(_shaderProgramHandle, "materialDiffuseColor");
-    _shaderProgramUniformLocations.materialSpecularColor = glGetUniformLocation(_shaderProgramHandle, "materialSpecularColor");
-    _shaderProgramUniformLocations.materialShininess     = glGetUniformLocation(_shaderProgramHandle, "materialShininess");
-
     _colorBody = glm::vec3(1.0f, 1.0f, 1.0f);
     _scaleBody = glm::vec3(2.0f, 1.5f, 6.0f);
 
@@ -55,13 +44,13 @@ Aaron_Inti::Aaron_Inti(GLuint shaderProgramHandle, GLint mvpMtxUniformLocation,
     _isMovingBackward = false;
 }
 
-void Aaron_Inti::drawVehicle(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) {
-    _drawCarBody(modelMtx, viewMtx, projMtx);
-    _drawCarTop(modelMtx, viewMtx, projMtx);
-    _drawCarWindows(modelMtx, viewMtx, projMtx);
-    _drawCarWheels(modelMtx, viewMtx, projMtx);
-    _drawCarPropeller(modelMtx, viewMtx, projMtx);
-    _drawCarHeadlights(modelMtx, viewMtx, projMtx);
+void Aaron_Inti::emitDrawItems(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
+    _emitCarBody(modelMtx, drawItems);
+    _emitCarTop(modelMtx, drawItems);
+    _emitCarWindows(modelMtx, drawItems);
+    _emitCarWheels(modelMtx, drawItems);
+    _emitCarPropeller(modelMtx, drawItems);
+    _emitCarHeadlights(modelMtx, drawItems);
 }
 
 void Aaron_Inti::moveForward() {
@@ -88,30 +77,22 @@ void Aaron_Inti::moveBackward() {
     }
 }
 
-void Aaron_Inti::_drawCarBody(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Aaron_Inti::_emitCarBody(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 bodyMtx = modelMtx;
     bodyMtx = glm::scale(bodyMtx, _scaleBody);
 
-    _computeAndSendMatrixUniforms(bodyMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorBody, 32.0f);
-
-    CSCI441::drawSolidCube(1.0f);
+    drawItems.push_back(DrawItem::make(DrawMesh::CUBE, bodyMtx, _colorBody, 32.0f));
 }
 
-void Aaron_Inti::_drawCarTop(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Aaron_Inti::_emitCarTop(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 topMtx = modelMtx;
     topMtx = glm::translate(topMtx, _transTop);
     topMtx = glm::scale(topMtx, _scaleTop);
 
-    _computeAndSendMatrixUniforms(topMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorTop, 16.0f);
-
-    CSCI441::drawSolidCube(1.0f);
+    drawItems.push_back(DrawItem::make(DrawMesh::CUBE, topMtx, _colorTop, 16.0f));
 }
 
-void Aaron_Inti::_drawCarWheels(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Aaron_Inti::_emitCarWheels(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     int numSpokes = 8;
     for (int i = 0; i < 4; ++i) {
         glm::mat4 wheelMtx = modelMtx;
@@ -120,11 +101,7 @@ void Aaron_Inti::_drawCarWheels(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4
         wheelMtx = glm::rotate(wheelMtx, _propAngle, CSCI441::Y_AXIS);
         wheelMtx = glm::scale(wheelMtx, _scaleWheel);
 
-        _computeAndSendMatrixUniforms(wheelMtx, viewMtx, projMtx);
-
-        _setMaterialColors(_colorWheel, 10.0f);
-
-        CSCI441::drawSolidCylinder(0.5f, 0.5f, 0.2f, 16, 16);
+        drawItems.push_back(DrawItem::make(DrawMesh::CYLINDER, wheelMtx, _colorWheel, 10.0f));
 
         for (int j = 0; j < numSpokes; ++j) {
             glm::mat4 spokeMtx = wheelMtx;
@@ -132,27 +109,21 @@ void Aaron_Inti::_drawCarWheels(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4
             spokeMtx = glm::translate(spokeMtx, glm::vec3(0.0f, 0.0f, 0.25f));
             spokeMtx = glm::scale(spokeMtx, glm::vec3(0.05f, 0.05f, 0.5f));
 
-            _computeAndSendMatrixUniforms(spokeMtx, viewMtx, projMtx);
-
-            CSCI441::drawSolidCube(1.0f);
+            drawItems.push_back(DrawItem::make(DrawMesh::CUBE, spokeMtx, _colorWheel, 10.0f));
         }
     }
 }
 
-void Aaron_Inti::_drawCarPropeller(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Aaron_Inti::_emitCarPropeller(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::mat4 propMtx = modelMtx;
     propMtx = glm::translate(propMtx, _transProp);
     propMtx = glm::rotate(propMtx, _propAngle, CSCI441::Z_AXIS);
     propMtx = glm::scale(propMtx, _scaleProp);
 
-    _computeAndSendMatrixUniforms(propMtx, viewMtx, projMtx);
-
-    _setMaterialColors(_colorProp, 32.0f);
-
-    CSCI441::drawSolidCube(1.0f);
+    drawItems.push_back(DrawItem::make(DrawMesh::CUBE, propMtx, _colorProp, 32.0f));
 }
 
-void Aaron_Inti::_drawCarHeadlights(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) {
+void Aaron_Inti::_emitCarHeadlights(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     glm::vec3 headlightColor;
 
     if (_isMovingBackward) {
@@ -165,15 +136,11 @@ void Aaron_Inti::_drawCarHeadlights(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::
         glm::mat4 lightMtx = modelMtx;
         lightMtx = glm::translate(lightMtx, _headlightPositions[i]);
         lightMtx = glm::scale(lightMtx, _scaleHeadlight);
-        _computeAndSendMatrixUniforms(lightMtx, viewMtx, projMtx);
-
-        _setMaterialColors(headlightColor, 64.0f);
-
-        CSCI441::drawSolidCube(1.0f);
+        drawItems.push_back(DrawItem::make(DrawMesh::CUBE, lightMtx, headlightColor, 64.0f));
     }
 }
 
-void Aaron_Inti::_drawCarWindows(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
+void Aaron_Inti::_emitCarWindows(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems) const {
     for (int i = 0; i < 2; ++i) {
         glm::mat4 windowMtx = modelMtx;
 
@@ -181,29 +148,6 @@ void Aaron_Inti::_drawCarWindows(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat
 
         windowMtx = glm::scale(windowMtx, _scaleWindow);
 
-        _computeAndSendMatrixUniforms(windowMtx, viewMtx, projMtx);
-
-        _setMaterialColors(_colorWindow, 16.0f);
-
-        CSCI441::drawSolidCube(1.0f);
+        drawItems.push_back(DrawItem::make(DrawMesh::CUBE, windowMtx, _colorWindow, 16.0f));
     }
 }
-
-void Aaron_Inti::_computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
-    glm::mat4 mvpMtx = projMtx * viewMtx * modelMtx;
-    glProgramUniformMatrix4fv(_shaderProgramHandle, _shaderProgramUniformLocations.mvpMtx, 1, GL_FALSE, glm::value_ptr(mvpMtx));
-
-    glm::mat3 normalMtx = glm::mat3(glm::transpose(glm::inverse(modelMtx)));
-    glProgramUniformMatrix3fv(_shaderProgramHandle, _shaderProgramUniformLocations.normalMtx, 1, GL_FALSE, glm::value_ptr(normalMtx));
-}
-
-void Aaron_Inti::_setMaterialColors(glm::vec3 color, float shininess) const {
-    glm::vec3 ambientColor  = color * 0.2f;
-    glm::vec3 diffuseColor  = color;
-    glm::vec3 specularColor = glm::vec3(0.5f);
-
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialAmbientColor, 1, glm::value_ptr(ambientColor));
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialDiffuseColor, 1, glm::value_ptr(diffuseColor));
-    glProgramUniform3fv(_shaderProgramHandle, _shaderProgramUniformLocations.materialSpecularColor, 1, glm::value_ptr(specularColor));
-    glProgramUniform1f(_shaderProgramHandle, _shaderProgramUniformLocations.materialShininess, shininess);
-}
\ No newline at end of file
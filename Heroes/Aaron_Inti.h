@@ -1,16 +1,19 @@
 #ifndef LAB05_PLANE_H
 #define LAB05_PLANE_H
 
-#include <glad/gl.h>
+#include "../Render/FramePacket.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/constants.hpp>
 
+#include <vector>
+
 class Aaron_Inti {
 public:
-    Aaron_Inti(GLuint shaderProgramHandle, GLint mvpMtxUniformLocation, GLint normalMtxUniformLocation);
+    Aaron_Inti();
 
-    void drawVehicle( glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx );
+    // Agrega las piezas del vehículo al paquete del frame
+    void emitDrawItems( const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems ) const;
 
     void moveForward();
     void moveBackward();
@@ -24,16 +27,6 @@ private:
     GLfloat _propAngle;
     GLfloat _propAngleRotationSpeed;
 
-    GLuint _shaderProgramHandle;
-    struct ShaderProgramUniformLocations {
-        GLint mvpMtx;
-        GLint normalMtx;
-        GLint materialAmbientColor;
-        GLint materialDiffuseColor;
-        GLint materialSpecularColor;
-        GLint materialShininess;
-    } _shaderProgramUniformLocations;
-
     glm::vec3 _colorBody;
     glm::vec3 _scaleBody;
 
@@ -63,15 +56,12 @@ private:
     const GLfloat _2PI = glm::two_pi<float>();
     const GLfloat _PI_OVER_2 = glm::half_pi<float>();
 
-    void _drawCarBody(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx ) const;
-    void _drawCarTop(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx ) const;
-    void _drawCarWheels(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx ) const;
-    void _drawCarPropeller(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx ) const;
-    void _drawCarHeadlights(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx );
-    void _drawCarWindows(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx ) const;
-
-    void _computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-    void _setMaterialColors(glm::vec3 color, float shininess) const;
+    void _emitCarBody(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems ) const;
+    void _emitCarTop(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems ) const;
+    void _emitCarWheels(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems ) const;
+    void _emitCarPropeller(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems ) const;
+    void _emitCarHeadlights(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems ) const;
+    void _emitCarWindows(const glm::mat4& modelMtx, std::vector<DrawItem>& drawItems ) const;
 };
 
 #endif //LAB05_PLANE_H
@@ -0,0 +1,41 @@
+#ifndef INPUT_INPUT_EVENT_H
+#define INPUT_INPUT_EVENT_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @struct InputEvent
+ * @brief Evento de entrada capturado en un callback de GLFW.
+ *
+ * Los callbacks solo construyen el evento y lo encolan; la simulación lo aplica en su
+ * siguiente tick.
+ */
+struct InputEvent {
+    enum class Type : uint8_t { KEY, MOUSE_BUTTON, CURSOR };
+
+    Type type;
+    int32_t code;           // tecla o botón de GLFW
+    int32_t action;         // GLFW_PRESS, GLFW_RELEASE o GLFW_REPEAT
+    float x, y;             // posición del cursor
+    uint64_t timestampNs;   // reloj monotónico de alta resolución
+
+    static uint64_t now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    static InputEvent key(int32_t key, int32_t action) {
+        return { Type::KEY, key, action, 0.0f, 0.0f, now() };
+    }
+
+    static InputEvent mouseButton(int32_t button, int32_t action) {
+        return { Type::MOUSE_BUTTON, button, action, 0.0f, 0.0f, now() };
+    }
+
+    static InputEvent cursor(float x, float y) {
+        return { Type::CURSOR, 0, 0, x, y, now() };
+    }
+};
+
+#endif // INPUT_INPUT_EVENT_H
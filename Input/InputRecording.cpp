@@ -0,0 +1,144 @@
+#include "InputRecording.h"
+
+#include <cstring>
+
+namespace {
+    const char MAGIC[4] = { 'M', 'P', 'I', 'R' };
+    const uint16_t VERSION = 2;
+
+    template<typename T>
+    void write(FILE* pFile, T value) {
+        fwrite(&value, sizeof(T), 1, pFile);
+    }
+
+    template<typename T>
+    bool read(FILE* pFile, T& value) {
+        return fread(&value, sizeof(T), 1, pFile) == 1;
+    }
+}
+
+//*************************************************************************************
+//
+// InputRecorder
+
+InputRecorder::~InputRecorder() {
+    close();
+}
+
+bool InputRecorder::open(const char* FILENAME, uint32_t randomSeed) {
+    close();
+
+    _pFile = fopen(FILENAME, "wb");
+    if (_pFile == nullptr) {
+        fprintf(stderr, "[ERROR]: Could not open input recording \"%s\" for writing\n", FILENAME);
+        return false;
+    }
+
+    fwrite(MAGIC, sizeof(MAGIC), 1, _pFile);
+    write(_pFile, VERSION);
+    write(_pFile, randomSeed);
+    _numTicks = 0;
+
+    fprintf(stdout, "[INFO]: Recording input to \"%s\" (seed %u)\n", FILENAME, randomSeed);
+    return true;
+}
+
+void InputRecorder::recordTick(float deltaTime, int framebufferWidth, int framebufferHeight, const std::vector<InputEvent>& events) {
+    if (_pFile == nullptr) return;
+
+    write(_pFile, deltaTime);
+    write(_pFile, static_cast<uint16_t>(framebufferWidth));
+    write(_pFile, static_cast<uint16_t>(framebufferHeight));
+    write(_pFile, static_cast<uint16_t>(events.size()));
+    for (const InputEvent& event : events) {
+        write(_pFile, static_cast<uint8_t>(event.type));
+        write(_pFile, static_cast<int16_t>(event.code));
+        write(_pFile, static_cast<int8_t>(event.action));
+        if (event.type == InputEvent::Type::CURSOR) {
+            write(_pFile, event.x);
+            write(_pFile, event.y);
+        }
+    }
+    ++_numTicks;
+}
+
+void InputRecorder::close() {
+    if (_pFile == nullptr) return;
+
+    fclose(_pFile);
+    _pFile = nullptr;
+    fprintf(stdout, "[INFO]: Input recording closed after %llu ticks\n", static_cast<unsigned long long>(_numTicks));
+}
+
+//*************************************************************************************
+//
+// InputReplay
+
+InputReplay::~InputReplay() {
+    close();
+}
+
+bool InputReplay::open(const char* FILENAME) {
+    close();
+
+    _pFile = fopen(FILENAME, "rb");
+    if (_pFile == nullptr) {
+        fprintf(stderr, "[ERROR]: Could not open input recording \"%s\"\n", FILENAME);
+        return false;
+    }
+
+    char magic[4];
+    uint16_t version;
+    if (fread(magic, sizeof(magic), 1, _pFile) != 1 || memcmp(magic, MAGIC, sizeof(MAGIC)) != 0
+        || !read(_pFile, version) || version != VERSION
+        || !read(_pFile, _randomSeed)) {
+        fprintf(stderr, "[ERROR]: \"%s\" is not a version %u input recording\n", FILENAME, VERSION);
+        fclose(_pFile);
+        _pFile = nullptr;
+        return false;
+    }
+    _numTicks = 0;
+
+    fprintf(stdout, "[INFO]: Replaying input from \"%s\" (seed %u)\n", FILENAME, _randomSeed);
+    return true;
+}
+
+bool InputReplay::nextTick(float& deltaTime, int& framebufferWidth, int& framebufferHeight, std::vector<InputEvent>& events) {
+    events.clear();
+    if (_pFile == nullptr) return false;
+
+    uint16_t width, height, numEvents;
+    if (!read(_pFile, deltaTime) || !read(_pFile, width) || !read(_pFile, height) || !read(_pFile, numEvents)) {
+        return false;
+    }
+    framebufferWidth = width;
+    framebufferHeight = height;
+
+    for (uint16_t i = 0; i < numEvents; ++i) {
+        uint8_t type;
+        int16_t code;
+        int8_t action;
+        if (!read(_pFile, type) || !read(_pFile, code) || !read(_pFile, action)) {
+            fprintf(stderr, "[ERROR]: Input recording truncated at tick %llu\n", static_cast<unsigned long long>(_numTicks));
+            return false;
+        }
+
+        InputEvent event = { static_cast<InputEvent::Type>(type), code, action, 0.0f, 0.0f, 0 };
+        if (event.type == InputEvent::Type::CURSOR && (!read(_pFile, event.x) || !read(_pFile, event.y))) {
+            fprintf(stderr, "[ERROR]: Input recording truncated at tick %llu\n", static_cast<unsigned long long>(_numTicks));
+            return false;
+        }
+        events.push_back(event);
+    }
+
+    ++_numTicks;
+    return true;
+}
+
+void InputReplay::close() {
+    if (_pFile == nullptr) return;
+
+    fclose(_pFile);
+    _pFile = nullptr;
+    fprintf(stdout, "[INFO]: Input replay finished after %llu ticks\n", static_cast<unsigned long long>(_numTicks));
+}
@@ -0,0 +1,100 @@
+#ifndef INPUT_INPUT_RECORDING_H
+#define INPUT_INPUT_RECORDING_H
+
+#include "InputEvent.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+/**
+ * Formato del archivo de grabación (little endian):
+ *
+ *   cabecera: "MPIR" | uint16 versión | uint32 semilla de rand()
+ *   por tick: float deltaTime | uint16 ancho | uint16 alto | uint16 número de eventos | eventos
+ *   evento:   uint8 tipo | int16 código | int8 acción | [float x, float y solo para CURSOR]
+ *
+ * Los timestamps no se guardan: en la reproducción cada evento se aplica en el mismo tick
+ * y en el mismo orden en que se grabó, que es lo que determina el estado de la simulación.
+ * El tamaño del framebuffer se guarda porque la simulación lo usa (giro de la arcball y
+ * visibilidad de los zombies); al reproducir se usa el grabado y no el de la ventana.
+ */
+
+/**
+ * @class InputRecorder
+ * @brief Guarda la entrada de cada tick y la semilla aleatoria en un archivo binario.
+ */
+class InputRecorder {
+public:
+    InputRecorder() = default;
+    ~InputRecorder();
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    /**
+     * @brief Crea el archivo y escribe la cabecera.
+     *
+     * @return false si no se pudo abrir el archivo.
+     */
+    bool open(const char* FILENAME, uint32_t randomSeed);
+
+    /**
+     * @brief Escribe un tick completo con el tamaño del framebuffer que usó la simulación.
+     */
+    void recordTick(float deltaTime, int framebufferWidth, int framebufferHeight, const std::vector<InputEvent>& events);
+
+    /**
+     * @brief Cierra el archivo e informa cuántos ticks se grabaron.
+     */
+    void close();
+
+    bool isOpen() const { return _pFile != nullptr; }
+
+private:
+    FILE* _pFile = nullptr;
+    uint64_t _numTicks = 0;
+};
+
+/**
+ * @class InputReplay
+ * @brief Lee un archivo de InputRecorder tick a tick.
+ */
+class InputReplay {
+public:
+    InputReplay() = default;
+    ~InputReplay();
+
+    InputReplay(const InputReplay&) = delete;
+    InputReplay& operator=(const InputReplay&) = delete;
+
+    /**
+     * @brief Abre el archivo y valida la cabecera.
+     *
+     * @return false si el archivo no existe o no es una grabación válida.
+     */
+    bool open(const char* FILENAME);
+
+    /**
+     * @brief Lee el siguiente tick.
+     *
+     * @param deltaTime Recibe el deltaTime grabado.
+     * @param framebufferWidth Recibe el ancho del framebuffer grabado.
+     * @param framebufferHeight Recibe el alto del framebuffer grabado.
+     * @param events Recibe los eventos del tick (se reemplaza su contenido).
+     * @return false al llegar al final de la grabación.
+     */
+    bool nextTick(float& deltaTime, int& framebufferWidth, int& framebufferHeight, std::vector<InputEvent>& events);
+
+    void close();
+
+    bool isOpen() const { return _pFile != nullptr; }
+    uint32_t getRandomSeed() const { return _randomSeed; }
+
+private:
+    FILE* _pFile = nullptr;
+    uint32_t _randomSeed = 0;
+    uint64_t _numTicks = 0;
+};
+
+#endif // INPUT_INPUT_RECORDING_H
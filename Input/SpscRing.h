@@ -0,0 +1,69 @@
+#ifndef INPUT_SPSC_RING_H
+#define INPUT_SPSC_RING_H
+
+#include <atomic>
+#include <cstddef>
+
+/**
+ * @class SpscRing
+ * @brief Cola circular sin bloqueos para un único productor y un único consumidor.
+ *
+ * push() solo lo llama el productor y pop() solo el consumidor; ninguno reserva memoria ni
+ * toma un mutex. Si la cola está llena push() devuelve false y el evento se descarta.
+ *
+ * @tparam T Tipo de los elementos, copiable trivialmente.
+ * @tparam CAPACITY Número de elementos, potencia de dos.
+ */
+template<typename T, size_t CAPACITY>
+class SpscRing {
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY debe ser potencia de dos");
+
+public:
+    /**
+     * @brief Agrega un elemento al final de la cola (hilo productor).
+     *
+     * @return false si la cola está llena.
+     */
+    bool push(const T& value) {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail - _head.load(std::memory_order_acquire) == CAPACITY) {
+            return false;
+        }
+        _items[tail & MASK] = value;
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Saca el elemento más antiguo (hilo consumidor).
+     *
+     * @return false si la cola está vacía.
+     */
+    bool pop(T& value) {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = _items[head & MASK];
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Número aproximado de elementos en la cola.
+     */
+    size_t size() const {
+        return _tail.load(std::memory_order_acquire) - _head.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr size_t MASK = CAPACITY - 1;
+    static constexpr size_t CACHE_LINE = 64;
+
+    // Índices en líneas de caché distintas para que productor y consumidor no compitan
+    alignas(CACHE_LINE) std::atomic<size_t> _head{0};
+    alignas(CACHE_LINE) std::atomic<size_t> _tail{0};
+    alignas(CACHE_LINE) T _items[CAPACITY];
+};
+
+#endif // INPUT_SPSC_RING_H
@@ -0,0 +1,26 @@
+#include "LightingVariant.h"
+
+#include <string>
+
+CSCI441::ShaderDefines LightingVariant::toDefines() const {
+    return {
+        { "NUM_DIRECTIONAL_LIGHTS", std::to_string(numDirectionalLights) },
+        { "NUM_POINT_LIGHTS",       std::to_string(numPointLights) },
+        { "NUM_SPOT_LIGHTS",        std::to_string(numSpotLights) },
+        { "LIGHTING_MODEL",         std::to_string(static_cast<int>(model)) },
+        { "USE_SKINNING",           useSkinning ? "1" : "0" },
+        { "USE_INSTANCING",         useInstancing ? "1" : "0" },
+        { "USE_MULTIVIEW",          useMultiView ? "1" : "0" },
+        { "MULTIVIEW_VS_VIEWPORT_INDEX", viewportIndexInVertexShader ? "1" : "0" }
+    };
+}
+
+LightingVariant LightingVariant::cheapest(int numDirectionalLights, int numPointLights, int numSpotLights, bool hasSpecular) {
+    LightingVariant variant;
+    variant.numDirectionalLights = numDirectionalLights;
+    variant.numPointLights = numPointLights;
+    variant.numSpotLights = numSpotLights;
+    // Sin especular no hace falta el término de Phong ni el brillo del material
+    variant.model = hasSpecular ? Model::PHONG : Model::LAMBERT;
+    return variant;
+}
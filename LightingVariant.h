@@ -0,0 +1,42 @@
+#ifndef LIGHTING_VARIANT_H
+#define LIGHTING_VARIANT_H
+
+#include <ShaderProgram.hpp>
+
+/**
+ * @struct LightingVariant
+ * @brief Describe una permutación de shaders/A3.v.glsl: cuántas luces de cada tipo evalúa
+ * y qué características se compilan.
+ *
+ * Cada combinación distinta produce un programa diferente dentro de un
+ * CSCI441::ShaderPermutationCache; lo que no se usa queda fuera del código compilado.
+ */
+struct LightingVariant {
+    enum class Model { LAMBERT = 0, PHONG = 1 };
+
+    int numDirectionalLights = 1;
+    int numPointLights = 1;
+    int numSpotLights = 1;
+    Model model = Model::PHONG;
+    bool useSkinning = false;
+    bool useInstancing = false;
+    bool useMultiView = false;              // gl_InstanceID elige la vista del ViewBlock
+    bool viewportIndexInVertexShader = false; // con GL_ARB_shader_viewport_layer_array no hace falta el geometry shader
+
+    /**
+     * @brief Convierte la variante en los #define que espera shaders/A3.v.glsl.
+     */
+    CSCI441::ShaderDefines toDefines() const;
+
+    /**
+     * @brief Devuelve la variante más barata capaz de dibujar un objeto.
+     *
+     * @param numDirectionalLights Luces direccionales que afectan al objeto.
+     * @param numPointLights Luces puntuales que afectan al objeto.
+     * @param numSpotLights Spotlights que afectan al objeto.
+     * @param hasSpecular Si el material tiene brillo especular; si no, basta con Lambert.
+     */
+    static LightingVariant cheapest(int numDirectionalLights, int numPointLights, int numSpotLights, bool hasSpecular);
+};
+
+#endif // LIGHTING_VARIANT_H
@@ -3,14 +3,21 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <ctime>
 #include <algorithm>
-#include <iostream>
 #include <sstream>
 
+// ModelLoader.hpp incluye stb_image.h sin la implementación
+#include <ModelLoader.hpp>
+
 // Definir STB_IMAGE_IMPLEMENTATION antes de incluir stb_image.h
 #define STB_IMAGE_IMPLEMENTATION
 #include <objects.hpp>
 #include <stb_image.h>
 #include "Coin.h"
+#include "Enemies/Zombie.h"
+#include "Heroes/Aaron_Inti.h"
+#include "Memory/AllocationTracker.h"
+#include "Render/DrawItemSubmission.h"
+#include "Render/SoftwareRasterizer.h"
 
 //*************************************************************************************
 //
@@ -46,13 +53,9 @@ MP::MP()
     _arcballCam = new ArcballCam();
     _intiFirstPersonCam = new CSCI441::FreeCam();
 
-    // Inicializar srand para funciones aleatorias si es necesario
-    srand(static_cast<unsigned int>(time(0)));
-
-    // Inicializar punteros a zombies como nullptr
-    for(int i = 0; i < NUM_ZOMBIES; ++i) {
-        _zombies[i] = nullptr;
-    }
+    // Inicializar srand para funciones aleatorias si es necesario; la semilla se graba para reproducir
+    _randomSeed = static_cast<uint32_t>(time(0));
+    srand(_randomSeed);
 }
 
 MP::~MP() {
@@ -60,19 +63,6 @@ MP::~MP() {
     // Eliminar cámaras
     delete _arcballCam;
     delete _intiFirstPersonCam;
-
-    // Eliminar modelos
-    delete _pPlane;
-
-    // Eliminar monedas
-    for(int i = 0; i < 4; ++i) {
-        delete _coins[i];
-    }
-
-    // Eliminar zombies
-    for(int i = 0; i < NUM_ZOMBIES; ++i) {
-        delete _zombies[i];
-    }
 }
 
 void MP::handleKeyEvent(GLint key, GLint action) {
@@ -89,15 +79,17 @@ void MP::handleKeyEvent(GLint key, GLint action) {
             case GLFW_KEY_RIGHT_SHIFT:
                 _isShiftPressed = true;
                 break;
-            case GLFW_KEY_Z:
+            case GLFW_KEY_Z: {
+                const glm::vec3 heroPosition = _heroTransform().position;
                 _currentCameraMode = ARCBALL;
-                _arcballCam->setLookAtPoint(_planePosition + glm::vec3(0.0f, 1.0f, 0.0f));
+                _arcballCam->setLookAtPoint(heroPosition + glm::vec3(0.0f, 1.0f, 0.0f));
                 _arcballCam->setCameraView(
-                    _planePosition + glm::vec3(0.0f, 10.0f, 20.0f),
-                    _planePosition + glm::vec3(0.0f, 1.0f, 0.0f),
+                    heroPosition + glm::vec3(0.0f, 10.0f, 20.0f),
+                    heroPosition + glm::vec3(0.0f, 1.0f, 0.0f),
                     CSCI441::Y_AXIS
                 );
                 break;
+            }
             case GLFW_KEY_X:
                 _currentCameraMode = FIRST_PERSON_CAM;
                 _updateIntiFirstPersonCamera();
@@ -134,22 +126,17 @@ void MP::handleCursorPositionEvent(glm::vec2 currMousePosition) {
         return;
     }
 
-    if (_isLeftMouseButtonPressed) {
+    if (_isLeftMouseButtonPressed && _currentCameraMode == ARCBALL) {
         float deltaX = currMousePosition.x - _mousePosition.x;
         float deltaY = currMousePosition.y - _mousePosition.y;
 
-        int viewportWidth, viewportHeight;
-        glfwGetFramebufferSize(mpWindow, &viewportWidth, &viewportHeight);
-
-        if (_currentCameraMode == ARCBALL) {
-            if (_isShiftPressed) {
-                // Zoom in ArcballCam
-                float sensitivity = 1.0f; // Ajustar sensibilidad
-                _arcballCam->zoom(deltaY * sensitivity);
-            } else {
-                // Rotar ArcballCam
-                _arcballCam->rotate(deltaX, deltaY, viewportWidth, viewportHeight);
-            }
+        if (_isShiftPressed) {
+            // Zoom in ArcballCam
+            float sensitivity = 1.0f; // Ajustar sensibilidad
+            _pendingArcballZoom += deltaY * sensitivity;
+        } else {
+            // Rotar ArcballCam
+            _pendingArcballRotation += glm::vec2(deltaX, deltaY);
         }
         // Eliminado: Manejo de FreeCam
     }
@@ -157,6 +144,88 @@ void MP::handleCursorPositionEvent(glm::vec2 currMousePosition) {
     _mousePosition = currMousePosition;
 }
 
+void MP::pushInputEvent(const InputEvent& event) {
+    if (!_inputQueue.push(event)) {
+        _droppedInputEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void MP::recordInputTo(const char* FILENAME) {
+    _inputRecorder.open(FILENAME, _randomSeed);
+}
+
+void MP::setRandomSeed(uint32_t seed) {
+    _randomSeed = seed;
+    srand(_randomSeed);
+}
+
+void MP::replayInputFrom(const char* FILENAME) {
+    if (_inputReplay.open(FILENAME)) {
+        _randomSeed = _inputReplay.getRandomSeed();
+        srand(_randomSeed);
+    }
+}
+
+void MP::_processInputEvents(float& deltaTime) {
+    // Reunir los eventos que llegaron desde el tick anterior
+    _tickEvents.clear();
+    InputEvent event;
+    while (_inputQueue.pop(event)) {
+        _tickEvents.push_back(event);
+    }
+    glfwGetFramebufferSize(mpWindow, &_tickFramebufferSize.x, &_tickFramebufferSize.y);
+
+    if (_inputReplay.isOpen()) {
+        // Durante la reproducción solo se atiende la tecla de salida real
+        for (const InputEvent& liveEvent : _tickEvents) {
+            if (liveEvent.type == InputEvent::Type::KEY && liveEvent.action == GLFW_PRESS
+                && (liveEvent.code == GLFW_KEY_ESCAPE || liveEvent.code == GLFW_KEY_Q)) {
+                setWindowShouldClose();
+            }
+        }
+        if (!_inputReplay.nextTick(deltaTime, _tickFramebufferSize.x, _tickFramebufferSize.y, _tickEvents)) {
+            _inputReplay.close();
+            setWindowShouldClose();
+            return;
+        }
+    }
+
+    _inputRecorder.recordTick(deltaTime, _tickFramebufferSize.x, _tickFramebufferSize.y, _tickEvents);
+
+    // Aplicar los eventos en el orden en que llegaron
+    for (const InputEvent& tickEvent : _tickEvents) {
+        switch (tickEvent.type) {
+            case InputEvent::Type::KEY:
+                handleKeyEvent(tickEvent.code, tickEvent.action);
+                break;
+            case InputEvent::Type::MOUSE_BUTTON:
+                handleMouseButtonEvent(tickEvent.code, tickEvent.action);
+                break;
+            case InputEvent::Type::CURSOR:
+                handleCursorPositionEvent(glm::vec2(tickEvent.x, tickEvent.y));
+                break;
+        }
+    }
+
+    const uint32_t dropped = _droppedInputEvents.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0) {
+        fprintf(stderr, "[WARN]: input queue full, %u events dropped\n", dropped);
+    }
+
+    // Un solo cálculo de la matriz de vista por tick, sin importar cuántos eventos hubo. El
+    // tamaño es el del tick (el grabado al reproducir), no el de la ventana actual
+    if (_pendingArcballRotation != glm::vec2(0.0f)) {
+        if (_tickFramebufferSize.x > 0 && _tickFramebufferSize.y > 0) {
+            _arcballCam->rotate(_pendingArcballRotation.x, _pendingArcballRotation.y, _tickFramebufferSize.x, _tickFramebufferSize.y);
+        }
+        _pendingArcballRotation = glm::vec2(0.0f);
+    }
+    if (_pendingArcballZoom != 0.0f) {
+        _arcballCam->zoom(_pendingArcballZoom);
+        _pendingArcballZoom = 0.0f;
+    }
+}
+
 //*************************************************************************************
 //
 // Engine Setup
@@ -181,15 +250,78 @@ void MP::mSetupOpenGL() {
 }
 
 void MP::mSetupShaders() {
-    // Obtener el Shader Program
-    _lightingShaderProgram = new CSCI441::ShaderProgram("shaders/A3.v.glsl", "shaders/A3.f.glsl");
+    // Reutilizar los binarios de programas ya enlazados en ejecuciones anteriores
+    CSCI441::ShaderProgram::enableBinaryCache("shader_cache");
+    CSCI441::ShaderProgram::enableParallelShaderCompile();
+
+    // Lanzar la compilación de todos los programas sin esperar al driver
+    // Cada objeto pide la variante más barata que necesita; las variantes se compilan una sola vez
+    _lightingPermutations = new CSCI441::ShaderPermutationCache("shaders/A3.v.glsl", "shaders/A3.f.glsl");
+    // El modo de estrés puede pedir más luces puntuales que la escena normal
+    const int numPointLights = _stressScene.getNumPointLights();
+    _lightingVariant = LightingVariant::cheapest(1, numPointLights, 1, true);
+    _groundVariant = LightingVariant::cheapest(1, numPointLights, 1, false);
+    _lightingShaderProgram = _lightingPermutations->getVariant(_lightingVariant.toDefines());
+    _groundShaderProgram = _lightingPermutations->getVariant(_groundVariant.toDefines());
+    // Las copias del modelo del modo de estrés van todas en una llamada instanciada y se
+    // balancean con los huesos de ModelSway
+    const bool hasStressModels = _stressScene.isEnabled() && _stressScene.getSettings().numModels > 0;
+    if (hasStressModels) {
+        _stressModelVariant = _lightingVariant;
+        _stressModelVariant.useSkinning = true;
+        _stressModelVariant.useInstancing = true;
+        CSCI441::ShaderDefines stressModelDefines = _stressModelVariant.toDefines();
+        stressModelDefines.emplace_back("MAX_BONES", std::to_string(ModelSway::NUM_BONES));
+        _stressModelShaderProgram = _lightingPermutations->getVariant(stressModelDefines);
+    }
+    _skyboxShaderProgram = CSCI441::ShaderProgram::createAsync("shaders/skybox.v.glsl", "shaders/skybox.f.glsl");
+
+    if (_useMultiView) {
+        // GL 4.1 tiene viewport arrays, pero escribir gl_ViewportIndex desde el vertex shader
+        // requiere una extensión; sin ella un geometry shader reparte los triángulos
+        const bool viewportIndexInVertexShader = GLAD_GL_ARB_shader_viewport_layer_array != 0;
+        if (viewportIndexInVertexShader) {
+            _multiViewPermutations = new CSCI441::ShaderPermutationCache("shaders/A3.v.glsl", "shaders/A3.f.glsl");
+        } else {
+            _multiViewPermutations = new CSCI441::ShaderPermutationCache("shaders/A3.v.glsl", "", "", "shaders/multiview.g.glsl", "shaders/A3.f.glsl");
+        }
+
+        _multiViewLightingVariant = _lightingVariant;
+        _multiViewGroundVariant = _groundVariant;
+        for (LightingVariant* variant : { &_multiViewLightingVariant, &_multiViewGroundVariant }) {
+            variant->useMultiView = true;
+            variant->viewportIndexInVertexShader = viewportIndexInVertexShader;
+        }
+
+        CSCI441::ShaderDefines lightingDefines = _multiViewLightingVariant.toDefines();
+        CSCI441::ShaderDefines groundDefines = _multiViewGroundVariant.toDefines();
+        lightingDefines.emplace_back("MAX_VIEWS", std::to_string(FramePacket::MAX_VIEWS));
+        groundDefines.emplace_back("MAX_VIEWS", std::to_string(FramePacket::MAX_VIEWS));
+        _multiViewLightingShaderProgram = _multiViewPermutations->getVariant(lightingDefines);
+        _multiViewGroundShaderProgram = _multiViewPermutations->getVariant(groundDefines);
+
+        if (hasStressModels) {
+            _multiViewStressModelVariant = _multiViewLightingVariant;
+            _multiViewStressModelVariant.useSkinning = true;
+            CSCI441::ShaderDefines stressModelDefines = _multiViewStressModelVariant.toDefines();
+            stressModelDefines.emplace_back("MAX_VIEWS", std::to_string(FramePacket::MAX_VIEWS));
+            stressModelDefines.emplace_back("MAX_BONES", std::to_string(ModelSway::NUM_BONES));
+            _multiViewStressModelShaderProgram = _multiViewPermutations->getVariant(stressModelDefines);
+        }
+
+        fprintf(stdout, "[INFO]: Multi-view: up to %d views per draw, viewport selected in the %s shader\n",
+                FramePacket::MAX_VIEWS, viewportIndexInVertexShader ? "vertex" : "geometry");
+    }
+
+    // Cargar el skybox mientras el driver compila; el primer uso de cada programa espera a que termine
+    _setupSkybox();
 
     // Uniformes generales del Shader
     _lightingShaderUniformLocations.mvpMatrix      = _lightingShaderProgram->getUniformLocation("mvpMatrix");
     _lightingShaderUniformLocations.normalMatrix   = _lightingShaderProgram->getUniformLocation("normalMatrix");
     _lightingShaderUniformLocations.eyePosition    = _lightingShaderProgram->getUniformLocation("eyePosition");
 
-    // Atributos generales del Shader
+    // Atributos generales del Shader (iguales en todas las variantes)
     _lightingShaderAttributeLocations.vPos    = _lightingShaderProgram->getAttributeLocation("vPos");
     _lightingShaderAttributeLocations.vNormal = _lightingShaderProgram->getAttributeLocation("vNormal");
 
@@ -199,93 +331,122 @@ void MP::mSetupShaders() {
     _lightingShaderUniformLocations.materialSpecularColor  = _lightingShaderProgram->getUniformLocation("materialSpecularColor");
     _lightingShaderUniformLocations.materialShininess      = _lightingShaderProgram->getUniformLocation("materialShininess");
 
-    // Uniformes de la luz direccional
-    _lightingShaderUniformLocations.lightDirection     = _lightingShaderProgram->getUniformLocation("lightDirection");
-    _lightingShaderUniformLocations.lightAmbientColor  = _lightingShaderProgram->getUniformLocation("lightAmbientColor");
-    _lightingShaderUniformLocations.lightDiffuseColor  = _lightingShaderProgram->getUniformLocation("lightDiffuseColor");
-    _lightingShaderUniformLocations.lightSpecularColor = _lightingShaderProgram->getUniformLocation("lightSpecularColor");
-
-    // Uniformes de la luz puntual
-    _lightingShaderUniformLocations.pointLightPos       = _lightingShaderProgram->getUniformLocation("pointLightPos");
-    _lightingShaderUniformLocations.pointLightColor     = _lightingShaderProgram->getUniformLocation("pointLightColor");
-    _lightingShaderUniformLocations.pointLightConstant  = _lightingShaderProgram->getUniformLocation("pointLightConstant");
-    _lightingShaderUniformLocations.pointLightLinear    = _lightingShaderProgram->getUniformLocation("pointLightLinear");
-    _lightingShaderUniformLocations.pointLightQuadratic = _lightingShaderProgram->getUniformLocation("pointLightQuadratic");
+    // Uniformes de la variante del terreno
+    _groundShaderUniformLocations.mvpMatrix            = _groundShaderProgram->getUniformLocation("mvpMatrix");
+    _groundShaderUniformLocations.normalMatrix         = _groundShaderProgram->getUniformLocation("normalMatrix");
+    _groundShaderUniformLocations.eyePosition          = _groundShaderProgram->getUniformLocation("eyePosition");
+    _groundShaderUniformLocations.materialAmbientColor = _groundShaderProgram->getUniformLocation("materialAmbientColor");
+    _groundShaderUniformLocations.materialDiffuseColor = _groundShaderProgram->getUniformLocation("materialDiffuseColor");
+
+    // Uniformes de la variante del modelo; el color llega por instancia
+    if (_stressModelShaderProgram != nullptr) {
+        _stressModelShaderUniformLocations.viewProjectionMatrix  = _stressModelShaderProgram->getUniformLocation("viewProjectionMatrix");
+        _stressModelShaderUniformLocations.eyePosition           = _stressModelShaderProgram->getUniformLocation("eyePosition");
+        _stressModelShaderUniformLocations.materialSpecularColor = _stressModelShaderProgram->getUniformLocation("materialSpecularColor");
+        _stressModelShaderUniformLocations.materialShininess     = _stressModelShaderProgram->getUniformLocation("materialShininess");
+        _stressModelShaderUniformLocations.boneMatrices          = _stressModelShaderProgram->getUniformLocation("boneMatrices");
+    }
 
-    // Uniformes del spotlight
-    _lightingShaderUniformLocations.spotLightPos            = _lightingShaderProgram->getUniformLocation("spotLightPos");
-    _lightingShaderUniformLocations.spotLightDirection      = _lightingShaderProgram->getUniformLocation("spotLightDirection");
-    _lightingShaderUniformLocations.spotLightColor          = _lightingShaderProgram->getUniformLocation("spotLightColor");
-    _lightingShaderUniformLocations.spotLightCutoff         = _lightingShaderProgram->getUniformLocation("spotLightCutoff");
-    _lightingShaderUniformLocations.spotLightOuterCutoff    = _lightingShaderProgram->getUniformLocation("spotLightOuterCutoff");
-    _lightingShaderUniformLocations.spotLightExponent       = _lightingShaderProgram->getUniformLocation("spotLightExponent");
-    _lightingShaderUniformLocations.spotLightConstant       = _lightingShaderProgram->getUniformLocation("spotLightConstant");
-    _lightingShaderUniformLocations.spotLightLinear         = _lightingShaderProgram->getUniformLocation("spotLightLinear");
-    _lightingShaderUniformLocations.spotLightQuadratic      = _lightingShaderProgram->getUniformLocation("spotLightQuadratic");
+    if (_useMultiView) {
+        _multiViewLightingUniformLocations = _getMultiViewUniformLocations(_multiViewLightingShaderProgram);
+        _multiViewGroundUniformLocations = _getMultiViewUniformLocations(_multiViewGroundShaderProgram);
+        _multiViewLightingShaderProgram->setUniformBlockBinding("ViewBlock", VIEW_BLOCK_BINDING);
+        _multiViewGroundShaderProgram->setUniformBlockBinding("ViewBlock", VIEW_BLOCK_BINDING);
+        if (_multiViewStressModelShaderProgram != nullptr) {
+            _multiViewStressModelUniformLocations = _getMultiViewUniformLocations(_multiViewStressModelShaderProgram);
+            _multiViewStressModelShaderProgram->setUniformBlockBinding("ViewBlock", VIEW_BLOCK_BINDING);
+        }
+    }
 
-    _setupSkybox();
+    _skyboxShaderProgram->setProgramUniform("skybox", 0);
+
+    // Resolver una sola vez los uniforms que se actualizan en cada frame
+    _skyboxShaderUniformHandles.view       = _skyboxShaderProgram->getUniformHandle<glm::mat4>("view");
+    _skyboxShaderUniformHandles.projection = _skyboxShaderProgram->getUniformHandle<glm::mat4>("projection");
+
+    // Resumen de programas compilados vs. cargados desde la cache
+    CSCI441::ShaderProgram::printStartupReport();
 }
 
 void MP::mSetupBuffers() {
     CSCI441::setVertexAttributeLocations(_lightingShaderAttributeLocations.vPos, _lightingShaderAttributeLocations.vNormal);
 
-    // Inicializar el modelo del héroe (Aaron_Inti)
-    _pPlane = new Aaron_Inti(_lightingShaderProgram->getShaderProgramHandle(),
-                             _lightingShaderUniformLocations.mvpMatrix,
-                             _lightingShaderUniformLocations.normalMatrix);
-
-    // Inicializar las monedas
-    for(int i = 0; i < 4; ++i) {
-        _coins[i] = new Coin(_lightingShaderProgram->getShaderProgramHandle(),
-                             _lightingShaderUniformLocations.mvpMatrix,
-                             _lightingShaderUniformLocations.normalMatrix);
-    }
-
-    // Inicializar los zombies
-    for(int i = 0; i < NUM_ZOMBIES; ++i) {
-        _zombies[i] = new Zombie(_lightingShaderProgram->getShaderProgramHandle(),
-                                 _lightingShaderUniformLocations.mvpMatrix,
-                                 _lightingShaderUniformLocations.normalMatrix);
-    }
-
-    _createGroundBuffers();
-}
-
-void MP::_createGroundBuffers() {
-    struct Vertex {
-        glm::vec3 position;
-        glm::vec3 normal;
-    };
-    Vertex groundQuad[4] = {
-        { {-1.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f} },
-        { { 1.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f} },
-        { {-1.0f, 0.0f,  1.0f}, {0.0f, 1.0f, 0.0f} },
-        { { 1.0f, 0.0f,  1.0f}, {0.0f, 1.0f, 0.0f} }
-    };
+    // Inicializar el héroe (Aaron_Inti); su posición se fija en mSetupScene()
+    _hero = _registry.create(Aaron_Inti(), ECS::Transform());
 
-    GLushort indices[4] = {0,1,2,3};
+    _loadStressModel();
 
-    _numGroundPoints = 4;
+    _startWorldStreaming();
 
-    glGenVertexArrays(1, &_groundVAO);
-    glBindVertexArray(_groundVAO);
+    _dynamicResolution.setup(_dynamicResolutionSettings);
+    _offscreenInset.setup(_offscreenInsetSettings);
 
-    GLuint vbods[2];
-    glGenBuffers(2, vbods);
-    glBindBuffer(GL_ARRAY_BUFFER, vbods[0]);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(groundQuad), groundQuad, GL_STATIC_DRAW);
+    if (_useMultiView) {
+        // Matrices y posición del ojo de cada vista; se reescribe una vez por frame
+        glGenBuffers(1, &_viewUniformBuffer);
+        glBindBuffer(GL_UNIFORM_BUFFER, _viewUniformBuffer);
+        glBufferData(GL_UNIFORM_BUFFER, sizeof(ViewBlock), nullptr, GL_DYNAMIC_DRAW);
+        glBindBuffer(GL_UNIFORM_BUFFER, 0);
+        glBindBufferBase(GL_UNIFORM_BUFFER, VIEW_BLOCK_BINDING, _viewUniformBuffer);
+    }
+}
 
-    // Hook up vertex normal attribute
-    glEnableVertexAttribArray(_lightingShaderAttributeLocations.vPos);
-    glVertexAttribPointer(_lightingShaderAttributeLocations.vPos, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)nullptr);
+void MP::_startWorldStreaming() {
+    // El mundo depende de la semilla para que una grabación reproduzca el mismo mapa; las
+    // mallas las sube el hilo de render a medida que llegan los tiles
+    // En el modo de estrés los tiles solo traen terreno: la escena crea todas las entidades
+    // Al grabar o reproducir, los tiles y el campo se construyen en la simulación para que las
+    // entidades aparezcan en el mismo tick y los zombies repitan el mismo recorrido
+    const bool deterministic = _inputRecorder.isOpen() || _inputReplay.isOpen();
+    WorldStreamer::Settings worldStreamerSettings = _worldStreamerSettings;
+    if (_stressScene.isEnabled()) {
+        worldStreamerSettings.coinsPerTile = 0;
+        worldStreamerSettings.zombiesPerCoin = 0;
+    }
+    if (deterministic) {
+        worldStreamerSettings.asynchronous = false;
+    }
+    _world.start(worldStreamerSettings, _terrainSettings, _randomSeed, _registry);
 
-    glEnableVertexAttribArray(_lightingShaderAttributeLocations.vNormal);
-    glVertexAttribPointer(_lightingShaderAttributeLocations.vNormal, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+    FlowField::Settings flowFieldSettings = _flowFieldSettings;
+    if (deterministic) {
+        flowFieldSettings.asynchronous = false;
+    }
+    _flowField.start(flowFieldSettings);
+    _crowdAvoidance.start(_crowdAvoidanceSettings);
+    const float stressExtent = _stressScene.isEnabled() ? 2.0f * _stressScene.getSettings().radius : 0.0f;
+    _crowdAvoidance.reserve(_world.getMaxZombies() + _stressScene.getNumZombies(), std::max(_world.getResidentExtent(), stressExtent));
+}
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, vbods[1]);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(indices), indices, GL_STATIC_DRAW);
+void MP::_loadStressModel() {
+    const StressScene::Settings& settings = _stressScene.getSettings();
+    if (!_stressScene.isEnabled() || settings.numModels == 0) return;
 
-    glBindVertexArray(0);
+    _stressModel = new CSCI441::ModelLoader();
+    if (settings.modelFilename.empty() || !_stressModel->loadModelFile(settings.modelFilename)
+        || _stressModel->getNumberOfVertices() == 0) {
+        fprintf(stderr, "[ERROR]: Stress scene: could not load model \"%s\"; no models will be placed\n", settings.modelFilename.c_str());
+        delete _stressModel;
+        _stressModel = nullptr;
+        return;
+    }
+    _stressModel->setAttributeLocations(_lightingShaderAttributeLocations.vPos, _lightingShaderAttributeLocations.vNormal);
+
+    // Cualquier modelo queda centrado, apoyado en el suelo y con 2 unidades en su lado más largo
+    const glm::vec3* vertices = reinterpret_cast<const glm::vec3*>(_stressModel->getVertices());
+    glm::vec3 minCorner = vertices[0], maxCorner = vertices[0];
+    for (GLuint i = 1; i < _stressModel->getNumberOfVertices(); ++i) {
+        minCorner = glm::min(minCorner, vertices[i]);
+        maxCorner = glm::max(maxCorner, vertices[i]);
+    }
+    const glm::vec3 extent = maxCorner - minCorner;
+    const float scale = 2.0f / std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-6f));
+    const glm::vec3 base(0.5f * (minCorner.x + maxCorner.x), minCorner.y, 0.5f * (minCorner.z + maxCorner.z));
+    _stressModelMtx = glm::translate(glm::scale(glm::mat4(1.0f), glm::vec3(scale)), -base);
+
+    // Los pesos del balanceo y el buffer de instancias quedan en el VAO del modelo
+    _stressModelSway.build(vertices, _stressModel->getNumberOfVertices(), base);
+    _stressModelBatch.setup(_stressModel, _stressModelSway);
 }
 
 void MP::mSetupScene() {
@@ -297,39 +458,17 @@ void MP::mSetupScene() {
         CSCI441::Y_AXIS                 // Vector hacia arriba
     );
 
-    _planePosition = glm::vec3(0.0f, 0.0f, 0.0f);
-    _planeHeading = 0.0f;
+    // getHeight() puede crear las entidades del tile del origen: se consulta antes de tomar la
+    // referencia al héroe
+    const float originHeight = _world.getHeight(0.0f, 0.0f);
+    ECS::Transform& hero = _heroTransform();
+    hero.position = glm::vec3(0.0f, originHeight, 0.0f);
+    hero.heading = 0.0f;
 
     _updateIntiFirstPersonCamera();
 
-    float cornerOffset = WORLD_SIZE - 8.0f; // Deja un margen desde el borde
-    float coinHeight = 1.2f;
-
-    // Configurar posiciones de las monedas
-    _coinPositions[0] = glm::vec3(-cornerOffset, coinHeight, -cornerOffset); // Esquina inferior izquierda
-    _coinPositions[1] = glm::vec3(cornerOffset, coinHeight, -cornerOffset);  // Esquina inferior derecha
-    _coinPositions[2] = glm::vec3(-cornerOffset, coinHeight, cornerOffset);  // Esquina superior izquierda
-    _coinPositions[3] = glm::vec3(cornerOffset, coinHeight, cornerOffset);   // Esquina superior derecha
-
-    // Configurar posiciones de los zombies (2 en cada esquina)
-    float zombieHeight = 1.5f; // Altura de los zombies
-    float spacing = 2.0f;      // Espacio entre los dos zombies en cada esquina
-
-    // Esquina inferior izquierda
-    _zombiePositions[0] = glm::vec3(-cornerOffset - spacing, zombieHeight, -cornerOffset - spacing);
-    _zombiePositions[1] = glm::vec3(-cornerOffset + spacing, zombieHeight, -cornerOffset + spacing);
-
-    // Esquina inferior derecha
-    _zombiePositions[2] = glm::vec3(cornerOffset - spacing, zombieHeight, -cornerOffset - spacing);
-    _zombiePositions[3] = glm::vec3(cornerOffset + spacing, zombieHeight, -cornerOffset + spacing);
-
-    // Esquina superior izquierda
-    _zombiePositions[4] = glm::vec3(-cornerOffset - spacing, zombieHeight, cornerOffset - spacing);
-    _zombiePositions[5] = glm::vec3(-cornerOffset + spacing, zombieHeight, cornerOffset + spacing);
-
-    // Esquina superior derecha
-    _zombiePositions[6] = glm::vec3(cornerOffset - spacing, zombieHeight, cornerOffset - spacing);
-    _zombiePositions[7] = glm::vec3(cornerOffset + spacing, zombieHeight, cornerOffset + spacing);
+    // Monedas y zombies llegan con cada tile; se piden los tiles alrededor del héroe
+    _world.update(hero.position);
 
     // Configurar la matriz de proyección
     int width, height;
@@ -339,86 +478,271 @@ void MP::mSetupScene() {
     _cameraSpeed = glm::vec2(0.25f, 0.02f);
 
     // Propiedades de la luz direccional
-    glm::vec3 lightDirection = glm::vec3(-1.0f, -1.0f, 1.0f);
-    glm::vec3 lightAmbientColor = glm::vec3(0.2f, 0.2f, 0.2f);
-    glm::vec3 lightDiffuseColor = glm::vec3(1.0f, 1.0f, 1.0f);
-    glm::vec3 lightSpecularColor = glm::vec3(1.0f, 1.0f, 1.0f);
-
-    // Uniformes de la luz direccional
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.lightDirection, lightDirection);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.lightAmbientColor, lightAmbientColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.lightDiffuseColor, lightDiffuseColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.lightSpecularColor, lightSpecularColor);
+    _sceneLights.directional.direction     = glm::vec3(-1.0f, -1.0f, 1.0f);
+    _sceneLights.directional.ambientColor  = glm::vec3(0.2f, 0.2f, 0.2f);
+    _sceneLights.directional.diffuseColor  = glm::vec3(1.0f, 1.0f, 1.0f);
+    _sceneLights.directional.specularColor = glm::vec3(1.0f, 1.0f, 1.0f);
 
     // Propiedades de la luz puntual
-    glm::vec3 pointLightPos = glm::vec3(0.0f, 2.0f, 0.0f);
-    glm::vec3 pointLightColor = glm::vec3(0.9f, 0.8f, 0.4f);
-    float pointLightConstant = 1.0f;
-    float pointLightLinear = 0.7f;
-    float pointLightQuadratic = 0.1f;
-
-    // Uniformes de la luz puntual
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.pointLightPos, pointLightPos);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.pointLightColor, pointLightColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.pointLightConstant, pointLightConstant);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.pointLightLinear, pointLightLinear);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.pointLightQuadratic, pointLightQuadratic);
+    _sceneLights.numPointLights = 1;
+    _sceneLights.points[0].position  = glm::vec3(0.0f, 2.0f, 0.0f);
+    _sceneLights.points[0].color     = glm::vec3(0.9f, 0.8f, 0.4f);
+    _sceneLights.points[0].constant  = 1.0f;
+    _sceneLights.points[0].linear    = 0.7f;
+    _sceneLights.points[0].quadratic = 0.1f;
 
     // Propiedades del spotlight
-    glm::vec3 spotLightPos = glm::vec3(-2.0f, 5.0f, -2.0f);
-    glm::vec3 spotLightDirection = glm::vec3(0.0f, -1.0f, 0.0f);
-    glm::vec3 spotLightColor = glm::vec3(0.7f, 0.7f, 0.7f);
-    float spotLightCutoff = glm::cos(glm::radians(15.0f));
-    float spotLightOuterCutoff = glm::cos(glm::radians(20.0f));
-    float spotLightExponent = 30.0f;
-    float spotLightConstant = 1.0f;
-    float spotLightLinear = 0.7f;
-    float spotLightQuadratic = 0.1f;
+    _sceneLights.spot.position    = glm::vec3(-2.0f, 5.0f, -2.0f);
+    _sceneLights.spot.direction   = glm::vec3(0.0f, -1.0f, 0.0f);
+    _sceneLights.spot.color       = glm::vec3(0.7f, 0.7f, 0.7f);
+    _sceneLights.spot.cutoff      = glm::cos(glm::radians(15.0f));
+    _sceneLights.spot.outerCutoff = glm::cos(glm::radians(20.0f));
+    _sceneLights.spot.exponent    = 30.0f;
+    _sceneLights.spot.constant    = 1.0f;
+    _sceneLights.spot.linear      = 0.7f;
+    _sceneLights.spot.quadratic   = 0.1f;
+
+    // El render reenvía los uniforms de las luces cuando cambia la revisión
+    _sceneLights.revision++;
+
+    // La escena de prueba reemplaza las luces puntuales y agrega sus entidades
+    _stressScene.populate(_randomSeed, _stressModel != nullptr, _world, _registry, _sceneLights);
+}
+
+void MP::_sendLightUniforms(const CSCI441::ShaderProgram* shaderProgram, const LightingVariant& variant, const SceneLights& lights) {
+    const bool hasSpecular = variant.model == LightingVariant::Model::PHONG;
+
+    // Uniformes de la luz direccional
+    if (variant.numDirectionalLights > 0) {
+        shaderProgram->setProgramUniform("lightDirection", lights.directional.direction);
+        shaderProgram->setProgramUniform("lightAmbientColor", lights.directional.ambientColor);
+        shaderProgram->setProgramUniform("lightDiffuseColor", lights.directional.diffuseColor);
+        if (hasSpecular) {
+            shaderProgram->setProgramUniform("lightSpecularColor", lights.directional.specularColor);
+        }
+    }
+
+    // Uniformes de las luces puntuales, un arreglo por propiedad
+    const int numPointLights = std::min(variant.numPointLights, lights.numPointLights);
+    if (numPointLights > 0) {
+        glm::vec3 positions[SceneLights::MAX_POINT_LIGHTS], colors[SceneLights::MAX_POINT_LIGHTS];
+        GLfloat constants[SceneLights::MAX_POINT_LIGHTS], linears[SceneLights::MAX_POINT_LIGHTS], quadratics[SceneLights::MAX_POINT_LIGHTS];
+        for (int i = 0; i < numPointLights; ++i) {
+            positions[i]  = lights.points[i].position;
+            colors[i]     = lights.points[i].color;
+            constants[i]  = lights.points[i].constant;
+            linears[i]    = lights.points[i].linear;
+            quadratics[i] = lights.points[i].quadratic;
+        }
+        shaderProgram->setProgramUniform("pointLightPos", 3, numPointLights, &positions[0][0]);
+        shaderProgram->setProgramUniform("pointLightColor", 3, numPointLights, &colors[0][0]);
+        shaderProgram->setProgramUniform("pointLightConstant", 1, numPointLights, constants);
+        shaderProgram->setProgramUniform("pointLightLinear", 1, numPointLights, linears);
+        shaderProgram->setProgramUniform("pointLightQuadratic", 1, numPointLights, quadratics);
+    }
 
     // Uniformes del spotlight
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightPos, spotLightPos);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightDirection, spotLightDirection);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightColor, spotLightColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightCutoff, spotLightCutoff);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightOuterCutoff, spotLightOuterCutoff);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightExponent, spotLightExponent);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightConstant, spotLightConstant);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightLinear, spotLightLinear);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.spotLightQuadratic, spotLightQuadratic);
+    if (variant.numSpotLights > 0) {
+        shaderProgram->setProgramUniform("spotLightPos", lights.spot.position);
+        shaderProgram->setProgramUniform("spotLightDirection", lights.spot.direction);
+        shaderProgram->setProgramUniform("spotLightColor", lights.spot.color);
+        shaderProgram->setProgramUniform("spotLightCutoff", lights.spot.cutoff);
+        shaderProgram->setProgramUniform("spotLightOuterCutoff", lights.spot.outerCutoff);
+        shaderProgram->setProgramUniform("spotLightExponent", lights.spot.exponent);
+        shaderProgram->setProgramUniform("spotLightConstant", lights.spot.constant);
+        shaderProgram->setProgramUniform("spotLightLinear", lights.spot.linear);
+        shaderProgram->setProgramUniform("spotLightQuadratic", lights.spot.quadratic);
+    }
+}
 
-    _setupSkybox();
+MP::MultiViewShaderUniformLocations MP::_getMultiViewUniformLocations(const CSCI441::ShaderProgram* shaderProgram) {
+    MultiViewShaderUniformLocations locations;
+    locations.modelMatrix           = shaderProgram->getUniformLocation("modelMatrix");
+    locations.normalMatrix          = shaderProgram->getUniformLocation("normalMatrix");
+    locations.materialAmbientColor  = shaderProgram->getUniformLocation("materialAmbientColor");
+    locations.materialDiffuseColor  = shaderProgram->getUniformLocation("materialDiffuseColor");
+    // La variante Lambert no tiene especular; -1 hace que glProgramUniform se ignore
+    locations.materialSpecularColor = glGetUniformLocation(shaderProgram->getShaderProgramHandle(), "materialSpecularColor");
+    locations.materialShininess     = glGetUniformLocation(shaderProgram->getShaderProgramHandle(), "materialShininess");
+    locations.boneMatrices          = glGetUniformLocation(shaderProgram->getShaderProgramHandle(), "boneMatrices");
+    return locations;
 }
 
 void MP::mCleanupShaders() {
     fprintf(stdout, "[INFO]: ...deleting Shaders.\n");
-    delete _lightingShaderProgram;
+    delete _lightingPermutations;
+    delete _multiViewPermutations;
     fprintf(stdout, "[INFO]: ...deleting Skybox Shaders.\n");
     delete _skyboxShaderProgram;
 }
 
 void MP::mCleanupBuffers() {
+    fprintf(stdout, "[INFO]: ...deleting dynamic resolution target...\n");
+    _dynamicResolution.cleanup();
+    _offscreenInset.cleanup();
+
     fprintf(stdout, "[INFO]: ...deleting VAOs....\n");
     CSCI441::deleteObjectVAOs();
-    glDeleteVertexArrays(1, &_groundVAO);
+    for (const std::shared_ptr<Terrain>& tile : _uploadedTerrainTiles) {
+        tile->cleanup();
+    }
+    _uploadedTerrainTiles.clear();
     glDeleteVertexArrays(1, &_skyboxVAO);
 
     fprintf(stdout, "[INFO]: ...deleting VBOs....\n");
     CSCI441::deleteObjectVBOs();
     glDeleteBuffers(1, &_skyboxVBO);
+    if (_viewUniformBuffer != 0) {
+        glDeleteBuffers(1, &_viewUniformBuffer);
+        _viewUniformBuffer = 0;
+    }
+
+    fprintf(stdout, "[INFO]: ...stopping world streaming...\n");
+    _world.printReport();
+    _agentUpdateScheduler.printReport();
+    _frameArena.printReport("Simulation");
+    _crowdAvoidance.getFrameArenas().printReport("Crowd");
+    _crowdAvoidance.stop();
+    _flowField.stop();
+    _flowFieldTiles.clear();
+    _world.stop();
 
     fprintf(stdout, "[INFO]: ...deleting models..\n");
-    delete _pPlane;
+    _registry.clear();
+    _stressModelBatch.cleanup();
+    delete _stressModel;
+    _stressModel = nullptr;
 }
 
-void MP::_renderScene(glm::mat4 viewMtx, glm::mat4 projMtx, glm::vec3 eyePosition) const {
+void MP::_renderFrame(const FramePacket& packet) {
+    // Las luces solo se reenvían cuando la simulación las modificó
+    if (packet.lights.revision != _sentLightsRevision) {
+        _sendLightUniforms(_lightingShaderProgram, _lightingVariant, packet.lights);
+        _sendLightUniforms(_groundShaderProgram, _groundVariant, packet.lights);
+        if (_useMultiView) {
+            _sendLightUniforms(_multiViewLightingShaderProgram, _multiViewLightingVariant, packet.lights);
+            _sendLightUniforms(_multiViewGroundShaderProgram, _multiViewGroundVariant, packet.lights);
+        }
+        if (_stressModelShaderProgram != nullptr) {
+            _sendLightUniforms(_stressModelShaderProgram, _stressModelVariant, packet.lights);
+        }
+        if (_multiViewStressModelShaderProgram != nullptr) {
+            _sendLightUniforms(_multiViewStressModelShaderProgram, _multiViewStressModelVariant, packet.lights);
+        }
+        _sentLightsRevision = packet.lights.revision;
+    }
 
-    // Dibujar el Skybox
+    _updateTerrainUploads(packet);
+    // Las copias del modelo se suben una vez; todas las vistas dibujan las mismas instancias
+    if (_stressModel != nullptr) {
+        _stressModelBatch.upload(packet.modelItems);
+    }
+
+    glDrawBuffer(GL_BACK);
+    if (packet.numViews == 0) {
+        // Ventana minimizada
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        return;
+    }
+
+    // La escena se dibuja a resolución reducida y se escala al backbuffer al final
+    _dynamicResolution.beginFrame(packet.framebufferWidth, packet.framebufferHeight);
+    const float scale = _dynamicResolution.getScale();
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    GLint viewports[FramePacket::MAX_VIEWS][4];
+    for (int i = 0; i < packet.numViews; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            viewports[i][j] = static_cast<GLint>(static_cast<float>(packet.views[i].viewport[j]) * scale);
+        }
+        viewports[i][2] = std::max(viewports[i][2], 1);
+        viewports[i][3] = std::max(viewports[i][3], 1);
+    }
+
+    if (_useMultiView) {
+        // Una sola pasada para todas las vistas, incluido el inset
+        _renderSceneMultiView(packet, viewports);
+        _dynamicResolution.endFrame();
+        return;
+    }
+
+    bool hasInset = false;
+    for (int i = 0; i < packet.numViews; ++i) {
+        const FrameView& view = packet.views[i];
+        const GLint* viewport = viewports[i];
+
+        if (view.isInset) {
+            // El inset tiene su propio framebuffer y solo se vuelve a dibujar cuando toca
+            hasInset = true;
+            if (_offscreenInset.needsUpdate(view.viewMtx, view.viewport[2], view.viewport[3])) {
+                _offscreenInset.beginUpdate();
+                _renderScene(view, packet);
+                _offscreenInset.endUpdate();
+            }
+            _offscreenInset.composite(viewport[0], viewport[1], viewport[2], viewport[3]);
+        } else {
+            glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+            _renderScene(view, packet);
+        }
+    }
+    if (!hasInset) {
+        _offscreenInset.invalidate();
+    }
+
+    _dynamicResolution.endFrame();
+}
+
+void MP::_updateTerrainUploads(const FramePacket& packet) {
+    const AllocationTracker::Tag uploadTag("terrain uploads", true);
+
+    // Los tiles vienen del más cercano al más lejano; subir pocos por frame evita tirones y
+    // los lejanos esperan unos frames sin dibujarse
+    int numUploads = 0;
+    for (const std::shared_ptr<Terrain>& tile : packet.terrainTiles) {
+        if (numUploads == MAX_TILE_UPLOADS_PER_FRAME) break;
+        if (!tile->hasBuffers()) {
+            tile->setupBuffers(_lightingShaderAttributeLocations.vPos, _lightingShaderAttributeLocations.vNormal);
+            _uploadedTerrainTiles.push_back(tile);
+            ++numUploads;
+        }
+    }
+
+    // Liberar en este hilo la GPU de los tiles que la simulación ya descartó; mientras estén en
+    // esta lista el último shared_ptr no puede soltarse en otro hilo con los buffers vivos
+    for (size_t i = 0; i < _uploadedTerrainTiles.size();) {
+        if (std::find(packet.terrainTiles.begin(), packet.terrainTiles.end(), _uploadedTerrainTiles[i]) == packet.terrainTiles.end()) {
+            _uploadedTerrainTiles[i]->cleanup();
+            _uploadedTerrainTiles[i] = std::move(_uploadedTerrainTiles.back());
+            _uploadedTerrainTiles.pop_back();
+        } else {
+            ++i;
+        }
+    }
+}
+
+void MP::_drawTerrainTiles(const FramePacket& packet, const glm::vec3& lodEye, const glm::mat4* viewProjectionMatrices, int numViews) {
+    int remainingTriangles = _terrainSettings.triangleBudget;
+    for (const std::shared_ptr<Terrain>& tile : packet.terrainTiles) {
+        if (!tile->hasBuffers()) continue;
+
+        tile->selectChunks(lodEye, viewProjectionMatrices, numViews, _terrainSelection, remainingTriangles);
+        remainingTriangles = std::max(remainingTriangles - static_cast<int>(_terrainSelection.numTriangles), 0);
+
+        tile->bind();
+        for (GLint chunk : _terrainSelection.chunks) {
+            tile->drawChunk(chunk, numViews);
+        }
+    }
+}
+
+void MP::_drawSkybox(const FrameView& view) const {
     glDepthFunc(GL_LEQUAL);
     _skyboxShaderProgram->useProgram();
 
-    glm::mat4 view = glm::mat4(glm::mat3(viewMtx)); // Eliminar la traslación de la matriz de vista
-    _skyboxShaderProgram->setProgramUniform("view", view);
-    _skyboxShaderProgram->setProgramUniform("projection", projMtx);
+    glm::mat4 skyboxView = glm::mat4(glm::mat3(view.viewMtx)); // Eliminar la traslación de la matriz de vista
+    _skyboxShaderProgram->setProgramUniform(_skyboxShaderUniformHandles.view, skyboxView);
+    _skyboxShaderProgram->setProgramUniform(_skyboxShaderUniformHandles.projection, view.projMtx);
 
     glBindVertexArray(_skyboxVAO);
     glActiveTexture(GL_TEXTURE0);
@@ -426,136 +750,186 @@ void MP::_renderScene(glm::mat4 viewMtx, glm::mat4 projMtx, glm::vec3 eyePositio
     glDrawArrays(GL_TRIANGLES, 0, 36);
     glBindVertexArray(0);
     glDepthFunc(GL_LESS);
+}
 
-    // Usar el shader de iluminación
-    _lightingShaderProgram->useProgram();
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.eyePosition, eyePosition);
+void MP::_renderScene(const FrameView& view, const FramePacket& packet) {
+
+    // Dibujar el Skybox
+    _drawSkybox(view);
+
+    const glm::mat4 viewProjMtx = view.projMtx * view.viewMtx;
 
     //// INICIO DIBUJANDO EL PLANO DE TERRENO ////
-    // Dibujar el plano de terreno
-    glm::mat4 groundModelMtx = glm::scale(glm::mat4(1.0f), glm::vec3(WORLD_SIZE, 1.0f, WORLD_SIZE));
-    _computeAndSendMatrixUniforms(groundModelMtx, viewMtx, projMtx);
+    // El terreno no tiene especular, usa la variante Lambert
+    _groundShaderProgram->useProgram();
+    _groundShaderProgram->setProgramUniform(_groundShaderUniformLocations.eyePosition, view.eyePosition);
+
+    // El terreno ya está en coordenadas de mundo
+    glm::mat3 groundNormalMtx(1.0f);
+    _groundShaderProgram->setProgramUniform(_groundShaderUniformLocations.mvpMatrix, viewProjMtx);
+    _groundShaderProgram->setProgramUniform(_groundShaderUniformLocations.normalMatrix, groundNormalMtx);
 
     glm::vec3 groundAmbientColor = glm::vec3(0.25f, 0.25f, 0.25f);
     glm::vec3 groundDiffuseColor = glm::vec3(0.3f, 0.8f, 0.2f); // Color existente del terreno
-    glm::vec3 groundSpecularColor = glm::vec3(0.0f, 0.0f, 0.0f); // Sin especular para el terreno
-    float groundShininess = 0.1f;
 
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialAmbientColor, groundAmbientColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialDiffuseColor, groundDiffuseColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialSpecularColor, groundSpecularColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialShininess, groundShininess);
+    _groundShaderProgram->setProgramUniform(_groundShaderUniformLocations.materialAmbientColor, groundAmbientColor);
+    _groundShaderProgram->setProgramUniform(_groundShaderUniformLocations.materialDiffuseColor, groundDiffuseColor);
 
-    glBindVertexArray(_groundVAO);
-    glDrawElements(GL_TRIANGLE_STRIP, _numGroundPoints, GL_UNSIGNED_SHORT, (void*)0);
+    // Solo los chunks visibles, con el detalle que permite el presupuesto de triángulos
+    _drawTerrainTiles(packet, view.eyePosition, &viewProjMtx, 1);
     //// FIN DIBUJANDO EL PLANO DE TERRENO ////
 
-    /// INICIO DIBUJANDO EL HERO (Aaron_Inti) ////
-    glm::vec3 heroAmbientColor = glm::vec3(0.1f, 0.0f, 0.0f);
-    glm::vec3 heroDiffuseColor = glm::vec3(0.7f, 0.0f, 0.0f);
-    glm::vec3 heroSpecularColor = glm::vec3(1.0f, 1.0f, 1.0f);
-    float heroShininess = 32.0f;
-
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialAmbientColor, heroAmbientColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialDiffuseColor, heroDiffuseColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialSpecularColor, heroSpecularColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialShininess, heroShininess);
-
-    glm::mat4 heroModelMtx(1.0f);
-    heroModelMtx = glm::translate(heroModelMtx, _planePosition);
-    heroModelMtx = glm::translate(heroModelMtx, glm::vec3(0.0f, 1.3f, 0.0f));
-    heroModelMtx = glm::rotate(heroModelMtx, _planeHeading, CSCI441::Y_AXIS);
-    _pPlane->drawVehicle(heroModelMtx, viewMtx, projMtx);
-    /// FIN DIBUJANDO EL HERO (Aaron_Inti) ////
-
-    // Dibujar las monedas
-    for (int i = 0; i < 4; ++i) {
-        if (_coins[i]->isActive()) {
-            glm::mat4 coinModelMtx(1.0f);
-            coinModelMtx = glm::translate(coinModelMtx, _coinPositions[i]);
-            // Si aplicaste alguna rotación antes, puedes mantenerla
-            // coinModelMtx = glm::rotate(coinModelMtx, glm::radians(-90.0f), CSCI441::X_AXIS);
-            _coins[i]->drawCoin(coinModelMtx, viewMtx, projMtx);
-        }
+    // Héroe, monedas y zombies ya vienen como piezas en el paquete
+    _lightingShaderProgram->useProgram();
+    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.eyePosition, view.eyePosition);
+
+    const DrawItemUniforms uniforms = {
+        _lightingShaderUniformLocations.mvpMatrix, _lightingShaderUniformLocations.normalMatrix,
+        _lightingShaderUniformLocations.materialAmbientColor, _lightingShaderUniformLocations.materialDiffuseColor,
+        _lightingShaderUniformLocations.materialSpecularColor, _lightingShaderUniformLocations.materialShininess
+    };
+    submitDrawItems(*_lightingShaderProgram, uniforms, &viewProjMtx, packet.drawItems);
+
+    // Copias del modelo del modo de estrés: una sola llamada, con la matriz y el color por instancia
+    if (_stressModelShaderProgram != nullptr && _stressModelBatch.getNumInstances() > 0) {
+        glm::mat4 boneMatrices[ModelSway::NUM_BONES];
+        _stressModelSway.computeBoneMatrices(packet.modelSwayAngle, boneMatrices);
+
+        _stressModelShaderProgram->useProgram();
+        _stressModelShaderProgram->setProgramUniform(_stressModelShaderUniformLocations.viewProjectionMatrix, viewProjMtx);
+        _stressModelShaderProgram->setProgramUniform(_stressModelShaderUniformLocations.eyePosition, view.eyePosition);
+        _stressModelShaderProgram->setProgramUniform(_stressModelShaderUniformLocations.materialSpecularColor, glm::vec3(0.5f));
+        _stressModelShaderProgram->setProgramUniform(_stressModelShaderUniformLocations.materialShininess, packet.modelItems.front().shininess);
+        glProgramUniformMatrix4fv(_stressModelShaderProgram->getShaderProgramHandle(), _stressModelShaderUniformLocations.boneMatrices,
+                                  ModelSway::NUM_BONES, GL_FALSE, &boneMatrices[0][0][0]);
+        _stressModelBatch.draw(*_stressModelShaderProgram);
     }
+}
 
-    /// INICIO DIBUJANDO LOS ZOMBIES ///
-    glm::vec3 zombieAmbientColor = glm::vec3(0.0f, 0.1f, 0.0f); // Opcional: color ambiental general para zombies
-    glm::vec3 zombieDiffuseColor = glm::vec3(0.0f, 0.0f, 1.0f); // Opcional: color difuso general para zombies
-    glm::vec3 zombieSpecularColor = glm::vec3(0.5f, 0.5f, 0.5f); // Opcional: color especular general para zombies
-    float zombieShininess = 32.0f;
-
-    // Configurar los colores del material para los zombies
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialAmbientColor, zombieAmbientColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialDiffuseColor, zombieDiffuseColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialSpecularColor, zombieSpecularColor);
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.materialShininess, zombieShininess);
-
-    for(int i = 0; i < NUM_ZOMBIES; ++i) {
-        if(_zombies[i] != nullptr) {
-            glm::mat4 zombieModelMtx(1.0f);
-            zombieModelMtx = glm::translate(zombieModelMtx, _zombiePositions[i]);
-            // Si deseas rotar o escalar los zombies, puedes hacerlo aquí
-            // Por ejemplo:
-            // zombieModelMtx = glm::rotate(zombieModelMtx, glm::radians(90.0f), CSCI441::Y_AXIS);
-            // zombieModelMtx = glm::scale(zombieModelMtx, glm::vec3(1.0f));
-
-            _zombies[i]->drawVehicle(zombieModelMtx, viewMtx, projMtx);
-        }
+void MP::_renderSceneMultiView(const FramePacket& packet, const GLint viewports[][4]) {
+    const int numViews = packet.numViews;
+
+    // Cada vista recibe una franja del rango de profundidad; las posteriores quedan delante,
+    // igual que el inset que en la ruta por vista limpia la profundidad antes de dibujarse
+    GLdouble depthRanges[FramePacket::MAX_VIEWS][2];
+    for (int i = 0; i < numViews; ++i) {
+        depthRanges[i][0] = static_cast<GLdouble>(numViews - 1 - i) / numViews;
+        depthRanges[i][1] = static_cast<GLdouble>(numViews - i) / numViews;
+    }
+
+    // El skybox son 36 vértices con su propio programa; se sigue dibujando una vez por vista
+    for (int i = 0; i < numViews; ++i) {
+        glViewport(viewports[i][0], viewports[i][1], viewports[i][2], viewports[i][3]);
+        glDepthRange(depthRanges[i][0], depthRanges[i][1]);
+        _drawSkybox(packet.views[i]);
+    }
+
+    ViewBlock viewBlock;
+    for (int i = 0; i < numViews; ++i) {
+        const FrameView& view = packet.views[i];
+        viewBlock.viewProjectionMatrices[i] = view.projMtx * view.viewMtx;
+        viewBlock.eyePositions[i] = glm::vec4(view.eyePosition, 1.0f);
+
+        glViewportIndexedf(i, static_cast<GLfloat>(viewports[i][0]), static_cast<GLfloat>(viewports[i][1]),
+                              static_cast<GLfloat>(viewports[i][2]), static_cast<GLfloat>(viewports[i][3]));
+        glDepthRangeIndexed(i, depthRanges[i][0], depthRanges[i][1]);
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, _viewUniformBuffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(ViewBlock), &viewBlock);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    // Terreno: una instancia por vista; el LOD se elige desde la vista principal y se
+    // descartan solo los chunks que no ve ninguna vista
+    _multiViewGroundShaderProgram->useProgram();
+    _multiViewGroundShaderProgram->setProgramUniform(_multiViewGroundUniformLocations.modelMatrix, glm::mat4(1.0f));
+    _multiViewGroundShaderProgram->setProgramUniform(_multiViewGroundUniformLocations.normalMatrix, glm::mat3(1.0f));
+    _multiViewGroundShaderProgram->setProgramUniform(_multiViewGroundUniformLocations.materialAmbientColor, glm::vec3(0.25f, 0.25f, 0.25f));
+    _multiViewGroundShaderProgram->setProgramUniform(_multiViewGroundUniformLocations.materialDiffuseColor, glm::vec3(0.3f, 0.8f, 0.2f));
+
+    _drawTerrainTiles(packet, packet.views[0].eyePosition, viewBlock.viewProjectionMatrices, numViews);
+
+    // Héroe, monedas y zombies: los uniforms de cada pieza se envían una vez para todas las vistas
+    _multiViewLightingShaderProgram->useProgram();
+    CSCI441::setDrawInstanceCount(numViews);
+
+    const DrawItemUniforms uniforms = {
+        _multiViewLightingUniformLocations.modelMatrix, _multiViewLightingUniformLocations.normalMatrix,
+        _multiViewLightingUniformLocations.materialAmbientColor, _multiViewLightingUniformLocations.materialDiffuseColor,
+        _multiViewLightingUniformLocations.materialSpecularColor, _multiViewLightingUniformLocations.materialShininess
+    };
+    submitDrawItems(*_multiViewLightingShaderProgram, uniforms, nullptr, packet.drawItems);
+
+    // Copias del modelo: una llamada por copia con la variante con skinning
+    if (_multiViewStressModelShaderProgram != nullptr && !packet.modelItems.empty()) {
+        glm::mat4 boneMatrices[ModelSway::NUM_BONES];
+        _stressModelSway.computeBoneMatrices(packet.modelSwayAngle, boneMatrices);
+
+        _multiViewStressModelShaderProgram->useProgram();
+        glProgramUniformMatrix4fv(_multiViewStressModelShaderProgram->getShaderProgramHandle(), _multiViewStressModelUniformLocations.boneMatrices,
+                                  ModelSway::NUM_BONES, GL_FALSE, &boneMatrices[0][0][0]);
+
+        const DrawItemUniforms stressModelUniforms = {
+            _multiViewStressModelUniformLocations.modelMatrix, _multiViewStressModelUniformLocations.normalMatrix,
+            _multiViewStressModelUniformLocations.materialAmbientColor, _multiViewStressModelUniformLocations.materialDiffuseColor,
+            _multiViewStressModelUniformLocations.materialSpecularColor, _multiViewStressModelUniformLocations.materialShininess
+        };
+        submitDrawItems(*_multiViewStressModelShaderProgram, stressModelUniforms, nullptr, packet.modelItems, _stressModel);
     }
-    /// FIN DIBUJANDO LOS ZOMBIES ///
+
+    CSCI441::setDrawInstanceCount(1);
+    glDepthRange(0.0, 1.0);
 }
 
 void MP::_updateScene(float deltaTime) {
+    _processInputEvents(deltaTime);
+
     float moveSpeed = 0.1f;
     float rotateSpeed = glm::radians(1.5f);
 
-    const float MIN_X = -WORLD_SIZE + 3.0f;
-    const float MAX_X = WORLD_SIZE - 3.0f;
-    const float MIN_Z = -WORLD_SIZE + 3.0f;
-    const float MAX_Z = WORLD_SIZE - 3.0f;
+    // El héroe vive en otra tabla que las monedas y los zombies, así que las referencias siguen
+    // valiendo aunque getHeight() cargue un tile y cree sus entidades
+    ECS::Transform& hero = _heroTransform();
+    Aaron_Inti& heroModel = *_registry.get<Aaron_Inti>(_hero);
 
     switch (_currentCameraMode) {
         case ARCBALL:
             if (_selectedCharacter == AARON_INTI) {
                 if (_keys[GLFW_KEY_W]) {
                     glm::vec3 direction(
-                        sinf(_planeHeading),
+                        sinf(hero.heading),
                         0.0f,
-                        cosf(_planeHeading)
+                        cosf(hero.heading)
                     );
-                    glm::vec3 newPosition = _planePosition - direction * moveSpeed;
-                    newPosition.x = std::max(MIN_X, std::min(newPosition.x, MAX_X));
-                    newPosition.z = std::max(MIN_Z, std::min(newPosition.z, MAX_Z));
-                    _planePosition = newPosition;
-                    _pPlane->moveBackward();
+                    glm::vec3 newPosition = hero.position - direction * moveSpeed;
+                    newPosition.y = _world.getHeight(newPosition.x, newPosition.z);
+                    hero.position = newPosition;
+                    heroModel.moveBackward();
                 }
                 if (_keys[GLFW_KEY_S]) {
                     glm::vec3 direction(
-                        sinf(_planeHeading),
+                        sinf(hero.heading),
                         0.0f,
-                        cosf(_planeHeading)
+                        cosf(hero.heading)
                     );
-                    glm::vec3 newPosition = _planePosition + direction * moveSpeed;
-                    newPosition.x = std::max(MIN_X, std::min(newPosition.x, MAX_X));
-                    newPosition.z = std::max(MIN_Z, std::min(newPosition.z, MAX_Z));
-                    _planePosition = newPosition;
-                    _pPlane->moveForward();
+                    glm::vec3 newPosition = hero.position + direction * moveSpeed;
+                    newPosition.y = _world.getHeight(newPosition.x, newPosition.z);
+                    hero.position = newPosition;
+                    heroModel.moveForward();
                 }
                 if (_keys[GLFW_KEY_A]) {
-                    _planeHeading += rotateSpeed;
+                    hero.heading += rotateSpeed;
                 }
                 if (_keys[GLFW_KEY_D]) {
-                    _planeHeading -= rotateSpeed;
+                    hero.heading -= rotateSpeed;
                 }
 
-                if (_planeHeading > glm::two_pi<float>())
-                    _planeHeading -= glm::two_pi<float>();
-                else if (_planeHeading < 0.0f)
-                    _planeHeading += glm::two_pi<float>();
+                if (hero.heading > glm::two_pi<float>())
+                    hero.heading -= glm::two_pi<float>();
+                else if (hero.heading < 0.0f)
+                    hero.heading += glm::two_pi<float>();
 
                 float Y_OFFSET = 2.0f;
-                glm::vec3 intiLookAtPoint = _planePosition + glm::vec3(0.0f, Y_OFFSET, 0.0f);
+                glm::vec3 intiLookAtPoint = hero.position + glm::vec3(0.0f, Y_OFFSET, 0.0f);
                 _arcballCam->setLookAtPoint(intiLookAtPoint);
                 _updateIntiFirstPersonCamera();
             }
@@ -564,42 +938,40 @@ void MP::_updateScene(float deltaTime) {
             if (_selectedCharacter == AARON_INTI) {
                 if (_keys[GLFW_KEY_W]) {
                     glm::vec3 direction(
-                        sinf(_planeHeading),
+                        sinf(hero.heading),
                         0.0f,
-                        cosf(_planeHeading)
+                        cosf(hero.heading)
                     );
-                    glm::vec3 newPosition = _planePosition - direction * moveSpeed;
-                    newPosition.x = std::max(MIN_X, std::min(newPosition.x, MAX_X));
-                    newPosition.z = std::max(MIN_Z, std::min(newPosition.z, MAX_Z));
-                    _planePosition = newPosition;
-                    _pPlane->moveBackward();
+                    glm::vec3 newPosition = hero.position - direction * moveSpeed;
+                    newPosition.y = _world.getHeight(newPosition.x, newPosition.z);
+                    hero.position = newPosition;
+                    heroModel.moveBackward();
                 }
                 if (_keys[GLFW_KEY_S]) {
                     glm::vec3 direction(
-                        sinf(_planeHeading),
+                        sinf(hero.heading),
                         0.0f,
-                        cosf(_planeHeading)
+                        cosf(hero.heading)
                     );
-                    glm::vec3 newPosition = _planePosition + direction * moveSpeed;
-                    newPosition.x = std::max(MIN_X, std::min(newPosition.x, MAX_X));
-                    newPosition.z = std::max(MIN_Z, std::min(newPosition.z, MAX_Z));
-                    _planePosition = newPosition;
-                    _pPlane->moveForward();
+                    glm::vec3 newPosition = hero.position + direction * moveSpeed;
+                    newPosition.y = _world.getHeight(newPosition.x, newPosition.z);
+                    hero.position = newPosition;
+                    heroModel.moveForward();
                 }
                 if (_keys[GLFW_KEY_A]) {
-                    _planeHeading += rotateSpeed;
+                    hero.heading += rotateSpeed;
                 }
                 if (_keys[GLFW_KEY_D]) {
-                    _planeHeading -= rotateSpeed;
+                    hero.heading -= rotateSpeed;
                 }
 
-                if (_planeHeading > glm::two_pi<float>())
-                    _planeHeading -= glm::two_pi<float>();
-                else if (_planeHeading < 0.0f)
-                    _planeHeading += glm::two_pi<float>();
+                if (hero.heading > glm::two_pi<float>())
+                    hero.heading -= glm::two_pi<float>();
+                else if (hero.heading < 0.0f)
+                    hero.heading += glm::two_pi<float>();
 
                 float Y_OFFSET = 2.0f;
-                glm::vec3 intiLookAtPoint = _planePosition + glm::vec3(0.0f, Y_OFFSET, 0.0f);
+                glm::vec3 intiLookAtPoint = hero.position + glm::vec3(0.0f, Y_OFFSET, 0.0f);
                 _arcballCam->setLookAtPoint(intiLookAtPoint);
                 _updateIntiFirstPersonCamera();
             }
@@ -609,101 +981,174 @@ void MP::_updateScene(float deltaTime) {
             break;
     }
 
-    // Comprobar colisiones con las monedas
-    for (int i = 0; i < 4; ++i) {
-        // Solo comprobar monedas activas
-        if (_coins[i]->isActive()) {
-            // Calcular la distancia entre el héroe y la moneda
-            glm::vec3 coinPosition = _coinPositions[i];
-            glm::vec3 heroPosition = _planePosition;
-
-            float distance = glm::distance(coinPosition, heroPosition);
+    // Cargar y descargar tiles alrededor de la nueva posición del héroe
+    _world.update(hero.position);
 
-            // Si la distancia es menor que un umbral, consideramos que hay colisión
-            float collisionDistance = 2.5f; // Puedes ajustar este valor según el tamaño de tu héroe y moneda
-
-            if (distance < collisionDistance) {
-                // Desactivar la moneda
-                _coins[i]->deactivate();
-
-                // Opcional: Puedes llevar un conteo de monedas recogidas o desencadenar algún evento
-                std::cout << "¡Moneda recogida!" << std::endl;
-            }
-        }
+    // Comprobar colisiones con las monedas; si la distancia es menor que el umbral, se recoge
+    const float collisionDistance = 2.5f;
+    for (int i = _world.collectCoins(hero.position, collisionDistance, _frameArena); i > 0; --i) {
+        fprintf(stdout, "[INFO]: ¡Moneda recogida!\n");
     }
 
-    // Opcional: Actualizar zombies si tienen comportamientos
-    for(int i = 0; i < NUM_ZOMBIES; ++i) {
-        if(_zombies[i] != nullptr) {
-            _zombies[i]->update(deltaTime); // Implementa este método en la clase Zombie
-        }
+    // El campo solo se reconstruye si el héroe cambió de celda
+    _world.getTerrainTiles(_flowFieldTiles);
+    _flowField.update(hero.position, _flowFieldTiles);
+    // El nivel de detalle de los zombies depende de la cámara activa, con la proyección del
+    // tamaño del tick para que una reproducción clasifique igual en cualquier ventana
+    glm::mat4 tickProjectionMatrix = _projectionMatrix;
+    if (_tickFramebufferSize.x > 0 && _tickFramebufferSize.y > 0) {
+        const float tickAspectRatio = static_cast<float>(_tickFramebufferSize.x) / static_cast<float>(_tickFramebufferSize.y);
+        tickProjectionMatrix = glm::perspective(glm::radians(45.0f), tickAspectRatio, 0.1f, 1000.0f);
+    }
+    if (_currentCameraMode == ARCBALL) {
+        _agentUpdateScheduler.beginTick(_arcballCam->getPosition(), tickProjectionMatrix * _arcballCam->getViewMatrix());
+    } else {
+        _agentUpdateScheduler.beginTick(_intiFirstPersonCam->getPosition(), tickProjectionMatrix * _intiFirstPersonCam->getViewMatrix());
     }
+    _world.updateProps(deltaTime, _flowField, _crowdAvoidance, _agentUpdateScheduler);
+    _stressModelSwayTime += deltaTime;
 }
 
-void MP::run() {
-    glfwSetWindowUserPointer(mpWindow, this);
-
-    // Variables para manejar el tiempo
-    double previousTime = glfwGetTime();
-
-    while (!glfwWindowShouldClose(mpWindow)) {
-        double currentTime = glfwGetTime();
-        float deltaTime = static_cast<float>(currentTime - previousTime);
-        previousTime = currentTime;
-
-        glDrawBuffer(GL_BACK);
-        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+void MP::_buildFramePacket(FramePacket& packet) {
+    packet.frameNumber = ++_frameNumber;
 
-        GLint framebufferWidth, framebufferHeight;
-        glfwGetFramebufferSize(mpWindow, &framebufferWidth, &framebufferHeight);
+    GLint framebufferWidth, framebufferHeight;
+    glfwGetFramebufferSize(mpWindow, &framebufferWidth, &framebufferHeight);
+    packet.framebufferWidth = framebufferWidth;
+    packet.framebufferHeight = framebufferHeight;
+    packet.numViews = 0;
 
-        glViewport(0, 0, framebufferWidth, framebufferHeight);
+    // Ventana minimizada: no hay nada que dibujar y el aspect ratio sería inválido
+    if (framebufferWidth > 0 && framebufferHeight > 0) {
         float aspectRatio = static_cast<float>(framebufferWidth) / static_cast<float>(framebufferHeight);
         _projectionMatrix = glm::perspective(glm::radians(45.0f), aspectRatio, 0.1f, 1000.0f);
 
-        glm::mat4 viewMatrix;
-        glm::vec3 eyePosition;
-
+        FrameView& mainView = packet.views[packet.numViews++];
         if (_currentCameraMode == ARCBALL) {
-            viewMatrix = _arcballCam->getViewMatrix();
-            eyePosition = _arcballCam->getPosition();
-        } else if (_currentCameraMode == FIRST_PERSON_CAM) {
+            mainView.viewMtx = _arcballCam->getViewMatrix();
+            mainView.eyePosition = _arcballCam->getPosition();
+        } else {
             // Solo hay una cámara en primera persona para AARON_INTI
-            viewMatrix = _intiFirstPersonCam->getViewMatrix();
-            eyePosition = _intiFirstPersonCam->getPosition();
+            mainView.viewMtx = _intiFirstPersonCam->getViewMatrix();
+            mainView.eyePosition = _intiFirstPersonCam->getPosition();
         }
-
-        _renderScene(viewMatrix, _projectionMatrix, eyePosition);
+        mainView.projMtx = _projectionMatrix;
+        mainView.viewport[0] = 0;
+        mainView.viewport[1] = 0;
+        mainView.viewport[2] = framebufferWidth;
+        mainView.viewport[3] = framebufferHeight;
+        mainView.isInset = false;
 
         if (_isSmallViewportActive) {
-            GLint prevViewport[4];
-            glGetIntegerv(GL_VIEWPORT, prevViewport);
-
-            glClear(GL_DEPTH_BUFFER_BIT);
-
             GLint smallViewportWidth = framebufferWidth / 3;
             GLint smallViewportHeight = framebufferHeight / 3;
-            GLint smallViewportX = framebufferWidth - smallViewportWidth - 10;
-            GLint smallViewportY = framebufferHeight - smallViewportHeight - 10;
 
-            glViewport(smallViewportX, smallViewportY, smallViewportWidth, smallViewportHeight);
+            FrameView& smallView = packet.views[packet.numViews++];
+            smallView.viewMtx = _intiFirstPersonCam->getViewMatrix();
+            smallView.eyePosition = _intiFirstPersonCam->getPosition();
+            float smallAspectRatio = static_cast<float>(smallViewportWidth) / static_cast<float>(std::max(smallViewportHeight, 1));
+            smallView.projMtx = glm::perspective(glm::radians(45.0f), smallAspectRatio, 0.1f, 1000.0f);
+            smallView.viewport[0] = framebufferWidth - smallViewportWidth - 10;
+            smallView.viewport[1] = framebufferHeight - smallViewportHeight - 10;
+            smallView.viewport[2] = smallViewportWidth;
+            smallView.viewport[3] = smallViewportHeight;
+            smallView.isInset = true;
+        }
+    }
 
-            float smallAspectRatio = static_cast<float>(smallViewportWidth) / static_cast<float>(smallViewportHeight);
+    packet.lights = _sceneLights;
+
+    // clear() conserva la capacidad, así que tras el primer frame no se reserva memoria
+    packet.drawItems.clear();
+    packet.modelItems.clear();
+
+    // Un recorrido por tipo de modelo; cada uno lee su tabla de corrido
+    _registry.each<Aaron_Inti, ECS::Transform>([&packet](const Aaron_Inti& heroModel, const ECS::Transform& transform) {
+        glm::mat4 heroModelMtx(1.0f);
+        heroModelMtx = glm::translate(heroModelMtx, transform.position);
+        heroModelMtx = glm::translate(heroModelMtx, glm::vec3(0.0f, 1.3f, 0.0f));
+        heroModelMtx = glm::rotate(heroModelMtx, transform.heading, CSCI441::Y_AXIS);
+        heroModel.emitDrawItems(heroModelMtx, packet.drawItems);
+    });
+    _registry.each<Coin, ECS::Transform>([&packet](const Coin& coin, const ECS::Transform& transform) {
+        coin.emitDrawItems(glm::translate(glm::mat4(1.0f), transform.position), packet.drawItems);
+    });
+    _registry.each<Zombie>([&packet](const Zombie& zombie) {
+        zombie.emitDrawItems(glm::mat4(1.0f), packet.drawItems);
+    });
+    const glm::mat4& stressModelMtx = _stressModelMtx;
+    _registry.each<ECS::ModelInstance, ECS::Transform>([&packet, &stressModelMtx](const ECS::ModelInstance& instance, const ECS::Transform& transform) {
+        glm::mat4 modelMtx = glm::translate(glm::mat4(1.0f), transform.position);
+        modelMtx = glm::rotate(modelMtx, transform.heading, CSCI441::Y_AXIS);
+        packet.modelItems.push_back(DrawItem::make(DrawMesh::MODEL, modelMtx * stressModelMtx, instance.color, 16.0f));
+    });
+    packet.modelSwayAngle = ModelSway::angleAt(_stressModelSwayTime);
+
+    // Terreno de los tiles residentes
+    _world.getTerrainTiles(packet.terrainTiles);
+
+    packet.producedAt = FrameStats::Clock::now();
+}
 
-            glm::mat4 smallProjectionMatrix = glm::perspective(glm::radians(45.0f), smallAspectRatio, 0.1f, 1000.0f);
+void MP::run() {
+    glfwSetWindowUserPointer(mpWindow, this);
 
-            glm::mat4 fpViewMatrix = _intiFirstPersonCam->getViewMatrix();
-            glm::vec3 fpEyePosition = _intiFirstPersonCam->getPosition();
+    // El hilo de render toma el contexto GL; este hilo solo simula y procesa eventos
+    if (_useRenderThread) {
+        _pRenderThread = new RenderThread(mpWindow, [this](const FramePacket& packet) { _renderFrame(packet); }, _frameStats);
+        _pRenderThread->start();
+    }
 
-            _renderScene(fpViewMatrix, smallProjectionMatrix, fpEyePosition);
+    // Variables para manejar el tiempo
+    double previousTime = glfwGetTime();
 
-            glViewport(prevViewport[0], prevViewport[1], prevViewport[2], prevViewport[3]);
-        }
+    AllocationTracker::registerThread("simulation");
+
+    while (!glfwWindowShouldClose(mpWindow)) {
+        double currentTime = glfwGetTime();
+        float deltaTime = static_cast<float>(currentTime - previousTime);
+        previousTime = currentTime;
+
+        // Nada del frame anterior sigue vivo: el paquete ya tiene su propia copia
+        _frameArena.reset();
 
+        const FrameStats::Clock::time_point simulationStart = FrameStats::Clock::now();
         _updateScene(deltaTime);
 
-        glfwSwapBuffers(mpWindow);
+        FramePacket& packet = _useRenderThread ? _pRenderThread->beginFrame() : _serialPacket;
+        _buildFramePacket(packet);
+        _frameStats.recordSimulation(std::chrono::duration<double>(FrameStats::Clock::now() - simulationStart).count());
+
+        if (_useRenderThread) {
+            // Se dibuja este paquete mientras se simula el siguiente
+            _pRenderThread->submitFrame();
+        } else {
+            const FrameStats::Clock::time_point renderStart = FrameStats::Clock::now();
+            _renderFrame(packet);
+            _frameStats.recordRender(std::chrono::duration<double>(FrameStats::Clock::now() - renderStart).count());
+            glfwSwapBuffers(mpWindow);
+            _frameStats.recordPresented(packet.producedAt);
+            if (CSCI441::GLCallTracer::isInstalled()) {
+                _frameStats.recordGLCalls(CSCI441::GLCallTracer::endFrame());
+            }
+        }
+
         glfwPollEvents();
+        AllocationTracker::endFrame();
+    }
+
+    // Devolver el contexto a este hilo antes de la limpieza
+    if (_pRenderThread != nullptr) {
+        _pRenderThread->stop();
+        delete _pRenderThread;
+        _pRenderThread = nullptr;
+    }
+
+    _frameStats.printReport(_useRenderThread ? "render thread" : "single thread");
+    _stressScene.appendResults(_randomSeed, _frameStats.summarize(), AllocationTracker::getPeakLiveBytes());
+
+    if (!_softwareCaptureFilename.empty()) {
+        _captureSoftwareFrame();
     }
 }
 
@@ -711,18 +1156,53 @@ void MP::run() {
 //
 // Private Helper Functions
 
+void MP::_captureSoftwareFrame() {
+    // Un paquete nuevo con el estado final: los del hilo de render ya se reciclaron
+    FramePacket packet;
+    _buildFramePacket(packet);
+    if (packet.numViews == 0) {
+        fprintf(stderr, "[WARN]: Software capture skipped: the window has no framebuffer\n");
+        return;
+    }
+
+    const FrameView& view = packet.views[0];
+    SoftwareRasterizer::Settings settings;
+    settings.width = view.viewport[2];
+    settings.height = view.viewport[3];
+    SoftwareRasterizer rasterizer;
+    rasterizer.start(settings);
+    // El modelo queda en la pose del paquete y sus copias se dibujan después de las demás piezas,
+    // en el mismo orden que el renderizador
+    glm::mat4 boneMatrices[ModelSway::NUM_BONES];
+    _stressModelSway.computeBoneMatrices(packet.modelSwayAngle, boneMatrices);
+    rasterizer.setModelMesh(_stressModel, &_stressModelSway.getWeights(), boneMatrices);
+    packet.drawItems.insert(packet.drawItems.end(), packet.modelItems.begin(), packet.modelItems.end());
+
+    const FrameStats::Clock::time_point start = FrameStats::Clock::now();
+    rasterizer.render(view, packet.lights, packet.drawItems);
+    const double elapsed = std::chrono::duration<double>(FrameStats::Clock::now() - start).count();
+
+    if (rasterizer.writePPM(_softwareCaptureFilename.c_str())) {
+        const SoftwareRasterizer::Stats& stats = rasterizer.getStats();
+        fprintf(stdout, "[INFO]: Software capture written to %s: %zu draw items, %zu triangles, %zu fragments in %.1f ms on %d threads\n",
+                _softwareCaptureFilename.c_str(), packet.drawItems.size(), stats.trianglesSubmitted, stats.fragmentsWritten,
+                elapsed * 1000.0, rasterizer.getNumThreads());
+    }
+}
+
 void MP::_updateIntiFirstPersonCamera() {
+    const ECS::Transform& hero = _heroTransform();
     glm::vec3 offset(0.0f, 4.0f, 0.0f);
-    glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), _planeHeading, CSCI441::Y_AXIS);
+    glm::mat4 rotation = glm::rotate(glm::mat4(1.0f), hero.heading, CSCI441::Y_AXIS);
     glm::vec3 rotatedOffset = glm::vec3(rotation * glm::vec4(offset, 0.0f));
 
-    glm::vec3 cameraPosition = _planePosition + rotatedOffset;
+    glm::vec3 cameraPosition = hero.position + rotatedOffset;
     _intiFirstPersonCam->setPosition(cameraPosition);
 
     glm::vec3 facingDirection = glm::vec3(
-        sinf(_planeHeading),
+        sinf(hero.heading),
         0.0f,
-        cosf(_planeHeading)
+        cosf(hero.heading)
     );
 
     glm::vec3 backwardDirection = -facingDirection;
@@ -833,21 +1313,9 @@ void MP::_setupSkybox() {
         "textures/skybox/back.bmp"
     };
     _skyboxTexture = loadCubemap(faces);
-    _skyboxShaderProgram = new CSCI441::ShaderProgram("shaders/skybox.v.glsl", "shaders/skybox.f.glsl");
-    _skyboxShaderProgram->useProgram();
-    _skyboxShaderProgram->setProgramUniform("skybox", 0);
 }
 
 
-void MP::_computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const {
-    // Precompute the Model-View-Projection matrix on the CPU
-    glm::mat4 mvpMtx = projMtx * viewMtx * modelMtx;
-    // Then send it to the shader on the GPU to apply to every vertex
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.mvpMatrix, mvpMtx);
-    glm::mat3 normalMtx = glm::transpose(glm::inverse(glm::mat3(modelMtx)));
-    _lightingShaderProgram->setProgramUniform(_lightingShaderUniformLocations.normalMatrix, normalMtx);
-}
-
 //*************************************************************************************
 //
 // Callbacks
@@ -855,20 +1323,20 @@ void MP::_computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, gl
 void A3_engine_keyboard_callback(GLFWwindow *window, int key, int scancode, int action, int mods ) {
     auto engine = static_cast<MP*>(glfwGetWindowUserPointer(window));
 
-    // Pasar la tecla y la acción al engine
-    engine->handleKeyEvent(key, action);
+    // Encolar la tecla y la acción; el engine la procesa en su siguiente tick
+    engine->pushInputEvent(InputEvent::key(key, action));
 }
 
 void A3_engine_cursor_callback(GLFWwindow *window, double x, double y ) {
     auto engine = static_cast<MP*>(glfwGetWindowUserPointer(window));
 
-    // Pasar la posición del cursor al engine
-    engine->handleCursorPositionEvent(glm::vec2(static_cast<float>(x), static_cast<float>(y)));
+    // Encolar la posición del cursor; los desplazamientos se acumulan por tick
+    engine->pushInputEvent(InputEvent::cursor(static_cast<float>(x), static_cast<float>(y)));
 }
 
 void A3_engine_mouse_button_callback(GLFWwindow *window, int button, int action, int mods ) {
     auto engine = static_cast<MP*>(glfwGetWindowUserPointer(window));
 
-    // Pasar el botón del mouse y la acción al engine
-    engine->handleMouseButtonEvent(button, action);
+    // Encolar el botón del mouse y la acción
+    engine->pushInputEvent(InputEvent::mouseButton(button, action));
 }
@@ -1,20 +1,38 @@
 #ifndef MP_ENGINE_H
 #define MP_ENGINE_H
 
-#include "Cameras/ArcballCam.h"
+#include "Cameras/Arcballcam.h"
 #include <OpenGLEngine.hpp>
 #include <ShaderProgram.hpp>
+#include <ShaderPermutation.hpp>
 #include "FreeCam.hpp"
 
-#include "Heroes/Aaron_Inti.h"
-#include "Coin.h"
-#include "Enemies/Zombie.h" // Incluir el header de Zombie
+#include "ECS/Components.h"
+#include "ECS/Registry.h"
+#include "LightingVariant.h"
+#include "Memory/FrameArena.h"
+#include "Render/FramePacket.h"
+#include "Render/InstancedModelBatch.h"
+#include "Render/ModelSway.h"
+#include "Render/OffscreenInset.h"
+#include "Render/FrameStats.h"
+#include "Render/DynamicResolution.h"
+#include "Render/RenderThread.h"
+#include "Input/InputEvent.h"
+#include "Input/SpscRing.h"
+#include "Input/InputRecording.h"
+#include "Terrain/Terrain.h"
+#include "World/StressScene.h"
+#include "World/WorldStreamer.h"
 
 #include "stb_image.h"
 #include <glad/gl.h>
+#include <atomic>
 #include <vector>
 #include <string>
 
+namespace CSCI441 { class ModelLoader; }
+
 /**
  * @class MP
  * @brief Clase principal del motor que gestiona la escena, cámaras, iluminación y objetos.
@@ -36,6 +54,16 @@ public:
      */
     void run() final;
 
+    /**
+     * @brief Encola un evento de entrada; es lo único que hacen los callbacks de GLFW.
+     *
+     * El evento se aplica al inicio del siguiente _updateScene(), sin depender de cuándo
+     * se llame a glfwPollEvents().
+     *
+     * @param event Evento capturado por el callback.
+     */
+    void pushInputEvent(const InputEvent& event);
+
     /**
      * @brief Maneja eventos de teclado.
      *
@@ -55,23 +83,123 @@ public:
     /**
      * @brief Maneja eventos de movimiento del cursor.
      *
+     * Solo acumula el desplazamiento; la cámara se actualiza una vez por tick.
+     *
      * @param currMousePosition Posición actual del cursor.
      */
     void handleCursorPositionEvent(glm::vec2 currMousePosition);
 
-    static constexpr GLfloat MOUSE_UNINITIALIZED = -9999.0f;
+    /**
+     * @brief Elige si el render se ejecuta en un hilo dedicado o en serie con la simulación.
+     *
+     * @param enabled true para usar el hilo de render (por defecto).
+     */
+    void setRenderThreadEnabled(bool enabled) { _useRenderThread = enabled; }
 
-private:
-    // COINS
+    /**
+     * @brief Configura el escalado dinámico de resolución; debe llamarse antes de initialize().
+     *
+     * @param settings Límites de escala, presupuesto de GPU e histéresis.
+     */
+    void setDynamicResolutionSettings(const DynamicResolution::Settings& settings) { _dynamicResolutionSettings = settings; }
 
-    Coin* _coins[4]; // Arreglo para almacenar las cuatro monedas
-    glm::vec3 _coinPositions[4];
+    /**
+     * @brief Dibuja todas las vistas en una sola pasada, enviando cada objeto una vez.
+     *
+     * Cada draw se instancia una vez por vista; debe llamarse antes de initialize(). Con esta
+     * opción el inset se dibuja en la misma pasada y no usa el framebuffer fuera de pantalla.
+     *
+     * @param enabled true para usar la ruta multi-view.
+     */
+    void setMultiViewEnabled(bool enabled) { _useMultiView = enabled; }
+
+    /**
+     * @brief Configura la resolución y frecuencia de la vista en primera persona superpuesta.
+     *
+     * @param settings Escala del framebuffer del inset y cada cuántos frames se actualiza.
+     */
+    void setInsetSettings(const OffscreenInset::Settings& settings) { _offscreenInsetSettings = settings; }
+
+    /**
+     * @brief Configura los tiles del terreno; debe llamarse antes de initialize().
+     *
+     * @param settings Tamaño y altura de cada tile, tamaño de los chunks y presupuesto de
+     *                 triángulos compartido por todos los tiles visibles.
+     */
+    void setTerrainSettings(const Terrain::Settings& settings) { _terrainSettings = settings; }
+
+    /**
+     * @brief Configura la carga de tiles alrededor del héroe; debe llamarse antes de initialize().
+     *
+     * @param settings Radios de carga y descarga, presupuesto de memoria e hilos de fondo.
+     */
+    void setWorldStreamerSettings(const WorldStreamer::Settings& settings) { _worldStreamerSettings = settings; }
+
+    /**
+     * @brief Configura el campo de direcciones que siguen los zombies; debe llamarse antes de initialize().
+     *
+     * @param settings Tamaño de la ventana alrededor del héroe y criterio de obstáculos.
+     */
+    void setFlowFieldSettings(const FlowField::Settings& settings) { _flowFieldSettings = settings; }
+
+    /**
+     * @brief Configura la evasión entre zombies; debe llamarse antes de initialize().
+     *
+     * @param settings Radio y vecindario de cada zombie, horizonte de evasión e hilos.
+     */
+    void setCrowdAvoidanceSettings(const CrowdAvoidance::Settings& settings) { _crowdAvoidanceSettings = settings; }
+
+    /**
+     * @brief Configura cada cuánto se actualizan los zombies lejanos o fuera de cámara.
+     *
+     * @param settings Distancias de cada grupo, sus intervalos y el presupuesto por tick.
+     */
+    void setAgentUpdateSettings(const AgentUpdateScheduler::Settings& settings) { _agentUpdateScheduler.setSettings(settings); }
+
+    /**
+     * @brief Reemplaza el mundo por una escena de prueba con cantidades fijas de zombies,
+     * monedas, luces y copias de un modelo; debe llamarse antes de initialize().
+     *
+     * @param settings Cantidades, modelo, radio y archivo de resultados.
+     */
+    void setStressSceneSettings(const StressScene::Settings& settings) { _stressScene.setSettings(settings); }
+
+    /**
+     * @brief Fija la semilla del mundo en lugar de la hora actual; debe llamarse antes de
+     * initialize() y de recordInputTo(). Una reproducción usa la semilla grabada.
+     */
+    void setRandomSeed(uint32_t seed);
+
+    /**
+     * @brief Al cerrar la ventana dibuja el último frame en la CPU con SoftwareRasterizer y lo
+     * guarda como PPM, para compararlo con la imagen de OpenGL.
+     *
+     * Solo se dibujan las piezas de la vista principal (héroe, monedas, zombies y modelos); el
+     * terreno y el skybox no.
+     *
+     * @param FILENAME Archivo de salida.
+     */
+    void setSoftwareCapture(const char* FILENAME) { _softwareCaptureFilename = FILENAME; }
+
+    /**
+     * @brief Graba la entrada de cada tick y la semilla aleatoria en un archivo.
+     *
+     * @param FILENAME Archivo de salida.
+     */
+    void recordInputTo(const char* FILENAME);
+
+    /**
+     * @brief Reproduce una grabación en lugar de la entrada real; la ventana se cierra al terminar.
+     *
+     * Debe llamarse antes de initialize() para que la semilla se aplique antes de crear la escena.
+     *
+     * @param FILENAME Archivo grabado con recordInputTo().
+     */
+    void replayInputFrom(const char* FILENAME);
 
-    // ZOMBIES
-    static constexpr int NUM_ZOMBIES = 8;
-    Zombie* _zombies[NUM_ZOMBIES]; // Arreglo para almacenar los ocho zombies
-    glm::vec3 _zombiePositions[NUM_ZOMBIES]; // Arreglo para las posiciones de los zombies
+    static constexpr GLfloat MOUSE_UNINITIALIZED = -9999.0f;
 
+private:
     struct CameraFrame {
         glm::vec3 eye;
         glm::vec3 direction;
@@ -84,8 +212,6 @@ private:
     Character _selectedCharacter;
 
     glm::mat4 _projectionMatrix;
-    glm::vec3 _planePosition;
-    float _planeHeading;
 
     void mSetupGLFW() final;
     void mSetupOpenGL() final;
@@ -96,12 +222,67 @@ private:
     void mCleanupBuffers() final;
     void mCleanupShaders() final;
 
-    // Dibuja la escena desde un punto de vista específico de la cámara
-    void _renderScene(glm::mat4 viewMtx, glm::mat4 projMtx, glm::vec3 eyePosition) const;
+    // Dibuja un paquete completo (todas sus vistas); se ejecuta en el hilo que posee el contexto
+    void _renderFrame(const FramePacket& packet);
+
+    // Dibuja la escena desde un punto de vista del paquete
+    void _renderScene(const FrameView& view, const FramePacket& packet);
+
+    // Dibuja la escena en todas las vistas del paquete enviando cada objeto una sola vez
+    void _renderSceneMultiView(const FramePacket& packet, const GLint viewports[][4]);
+
+    // Dibuja el skybox con la rotación de la vista
+    void _drawSkybox(const FrameView& view) const;
 
     // Actualiza elementos de la escena basados en el tiempo y la entrada
     void _updateScene(float deltaTime);
 
+    // ENTRADA
+
+    static constexpr size_t INPUT_QUEUE_CAPACITY = 1024;
+    SpscRing<InputEvent, INPUT_QUEUE_CAPACITY> _inputQueue;
+    std::atomic<uint32_t> _droppedInputEvents{0};
+
+    // Desplazamiento del cursor acumulado durante el tick
+    glm::vec2 _pendingArcballRotation = glm::vec2(0.0f);
+    float _pendingArcballZoom = 0.0f;
+
+    // Eventos del tick actual, de la cola o de la reproducción
+    std::vector<InputEvent> _tickEvents;
+    glm::ivec2 _tickFramebufferSize = glm::ivec2(0);   // el de la ventana, o el grabado al reproducir
+
+    // GRABACIÓN Y REPRODUCCIÓN
+    uint32_t _randomSeed;
+    InputRecorder _inputRecorder;
+    InputReplay _inputReplay;
+
+    // Reúne los eventos del tick (y el deltaTime si se está reproduciendo), los graba, los
+    // aplica en orden y actualiza la cámara con el movimiento del cursor acumulado
+    void _processInputEvents(float& deltaTime);
+
+    // Copia el estado de la escena ya actualizada a un paquete inmutable para el render
+    void _buildFramePacket(FramePacket& packet);
+
+    // Dibuja el estado final con SoftwareRasterizer y lo escribe en _softwareCaptureFilename
+    void _captureSoftwareFrame();
+    std::string _softwareCaptureFilename;
+
+    // HILO DE RENDER
+
+    bool _useRenderThread = true;
+    RenderThread* _pRenderThread = nullptr;
+    FramePacket _serialPacket;              // paquete reutilizado cuando no hay hilo de render
+    FrameStats _frameStats;
+    uint64_t _frameNumber = 0;
+
+    DynamicResolution::Settings _dynamicResolutionSettings;
+    DynamicResolution _dynamicResolution;   // solo lo usa el hilo de render
+    OffscreenInset::Settings _offscreenInsetSettings;
+    OffscreenInset _offscreenInset;         // solo lo usa el hilo de render
+
+    SceneLights _sceneLights;               // lo modifica la simulación
+    uint32_t _sentLightsRevision = 0;       // solo lo toca el hilo de render
+
     static constexpr GLuint NUM_KEYS = GLFW_KEY_LAST;
     GLboolean _keys[NUM_KEYS];
 
@@ -114,15 +295,70 @@ private:
     CSCI441::FreeCam* _intiFirstPersonCam;
     glm::vec2 _cameraSpeed;
 
-    Aaron_Inti* _pPlane;
 
 
-    static constexpr GLfloat WORLD_SIZE = 105.0f;
-    GLuint _groundVAO;
-    GLsizei _numGroundPoints;
+    // MUNDO
+
+    // Héroe, monedas y zombies son entidades; el registro se declara antes que _world porque
+    // _world destruye las suyas al detenerse
+    ECS::Registry _registry;
+    ECS::Entity _hero;
+
+    /**
+     * @brief Posición y orientación del héroe; la referencia deja de valer si se crea otro héroe.
+     */
+    ECS::Transform& _heroTransform() { return *_registry.get<ECS::Transform>(_hero); }
+
+    // Terreno, monedas y zombies se cargan por tiles alrededor del héroe
+    Terrain::Settings _terrainSettings;
+    WorldStreamer::Settings _worldStreamerSettings;
+    WorldStreamer _world;                   // solo lo usa la simulación
+
+    // Los zombies de todos los tiles siguen un único campo de direcciones hacia el héroe
+    FlowField::Settings _flowFieldSettings;
+    FlowField _flowField;
+    std::vector<std::shared_ptr<Terrain>> _flowFieldTiles;
+
+    // Y se separan entre sí para no amontonarse al alcanzarlo
+    CrowdAvoidance::Settings _crowdAvoidanceSettings;
+    CrowdAvoidance _crowdAvoidance;
+
+    // Los lejanos y los que no se ven se actualizan con menos frecuencia
+    AgentUpdateScheduler _agentUpdateScheduler;
+
+    // Modo de estrés: los tiles solo traen terreno y la escena crea todas las entidades
+    StressScene _stressScene;
+    CSCI441::ModelLoader* _stressModel = nullptr;   // malla de las piezas DrawMesh::MODEL
+    glm::mat4 _stressModelMtx = glm::mat4(1.0f);    // apoya el modelo en el suelo con 2 unidades de lado
+    ModelSway _stressModelSway;
+    float _stressModelSwayTime = 0.0f;              // segundos de simulación; se reproduce igual
+    InstancedModelBatch _stressModelBatch;          // después de crearlo, solo lo usa el hilo de render
+
+    // Carga el modelo del modo de estrés y calcula la matriz que lo ajusta a su tamaño
+    void _loadStressModel();
+
+    // Datos de la simulación que solo viven un frame; se vacía al empezar cada vuelta de run()
+    FrameArena _frameArena;
 
-    void _createGroundBuffers();
+    // Tiles con mallas en la GPU; solo los usa el hilo de render
+    std::vector<std::shared_ptr<Terrain>> _uploadedTerrainTiles;
+    Terrain::Selection _terrainSelection;
+    static constexpr int MAX_TILE_UPLOADS_PER_FRAME = 1;
 
+    void _startWorldStreaming();
+
+    // Sube los tiles nuevos del paquete, unos pocos por frame, y libera los que ya no están
+    void _updateTerrainUploads(const FramePacket& packet);
+
+    // Dibuja los tiles subidos con el programa de terreno en uso, repartiendo el presupuesto de
+    // triángulos del más cercano al más lejano
+    void _drawTerrainTiles(const FramePacket& packet, const glm::vec3& lodEye, const glm::mat4* viewProjectionMatrices, int numViews);
+
+    // Todas las variantes de A3.v.glsl; la cache es dueña de los programas
+    CSCI441::ShaderPermutationCache* _lightingPermutations = nullptr;
+
+    // Variante completa (Phong con todas las luces) para el héroe, monedas y zombies
+    LightingVariant _lightingVariant;
     CSCI441::ShaderProgram* _lightingShaderProgram = nullptr;
 
     struct LightingShaderUniformLocations {
@@ -130,40 +366,83 @@ private:
         GLint normalMatrix;
         GLint eyePosition;
 
-        GLint lightDirection;
-        GLint lightAmbientColor;
-        GLint lightDiffuseColor;
-        GLint lightSpecularColor;
+        GLint materialAmbientColor;
+        GLint materialDiffuseColor;
+        GLint materialSpecularColor;
+        GLint materialShininess;
+    } _lightingShaderUniformLocations;
+
+    // Variante Lambert para el terreno, que no tiene componente especular
+    LightingVariant _groundVariant;
+    CSCI441::ShaderProgram* _groundShaderProgram = nullptr;
+
+    struct GroundShaderUniformLocations {
+        GLint mvpMatrix;
+        GLint normalMatrix;
+        GLint eyePosition;
+
+        GLint materialAmbientColor;
+        GLint materialDiffuseColor;
+    } _groundShaderUniformLocations;
+
+    // Variante instanciada y con skinning para las copias del modelo del modo de estrés; solo
+    // se compila si la escena coloca modelos
+    LightingVariant _stressModelVariant;
+    CSCI441::ShaderProgram* _stressModelShaderProgram = nullptr;
+
+    struct StressModelShaderUniformLocations {
+        GLint viewProjectionMatrix;
+        GLint eyePosition;
+
+        GLint materialSpecularColor;
+        GLint materialShininess;
+        GLint boneMatrices;
+    } _stressModelShaderUniformLocations;
+
+    // MULTI-VIEW
+
+    bool _useMultiView = false;
+
+    // Variantes de A3.v.glsl con USE_MULTIVIEW; incluyen multiview.g.glsl si el driver no
+    // permite escribir gl_ViewportIndex desde el vertex shader
+    CSCI441::ShaderPermutationCache* _multiViewPermutations = nullptr;
+    LightingVariant _multiViewLightingVariant;
+    LightingVariant _multiViewGroundVariant;
+    CSCI441::ShaderProgram* _multiViewLightingShaderProgram = nullptr;
+    CSCI441::ShaderProgram* _multiViewGroundShaderProgram = nullptr;
+    // USE_INSTANCING usa gl_InstanceID para la vista, así que el modelo solo suma skinning
+    LightingVariant _multiViewStressModelVariant;
+    CSCI441::ShaderProgram* _multiViewStressModelShaderProgram = nullptr;
+
+    struct MultiViewShaderUniformLocations {
+        GLint modelMatrix;
+        GLint normalMatrix;
 
         GLint materialAmbientColor;
         GLint materialDiffuseColor;
         GLint materialSpecularColor;
         GLint materialShininess;
+        GLint boneMatrices;             // -1 sin USE_SKINNING
+    } _multiViewLightingUniformLocations, _multiViewGroundUniformLocations, _multiViewStressModelUniformLocations;
 
-        GLint pointLightPos;
-        GLint pointLightColor;
-        GLint pointLightConstant;
-        GLint pointLightLinear;
-        GLint pointLightQuadratic;
-
-        GLint spotLightPos;
-        GLint spotLightDirection;
-        GLint spotLightColor;
-        GLint spotLightCutoff;
-        GLint spotLightOuterCutoff;
-        GLint spotLightExponent;
-        GLint spotLightConstant;
-        GLint spotLightLinear;
-        GLint spotLightQuadratic;
-    } _lightingShaderUniformLocations;
+    // Mismo layout std140 que el bloque ViewBlock de A3.v.glsl
+    struct ViewBlock {
+        glm::mat4 viewProjectionMatrices[FramePacket::MAX_VIEWS];
+        glm::vec4 eyePositions[FramePacket::MAX_VIEWS];
+    };
+    static constexpr GLuint VIEW_BLOCK_BINDING = 0;
+    GLuint _viewUniformBuffer = 0;
+
+    static MultiViewShaderUniformLocations _getMultiViewUniformLocations(const CSCI441::ShaderProgram* shaderProgram);
+
+    // Envía las luces de la escena a una variante, omitiendo lo que no fue compilado
+    static void _sendLightUniforms(const CSCI441::ShaderProgram* shaderProgram, const LightingVariant& variant, const SceneLights& lights);
 
     struct LightingShaderAttributeLocations {
         GLint vPos;
         GLint vNormal;
     } _lightingShaderAttributeLocations;
 
-    void _computeAndSendMatrixUniforms(glm::mat4 modelMtx, glm::mat4 viewMtx, glm::mat4 projMtx) const;
-
     bool _isShiftPressed;
     bool _isLeftMouseButtonPressed;
     bool _isZooming;
@@ -181,6 +460,11 @@ private:
     GLuint _skyboxTexture;
     CSCI441::ShaderProgram* _skyboxShaderProgram = nullptr;
 
+    struct SkyboxShaderUniformHandles {
+        CSCI441::UniformHandle<glm::mat4> view;
+        CSCI441::UniformHandle<glm::mat4> projection;
+    } _skyboxShaderUniformHandles;
+
     GLuint loadCubemap(const std::vector<std::string>& faces);
     void _setupSkybox();
 };
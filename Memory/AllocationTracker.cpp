@@ -0,0 +1,283 @@
+#include "AllocationTracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+
+/*
+ *  Todo el estado es estático y se inicializa en cero antes que cualquier constructor global:
+ *  operator new puede llamarse antes de main() y desde cualquier hilo, y nunca debe reservar.
+ */
+namespace {
+    constexpr int MAX_TAGS = 64;
+    constexpr int MAX_THREADS = 8;
+    constexpr size_t MAX_REPORTED_FAILURES = 16;
+
+    // Va justo antes de la memoria que recibe quien reserva
+    struct alignas(16) Header {
+        size_t size;
+        uint32_t offset;                    // distancia al inicio del bloque de malloc
+        uint32_t tracked;                   // reservado con el contador activo
+    };
+    static_assert(sizeof(Header) == 16, "Header must keep the default new alignment");
+
+    struct TagStats {
+        const char* name;
+        bool occasional;
+        std::atomic<size_t> allocations;
+        std::atomic<size_t> bytes;
+    };
+
+    // Solo la escribe su hilo; el reporte se lee al final con los hilos detenidos
+    struct ThreadStats {
+        const char* name;
+        size_t frames;
+
+        // Frame en curso
+        size_t frameAllocations;
+        size_t frameBytes;
+        size_t frameUnexpected;             // fuera de etiquetas ocasionales
+        int firstUnexpectedTag;
+        size_t firstUnexpectedSize;
+
+        size_t totalFrameAllocations;
+        size_t maxFrameAllocations;
+        size_t maxFrameBytes;
+        size_t framesWithAllocations;
+        size_t failedFrames;
+    };
+
+    std::atomic<bool> enabled{false};
+    std::atomic<bool> failed{false};
+    std::atomic<size_t> warmUpFrames{SIZE_MAX};
+
+    std::atomic<size_t> totalAllocations{0};
+    std::atomic<size_t> totalBytes{0};
+    std::atomic<size_t> liveBytes{0};
+    std::atomic<size_t> peakLiveBytes{0};
+
+    TagStats tags[MAX_TAGS];
+    std::atomic<int> numTags{0};
+    std::mutex tagMutex;
+
+    ThreadStats threads[MAX_THREADS];
+    std::atomic<int> numThreads{0};
+
+    thread_local ThreadStats* currentThread = nullptr;
+    thread_local int currentTag = -1;
+
+    const char* tagName(int tag) { return tag >= 0 ? tags[tag].name : "untagged code"; }
+
+    int findOrAddTag(const char* name, bool occasional) {
+        int count = numTags.load(std::memory_order_acquire);
+        for (int i = 0; i < count; ++i) {
+            if (tags[i].name == name) return i;
+        }
+        std::lock_guard<std::mutex> lock(tagMutex);
+        count = numTags.load(std::memory_order_relaxed);
+        for (int i = 0; i < count; ++i) {
+            if (tags[i].name == name) return i;
+        }
+        if (count == MAX_TAGS) return -1;
+        tags[count].name = name;
+        tags[count].occasional = occasional;
+        numTags.store(count + 1, std::memory_order_release);
+        return count;
+    }
+
+    void recordAllocation(size_t size) {
+        totalAllocations.fetch_add(1, std::memory_order_relaxed);
+        totalBytes.fetch_add(size, std::memory_order_relaxed);
+        const size_t live = liveBytes.fetch_add(size, std::memory_order_relaxed) + size;
+        size_t peak = peakLiveBytes.load(std::memory_order_relaxed);
+        while (live > peak && !peakLiveBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+
+        const int tag = currentTag;
+        bool occasional = false;
+        if (tag >= 0) {
+            tags[tag].allocations.fetch_add(1, std::memory_order_relaxed);
+            tags[tag].bytes.fetch_add(size, std::memory_order_relaxed);
+            occasional = tags[tag].occasional;
+        }
+
+        ThreadStats* thread = currentThread;
+        if (thread != nullptr) {
+            ++thread->frameAllocations;
+            thread->frameBytes += size;
+            if (!occasional && thread->frameUnexpected++ == 0) {
+                thread->firstUnexpectedTag = tag;
+                thread->firstUnexpectedSize = size;
+            }
+        }
+    }
+
+    void* allocate(size_t size, size_t alignment) noexcept {
+        // malloc ya alinea a max_align_t; lo que falte para alignment va antes de la cabecera
+        alignment = std::max(alignment, alignof(Header));
+        const size_t extra = sizeof(Header) + alignment - std::min(alignment, alignof(std::max_align_t));
+        if (size > SIZE_MAX - extra) return nullptr;
+
+        void* block = std::malloc(size + extra);
+        if (block == nullptr) return nullptr;
+        const uintptr_t address = (reinterpret_cast<uintptr_t>(block) + sizeof(Header) + alignment - 1) & ~(uintptr_t(alignment) - 1);
+
+        Header* header = reinterpret_cast<Header*>(address) - 1;
+        header->size = size;
+        header->offset = static_cast<uint32_t>(address - reinterpret_cast<uintptr_t>(block));
+        header->tracked = 0;
+        if (enabled.load(std::memory_order_relaxed)) {
+            header->tracked = 1;
+            recordAllocation(size);
+        }
+        return reinterpret_cast<void*>(address);
+    }
+
+    void* allocateOrThrow(size_t size, size_t alignment) {
+        for (;;) {
+            if (void* pointer = allocate(size, alignment)) return pointer;
+            const std::new_handler handler = std::get_new_handler();
+            if (handler == nullptr) throw std::bad_alloc();
+            handler();
+        }
+    }
+
+    void deallocate(void* pointer) noexcept {
+        if (pointer == nullptr) return;
+        const Header* header = static_cast<Header*>(pointer) - 1;
+        if (header->tracked != 0) {
+            liveBytes.fetch_sub(header->size, std::memory_order_relaxed);
+        }
+        std::free(static_cast<char*>(pointer) - header->offset);
+    }
+}
+
+AllocationTracker::Tag::Tag(const char* NAME, bool OCCASIONAL)
+    : _previous(currentTag) {
+    if (enabled.load(std::memory_order_relaxed)) {
+        currentTag = findOrAddTag(NAME, OCCASIONAL);
+    }
+}
+
+AllocationTracker::Tag::~Tag() {
+    currentTag = _previous;
+}
+
+void AllocationTracker::enable() {
+    enabled.store(true);
+}
+
+bool AllocationTracker::isEnabled() {
+    return enabled.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::assertNoFrameAllocations(size_t frames) {
+    warmUpFrames.store(frames);
+}
+
+bool AllocationTracker::hasFailed() {
+    return failed.load();
+}
+
+size_t AllocationTracker::getPeakLiveBytes() {
+    return peakLiveBytes.load(std::memory_order_relaxed);
+}
+
+void AllocationTracker::registerThread(const char* NAME) {
+    if (!isEnabled() || currentThread != nullptr) return;
+    const int index = numThreads.fetch_add(1);
+    if (index >= MAX_THREADS) {
+        fprintf(stderr, "[WARN]: Allocation tracker only counts frames for %d threads; %s is not counted\n", MAX_THREADS, NAME);
+        return;
+    }
+    threads[index].name = NAME;
+    currentThread = &threads[index];
+}
+
+void AllocationTracker::endFrame() {
+    ThreadStats* thread = currentThread;
+    if (thread == nullptr) return;
+
+    // Lo que reserve el reporte no cuenta para ningún frame
+    currentThread = nullptr;
+
+    ++thread->frames;
+    thread->totalFrameAllocations += thread->frameAllocations;
+    thread->maxFrameAllocations = std::max(thread->maxFrameAllocations, thread->frameAllocations);
+    thread->maxFrameBytes = std::max(thread->maxFrameBytes, thread->frameBytes);
+    if (thread->frameAllocations > 0) ++thread->framesWithAllocations;
+
+    if (thread->frameUnexpected > 0 && thread->frames > warmUpFrames.load(std::memory_order_relaxed)) {
+        failed.store(true);
+        if (++thread->failedFrames <= MAX_REPORTED_FAILURES) {
+            fprintf(stderr, "[ERROR]: Frame %zu of the %s thread allocated %zu times (%zu bytes); the first, %zu bytes, in %s\n",
+                    thread->frames, thread->name, thread->frameUnexpected, thread->frameBytes,
+                    thread->firstUnexpectedSize, tagName(thread->firstUnexpectedTag));
+        }
+    }
+
+    thread->frameAllocations = 0;
+    thread->frameBytes = 0;
+    thread->frameUnexpected = 0;
+    currentThread = thread;
+}
+
+void AllocationTracker::printReport() {
+    if (!isEnabled()) return;
+
+    fprintf(stdout, "[INFO]: Allocations: %zu (%.1f MB) since tracking started, peak %.1f MB live\n",
+            totalAllocations.load(), static_cast<double>(totalBytes.load()) / (1 << 20),
+            static_cast<double>(peakLiveBytes.load()) / (1 << 20));
+
+    const int registeredThreads = std::min(numThreads.load(), MAX_THREADS);
+    for (int i = 0; i < registeredThreads; ++i) {
+        const ThreadStats& thread = threads[i];
+        fprintf(stdout, "[INFO]:   %s thread: %.2f allocations per frame on average, at most %zu (%zu bytes); %zu of %zu frames allocated\n",
+                thread.name, thread.frames > 0 ? static_cast<double>(thread.totalFrameAllocations) / static_cast<double>(thread.frames) : 0.0,
+                thread.maxFrameAllocations, thread.maxFrameBytes, thread.framesWithAllocations, thread.frames);
+        if (thread.failedFrames > 0) {
+            fprintf(stdout, "[INFO]:   %s thread: %zu frames allocated after the %zu warm-up frames\n",
+                    thread.name, thread.failedFrames, warmUpFrames.load());
+        }
+    }
+
+    // Las etiquetas que más reservaron, de mayor a menor
+    int order[MAX_TAGS];
+    const int count = numTags.load();
+    for (int i = 0; i < count; ++i) {
+        order[i] = i;
+    }
+    std::sort(order, order + count, [](int a, int b) { return tags[a].allocations.load() > tags[b].allocations.load(); });
+    for (int i = 0; i < std::min(count, 8); ++i) {
+        const TagStats& tag = tags[order[i]];
+        fprintf(stdout, "[INFO]:   %s: %zu allocations (%.1f KB)%s\n", tag.name, tag.allocations.load(),
+                static_cast<double>(tag.bytes.load()) / 1024.0, tag.occasional ? ", occasional" : "");
+    }
+}
+
+// Reemplazos globales de operator new/delete; todos pasan por allocate() y deallocate()
+
+void* operator new(std::size_t size) { return allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size) { return allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocateOrThrow(size, static_cast<size_t>(alignment)); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return allocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__); }
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, static_cast<size_t>(alignment)); }
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return allocate(size, static_cast<size_t>(alignment)); }
+
+void operator delete(void* pointer) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { deallocate(pointer); }
@@ -0,0 +1,76 @@
+#ifndef MEMORY_ALLOCATION_TRACKER_H
+#define MEMORY_ALLOCATION_TRACKER_H
+
+#include <cstddef>
+
+/**
+ * @class AllocationTracker
+ * @brief Cuenta las reservas de operator new del programa: totales, bytes vivos y su pico,
+ * por etiqueta del lugar que reserva y por frame de los hilos que tienen frames.
+ *
+ * AllocationTracker.cpp reemplaza los operator new/delete globales. Mientras no se llame a
+ * enable() solo agregan una cabecera a cada reserva y no cuentan nada. Las reservas de malloc
+ * directas (GLFW, el driver) no pasan por aquí.
+ *
+ * Con assertNoFrameAllocations(), un frame posterior al calentamiento que reserve fuera de
+ * una etiqueta ocasional es una falla: se reporta y hasFailed() queda en true.
+ */
+class AllocationTracker {
+public:
+    /**
+     * @brief Etiqueta las reservas del hilo mientras el objeto vive.
+     */
+    class Tag {
+    public:
+        /**
+         * @param NAME Nombre del lugar; debe ser un literal (se guarda el puntero).
+         * @param OCCASIONAL true si aquí se reserva solo de vez en cuando y es esperable (cargar
+         * tiles o texturas, recoger una moneda): esas reservas no cuentan como fallas de un frame.
+         */
+        explicit Tag(const char* NAME, bool OCCASIONAL = false);
+        ~Tag();
+
+        Tag(const Tag&) = delete;
+        Tag& operator=(const Tag&) = delete;
+
+    private:
+        int _previous;
+    };
+
+    /**
+     * @brief Empieza a contar; las reservas anteriores no cuentan para los bytes vivos.
+     */
+    static void enable();
+    static bool isEnabled();
+
+    /**
+     * @brief A partir del frame warmUpFrames + 1 de cada hilo con frames, reservar es una falla.
+     */
+    static void assertNoFrameAllocations(size_t warmUpFrames);
+    static bool hasFailed();
+
+    /**
+     * @brief Máximo de bytes vivos desde enable(); 0 si no está activo.
+     */
+    static size_t getPeakLiveBytes();
+
+    /**
+     * @brief El hilo que llama tiene frames; sus reservas se cuentan por frame.
+     *
+     * @param NAME Nombre del hilo para los reportes; debe ser un literal.
+     */
+    static void registerThread(const char* NAME);
+
+    /**
+     * @brief Cierra el frame del hilo que llama (registrado con registerThread()).
+     */
+    static void endFrame();
+
+    /**
+     * @brief Imprime totales, el pico de bytes vivos, los frames de cada hilo y las etiquetas
+     * que más reservaron.
+     */
+    static void printReport();
+};
+
+#endif // MEMORY_ALLOCATION_TRACKER_H
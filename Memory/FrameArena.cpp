@@ -0,0 +1,136 @@
+#include "FrameArena.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    size_t alignUp(size_t value, size_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+}
+
+FrameArena::FrameArena(size_t initialBytes) {
+    const size_t size = alignUp(std::max<size_t>(initialBytes, MAX_ALIGNMENT), MAX_ALIGNMENT);
+    _blocks.push_back({ _newBlock(size), size });
+    _blocks.reserve(8);
+}
+
+FrameArena::~FrameArena() {
+    for (const Block& block : _blocks) {
+        ::operator delete(block.data, std::align_val_t(MAX_ALIGNMENT));
+    }
+}
+
+void* FrameArena::allocate(size_t bytes, size_t alignment) {
+    if (alignment > MAX_ALIGNMENT || (alignment & (alignment - 1)) != 0) {
+        fprintf(stderr, "[ERROR]: Frame arena cannot align to %zu bytes\n", alignment);
+        std::abort();
+    }
+
+    const size_t start = alignUp(_offset, alignment);
+    if (start + bytes > _blocks[_current].size) {
+        return _allocateInNextBlock(bytes, alignment);
+    }
+    _offset = start + bytes;
+    _frameBytes = std::max(_frameBytes, _currentBase + _offset);
+    return _blocks[_current].data + start;
+}
+
+void FrameArena::deallocate(void* pointer, size_t bytes) {
+    std::byte* const end = static_cast<std::byte*>(pointer) + bytes;
+    if (end == _blocks[_current].data + _offset && static_cast<std::byte*>(pointer) >= _blocks[_current].data) {
+        _offset = static_cast<size_t>(static_cast<std::byte*>(pointer) - _blocks[_current].data);
+    }
+}
+
+void FrameArena::rewind(const Marker& marker) {
+    // Los bloques siguientes se conservan: el resto del frame los puede volver a usar
+    while (_current > marker.block) {
+        --_current;
+        _currentBase -= _blocks[_current].size;
+    }
+    _offset = marker.offset;
+}
+
+void FrameArena::reset() {
+    _peakBytes = std::max(_peakBytes, _frameBytes);
+
+    // Un solo bloque con lugar para todo lo que usó este frame
+    if (_blocks.size() > 1) {
+        for (const Block& block : _blocks) {
+            ::operator delete(block.data, std::align_val_t(MAX_ALIGNMENT));
+        }
+        size_t size = _blocks[0].size;
+        while (size < _frameBytes) {
+            size *= 2;
+        }
+        _blocks.clear();
+        _blocks.push_back({ _newBlock(size), size });
+    }
+
+    _current = 0;
+    _offset = 0;
+    _currentBase = 0;
+    _frameBytes = 0;
+    ++_frames;
+}
+
+std::byte* FrameArena::_newBlock(size_t size) {
+    ++_heapBlocks;
+    _lastHeapFrame = _frames;
+    return static_cast<std::byte*>(::operator new(size, std::align_val_t(MAX_ALIGNMENT)));
+}
+
+void* FrameArena::_allocateInNextBlock(size_t bytes, size_t alignment) {
+    // Un bloque que quedó de antes de un rewind() sirve si alcanza; si no, se descartan los
+    // siguientes (nada vivo apunta a ellos) y se pide uno nuevo
+    if (_current + 1 < _blocks.size() && bytes > _blocks[_current + 1].size) {
+        for (size_t i = _current + 1; i < _blocks.size(); ++i) {
+            ::operator delete(_blocks[i].data, std::align_val_t(MAX_ALIGNMENT));
+        }
+        _blocks.resize(_current + 1);
+    }
+    if (_current + 1 == _blocks.size()) {
+        const size_t size = alignUp(std::max(bytes, _blocks[_current].size), MAX_ALIGNMENT);
+        _blocks.push_back({ _newBlock(size), size });
+    }
+
+    _currentBase += _blocks[_current].size;
+    ++_current;
+    _offset = 0;
+    return allocate(bytes, alignment);
+}
+
+void FrameArena::printReport(const char* NAME) const {
+    fprintf(stdout, "[INFO]: %s frame arena: peak %.1f KB per frame, %zu KB block, %zu heap blocks, the last in frame %zu of %zu\n",
+            NAME, static_cast<double>(std::max(_peakBytes, _frameBytes)) / 1024.0, getCapacity() >> 10,
+            _heapBlocks, _lastHeapFrame, _frames);
+}
+
+void FrameArenas::resize(size_t numThreads, size_t initialBytes) {
+    _arenas.clear();
+    for (size_t i = 0; i < numThreads; ++i) {
+        _arenas.push_back(std::make_unique<FrameArena>(initialBytes));
+    }
+}
+
+void FrameArenas::reset() {
+    for (const std::unique_ptr<FrameArena>& arena : _arenas) {
+        arena->reset();
+    }
+}
+
+void FrameArenas::printReport(const char* NAME) const {
+    size_t peakBytes = 0, capacity = 0, heapBlocks = 0, lastHeapFrame = 0, frames = 0;
+    for (const std::unique_ptr<FrameArena>& arena : _arenas) {
+        peakBytes = std::max(peakBytes, arena->getPeakBytes());
+        capacity += arena->getCapacity();
+        heapBlocks += arena->getHeapBlocks();
+        lastHeapFrame = std::max(lastHeapFrame, arena->getLastHeapFrame());
+        frames = std::max(frames, arena->getFrames());
+    }
+    fprintf(stdout, "[INFO]: %s frame arenas (%zu threads): peak %.1f KB per thread and frame, %zu KB in blocks, %zu heap blocks, the last in frame %zu of %zu\n",
+            NAME, _arenas.size(), static_cast<double>(peakBytes) / 1024.0, capacity >> 10, heapBlocks, lastHeapFrame, frames);
+}
@@ -0,0 +1,155 @@
+#ifndef MEMORY_FRAME_ARENA_H
+#define MEMORY_FRAME_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+/**
+ * @class FrameArena
+ * @brief Memoria para datos que solo viven un frame: reservar es avanzar un puntero y reset()
+ * libera todo de una vez al terminar el frame.
+ *
+ * Si un frame no cabe en el bloque, se encadenan bloques del heap y el siguiente reset() los
+ * junta en uno del tamaño del pico, así que después de los primeros frames el arena no vuelve
+ * a pedir memoria. Cada arena es de un solo hilo; FrameArenas da uno por hilo.
+ */
+class alignas(64) FrameArena {
+public:
+    // Alineación de los bloques y máxima que se puede pedir
+    static constexpr size_t MAX_ALIGNMENT = 64;
+
+    /**
+     * @brief Posición a la que se puede volver con rewind().
+     */
+    struct Marker {
+        size_t block;
+        size_t offset;
+    };
+
+    explicit FrameArena(size_t initialBytes = 64 << 10);
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Reserva bytes con la alineación dada (potencia de dos, hasta MAX_ALIGNMENT).
+     * La memoria sigue válida hasta el próximo reset() o un rewind() anterior a ella.
+     */
+    void* allocate(size_t bytes, size_t alignment);
+
+    template<typename T>
+    T* allocateArray(size_t count) { return static_cast<T*>(allocate(count * sizeof(T), alignof(T))); }
+
+    /**
+     * @brief Devuelve la memoria solo si es lo último que se reservó; si no, no hace nada.
+     * Así un vector que crece al final del arena reutiliza su propio lugar.
+     */
+    void deallocate(void* pointer, size_t bytes);
+
+    Marker mark() const { return { _current, _offset }; }
+
+    /**
+     * @brief Libera todo lo reservado después de marker.
+     */
+    void rewind(const Marker& marker);
+
+    /**
+     * @brief Fin del frame: libera todo. Si hubo que encadenar bloques, el bloque principal
+     * crece hasta el pico para que el próximo frame quepa entero.
+     */
+    void reset();
+
+    size_t getCapacity() const { return _blocks.empty() ? 0 : _blocks[0].size; }
+    size_t getPeakBytes() const { return _peakBytes; }
+    size_t getHeapBlocks() const { return _heapBlocks; }
+    size_t getFrames() const { return _frames; }
+    // Último frame en que hubo que pedir un bloque al heap
+    size_t getLastHeapFrame() const { return _lastHeapFrame; }
+
+    /**
+     * @brief Imprime el pico por frame y en qué frame se pidió el último bloque al heap.
+     */
+    void printReport(const char* NAME) const;
+
+private:
+    struct Block {
+        std::byte* data;
+        size_t size;
+    };
+
+    std::byte* _newBlock(size_t size);
+    void* _allocateInNextBlock(size_t bytes, size_t alignment);
+
+    std::vector<Block> _blocks;         // el 0 es el principal; los demás, desbordes de este frame
+    size_t _current = 0;                // bloque en uso
+    size_t _offset = 0;                 // bytes usados del bloque en uso
+    size_t _currentBase = 0;            // bytes de los bloques anteriores al que está en uso
+    size_t _frameBytes = 0;             // máximo usado en este frame
+    size_t _peakBytes = 0;
+    size_t _heapBlocks = 0;
+    size_t _frames = 0;
+    size_t _lastHeapFrame = 0;
+};
+
+/**
+ * @brief Allocator de la STL sobre un FrameArena; deallocate() solo recupera la última reserva.
+ * Conviene reservar lo necesario de una vez: cada vez que un vector crece en medio del arena
+ * deja su lugar anterior sin usar hasta el fin del frame.
+ */
+template<typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(FrameArena& arena) noexcept : _arena(&arena) {}
+
+    template<typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : _arena(other.getArena()) {}
+
+    T* allocate(size_t count) { return _arena->allocateArray<T>(count); }
+    void deallocate(T* pointer, size_t count) noexcept { _arena->deallocate(pointer, count * sizeof(T)); }
+
+    FrameArena* getArena() const noexcept { return _arena; }
+
+    template<typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept { return _arena == other.getArena(); }
+    template<typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept { return _arena != other.getArena(); }
+
+private:
+    FrameArena* _arena;
+};
+
+// Vector que vive en un FrameArena; hay que descartarlo antes del reset() del arena
+template<typename T>
+using FrameVector = std::vector<T, ArenaAllocator<T>>;
+
+/**
+ * @class FrameArenas
+ * @brief Un FrameArena por hilo, para que los trabajos en paralelo de un frame reserven sin
+ * compartir nada. reset() solo se puede llamar con los hilos detenidos entre frames.
+ */
+class FrameArenas {
+public:
+    void resize(size_t numThreads, size_t initialBytes = 64 << 10);
+    size_t size() const { return _arenas.size(); }
+    bool empty() const { return _arenas.empty(); }
+
+    FrameArena& operator[](size_t thread) { return *_arenas[thread]; }
+    const FrameArena& operator[](size_t thread) const { return *_arenas[thread]; }
+
+    void reset();
+
+    /**
+     * @brief Imprime el reporte de todos los hilos combinado.
+     */
+    void printReport(const char* NAME) const;
+
+private:
+    // Cada arena alineado a su propia línea de caché: los hilos no se pisan los contadores
+    std::vector<std::unique_ptr<FrameArena>> _arenas;
+};
+
+#endif // MEMORY_FRAME_ARENA_H
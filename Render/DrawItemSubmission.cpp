@@ -0,0 +1,37 @@
+#include "DrawItemSubmission.h"
+
+#include <ModelLoader.hpp>
+#include <objects.hpp>
+
+void submitDrawItems(const CSCI441::ShaderProgram& shaderProgram, const DrawItemUniforms& uniforms,
+                     const glm::mat4* viewProjMtx, const std::vector<DrawItem>& drawItems,
+                     const CSCI441::ModelLoader* model) {
+    const glm::vec3 specularColor = glm::vec3(0.5f);
+    for (const DrawItem& item : drawItems) {
+        if (item.mesh == DrawMesh::MODEL && model == nullptr) continue;
+
+        if (viewProjMtx != nullptr) {
+            glm::mat4 mvpMtx = *viewProjMtx * item.modelMtx;
+            shaderProgram.setProgramUniform(uniforms.transformMatrix, mvpMtx);
+        } else {
+            shaderProgram.setProgramUniform(uniforms.transformMatrix, item.modelMtx);
+        }
+        shaderProgram.setProgramUniform(uniforms.normalMatrix, item.normalMtx);
+
+        glm::vec3 ambientColor = item.color * 0.2f;
+        shaderProgram.setProgramUniform(uniforms.materialAmbientColor, ambientColor);
+        shaderProgram.setProgramUniform(uniforms.materialDiffuseColor, item.color);
+        shaderProgram.setProgramUniform(uniforms.materialSpecularColor, specularColor);
+        shaderProgram.setProgramUniform(uniforms.materialShininess, item.shininess);
+
+        switch (item.mesh) {
+            case DrawMesh::CUBE:     CSCI441::drawSolidCube(1.0f); break;
+            case DrawMesh::SPHERE:   CSCI441::drawSolidSphere(1.0f, 20, 20); break;
+            case DrawMesh::CYLINDER: CSCI441::drawSolidCylinder(0.5f, 0.5f, 0.2f, 16, 16); break;
+            case DrawMesh::CONE:     CSCI441::drawSolidCone(1.0f, 1.0f, 20, 20); break;
+            // Sin ubicaciones de material: la pieza ya envió su color y el MTL se ignora
+            case DrawMesh::MODEL:    model->draw(shaderProgram.getShaderProgramHandle(), -1, -1, -1, -1, GL_TEXTURE0,
+                                                 CSCI441::getDrawInstanceCount()); break;
+        }
+    }
+}
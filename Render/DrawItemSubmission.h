@@ -0,0 +1,43 @@
+#ifndef RENDER_DRAW_ITEM_SUBMISSION_H
+#define RENDER_DRAW_ITEM_SUBMISSION_H
+
+#include "FramePacket.h"
+
+#include <ShaderProgram.hpp>
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace CSCI441 { class ModelLoader; }
+
+/**
+ * @struct DrawItemUniforms
+ * @brief Ubicaciones de los uniforms que recibe cada pieza en el shader de iluminación.
+ */
+struct DrawItemUniforms {
+    GLint transformMatrix;      // MVP, o la matriz de modelo si el shader multiplica por la vista
+    GLint normalMatrix;
+    GLint materialAmbientColor;
+    GLint materialDiffuseColor;
+    GLint materialSpecularColor;
+    GLint materialShininess;
+};
+
+/**
+ * @brief Envía los uniforms de cada pieza y la dibuja con la malla de objects.hpp que le toca.
+ *
+ * Es lo único que dibuja al héroe, las monedas y los zombies, así que el benchmark de llamadas
+ * GL mide exactamente lo que se envía en cada frame.
+ *
+ * @param shaderProgram Programa de iluminación, ya en uso.
+ * @param viewProjMtx Vista por proyección para armar el MVP, o nullptr para enviar la matriz de
+ * modelo tal cual (el shader multivista la multiplica por cada vista).
+ * @param model Malla de las piezas DrawMesh::MODEL; si es nullptr esas piezas no se dibujan.
+ */
+void submitDrawItems(const CSCI441::ShaderProgram& shaderProgram, const DrawItemUniforms& uniforms,
+                     const glm::mat4* viewProjMtx, const std::vector<DrawItem>& drawItems,
+                     const CSCI441::ModelLoader* model = nullptr);
+
+#endif // RENDER_DRAW_ITEM_SUBMISSION_H
@@ -0,0 +1,160 @@
+#include "DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+DynamicResolution::~DynamicResolution() {
+    cleanup();
+}
+
+void DynamicResolution::setup(const Settings& settings) {
+    _settings = settings;
+    _settings.minScale = std::clamp(_settings.minScale, 0.1f, 1.0f);
+    _settings.maxScale = std::clamp(_settings.maxScale, _settings.minScale, 2.0f);
+    _settings.targetFrameMs = std::max(_settings.targetFrameMs, 0.1f);
+    _settings.hysteresis = std::clamp(_settings.hysteresis, 0.0f, 0.9f);
+    _settings.framesBetweenChanges = std::max(_settings.framesBetweenChanges, 0);
+    _scale = _settings.maxScale;
+
+    if (!_settings.enabled) return;
+
+    glGenQueries(NUM_QUERIES, _queries);
+    fprintf(stdout, "[INFO]: Dynamic resolution: scale %.2f-%.2f, target %.2f ms, hysteresis %.0f%%\n",
+            _settings.minScale, _settings.maxScale, _settings.targetFrameMs, _settings.hysteresis * 100.0f);
+}
+
+void DynamicResolution::cleanup() {
+    if (_queries[0] != 0) {
+        glDeleteQueries(NUM_QUERIES, _queries);
+        for (GLuint& query : _queries) query = 0;
+    }
+    if (_framebuffer != 0) {
+        glDeleteFramebuffers(1, &_framebuffer);
+        glDeleteTextures(1, &_colorTexture);
+        glDeleteRenderbuffers(1, &_depthRenderbuffer);
+        _framebuffer = _colorTexture = _depthRenderbuffer = 0;
+    }
+    _targetWidth = _targetHeight = 0;
+}
+
+void DynamicResolution::beginFrame(GLint outputWidth, GLint outputHeight) {
+    _outputWidth = outputWidth;
+    _outputHeight = outputHeight;
+    _frameBegun = false;
+    _queryBegun = false;
+    if (!_settings.enabled) return;
+
+    // El destino se reserva a la escala máxima y cada frame usa solo una región
+    GLint targetWidth = std::max(1, static_cast<GLint>(std::ceil(static_cast<float>(outputWidth) * _settings.maxScale)));
+    GLint targetHeight = std::max(1, static_cast<GLint>(std::ceil(static_cast<float>(outputHeight) * _settings.maxScale)));
+    if (targetWidth != _targetWidth || targetHeight != _targetHeight) {
+        _resizeTarget(targetWidth, targetHeight);
+        if (!_settings.enabled) {
+            // El destino quedó incompleto: este frame y los siguientes van directo al backbuffer
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            return;
+        }
+    }
+
+    _renderWidth = std::clamp(static_cast<GLint>(static_cast<float>(outputWidth) * _scale), 1, _targetWidth);
+    _renderHeight = std::clamp(static_cast<GLint>(static_cast<float>(outputHeight) * _scale), 1, _targetHeight);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    _frameBegun = true;
+
+    // Si la consulta de esta ranura sigue pendiente no se mide este frame
+    if (!_queryPending[_nextQuery]) {
+        glBeginQuery(GL_TIME_ELAPSED, _queries[_nextQuery]);
+        _queryBegun = true;
+    }
+}
+
+void DynamicResolution::endFrame() {
+    // Solo se cierra lo que abrió beginFrame()
+    if (!_frameBegun) return;
+    _frameBegun = false;
+
+    if (_queryBegun) {
+        _queryBegun = false;
+        glEndQuery(GL_TIME_ELAPSED);
+        _queryPending[_nextQuery] = true;
+        _nextQuery = (_nextQuery + 1) % NUM_QUERIES;
+    }
+    _collectQueryResults();
+
+    // Escalar la región dibujada al backbuffer completo
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, _framebuffer);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+    glBlitFramebuffer(0, 0, _renderWidth, _renderHeight,
+                      0, 0, _outputWidth, _outputHeight,
+                      GL_COLOR_BUFFER_BIT, _renderWidth == _outputWidth && _renderHeight == _outputHeight ? GL_NEAREST : GL_LINEAR);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void DynamicResolution::_resizeTarget(GLint width, GLint height) {
+    if (_framebuffer == 0) {
+        glGenFramebuffers(1, &_framebuffer);
+        glGenTextures(1, &_colorTexture);
+        glGenRenderbuffers(1, &_depthRenderbuffer);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, _colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, _depthRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _colorTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, _depthRenderbuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        fprintf(stderr, "[ERROR]: Dynamic resolution framebuffer is incomplete, disabling\n");
+        _settings.enabled = false;
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    _targetWidth = width;
+    _targetHeight = height;
+}
+
+void DynamicResolution::_collectQueryResults() {
+    // Leer sin bloquear las consultas que ya terminaron, de la más antigua a la más nueva
+    for (int i = 0; i < NUM_QUERIES; ++i) {
+        const int index = (_nextQuery + i) % NUM_QUERIES;
+        if (!_queryPending[index]) continue;
+
+        GLint isAvailable = GL_FALSE;
+        glGetQueryObjectiv(_queries[index], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+        if (!isAvailable) break;
+
+        GLuint64 elapsedNs = 0;
+        glGetQueryObjectui64v(_queries[index], GL_QUERY_RESULT, &elapsedNs);
+        _queryPending[index] = false;
+        _updateScale(static_cast<float>(elapsedNs) / 1.0e6f);
+    }
+}
+
+void DynamicResolution::_updateScale(float gpuFrameMs) {
+    _lastGpuFrameMs = gpuFrameMs;
+    ++_framesSinceChange;
+    if (_framesSinceChange < _settings.framesBetweenChanges || gpuFrameMs <= 0.0f) return;
+
+    const float upperBound = _settings.targetFrameMs * (1.0f + _settings.hysteresis);
+    const float lowerBound = _settings.targetFrameMs * (1.0f - _settings.hysteresis);
+    if (gpuFrameMs <= upperBound && gpuFrameMs >= lowerBound) return;
+
+    // El costo crece con el área, así que la escala por eje va con la raíz del cociente
+    const float newScale = std::clamp(_scale * std::sqrt(_settings.targetFrameMs / gpuFrameMs),
+                                      _settings.minScale, _settings.maxScale);
+    if (std::fabs(newScale - _scale) > 0.01f) {
+        _scale = newScale;
+        _framesSinceChange = 0;
+    }
+}
@@ -0,0 +1,98 @@
+#ifndef RENDER_DYNAMIC_RESOLUTION_H
+#define RENDER_DYNAMIC_RESOLUTION_H
+
+#include <glad/gl.h>
+
+/**
+ * @class DynamicResolution
+ * @brief Dibuja la escena 3D en un destino fuera de pantalla cuya escala se ajusta según el
+ * tiempo de GPU medido, y luego la escala al backbuffer.
+ *
+ * El tiempo de GPU se mide con consultas GL_TIME_ELAPSED en un anillo de varias consultas,
+ * así que los resultados se leen unos frames después sin detener el pipeline. El costo de
+ * la escena es aproximadamente proporcional al número de píxeles (escala al cuadrado), por
+ * lo que la nueva escala es escala * sqrt(objetivo / medido). Solo se cambia si el tiempo
+ * sale de la banda de histéresis y han pasado suficientes frames desde el último cambio.
+ *
+ * Todos los métodos deben llamarse en el hilo que posee el contexto GL.
+ */
+class DynamicResolution {
+public:
+    /**
+     * @brief Límites y comportamiento del controlador; se fijan al iniciar.
+     */
+    struct Settings {
+        bool enabled = true;
+        float minScale = 0.5f;              // escala mínima por eje
+        float maxScale = 1.0f;              // escala máxima por eje
+        float targetFrameMs = 16.0f;        // presupuesto de GPU para la escena
+        float hysteresis = 0.1f;            // banda relativa alrededor del objetivo sin cambios
+        int framesBetweenChanges = 8;       // frames mínimos entre dos cambios de escala
+    };
+
+    DynamicResolution() = default;
+    ~DynamicResolution();
+
+    DynamicResolution(const DynamicResolution&) = delete;
+    DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+    /**
+     * @brief Valida la configuración y crea las consultas de tiempo.
+     */
+    void setup(const Settings& settings);
+
+    /**
+     * @brief Libera el framebuffer y las consultas.
+     */
+    void cleanup();
+
+    /**
+     * @brief Enlaza el destino fuera de pantalla al tamaño escalado e inicia la medición.
+     *
+     * @param outputWidth Ancho del backbuffer.
+     * @param outputHeight Alto del backbuffer.
+     */
+    void beginFrame(GLint outputWidth, GLint outputHeight);
+
+    /**
+     * @brief Termina la medición, actualiza la escala y copia la escena al backbuffer.
+     */
+    void endFrame();
+
+    /**
+     * @brief Escala actual por eje; 1.0 cuando está deshabilitado.
+     */
+    float getScale() const { return _settings.enabled ? _scale : 1.0f; }
+
+    /**
+     * @brief Último tiempo de GPU medido para la escena, en milisegundos.
+     */
+    float getLastGpuFrameMs() const { return _lastGpuFrameMs; }
+
+private:
+    static constexpr int NUM_QUERIES = 4;
+
+    void _resizeTarget(GLint width, GLint height);
+    void _collectQueryResults();
+    void _updateScale(float gpuFrameMs);
+
+    Settings _settings;
+    float _scale = 1.0f;
+    float _lastGpuFrameMs = 0.0f;
+    int _framesSinceChange = 0;
+
+    GLuint _framebuffer = 0;
+    GLuint _colorTexture = 0;
+    GLuint _depthRenderbuffer = 0;
+    GLint _targetWidth = 0, _targetHeight = 0;      // tamaño reservado (salida * maxScale)
+    GLint _outputWidth = 0, _outputHeight = 0;
+    GLint _renderWidth = 0, _renderHeight = 0;      // región usada este frame
+
+    GLuint _queries[NUM_QUERIES] = {};
+    bool _queryPending[NUM_QUERIES] = {};
+    int _nextQuery = 0;
+    bool _frameBegun = false;                       // beginFrame() enlazó el destino
+    bool _queryBegun = false;                       // y empezó a medir con _queries[_nextQuery]
+};
+
+#endif // RENDER_DYNAMIC_RESOLUTION_H
@@ -0,0 +1,130 @@
+#ifndef RENDER_FRAME_PACKET_H
+#define RENDER_FRAME_PACKET_H
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class Terrain;
+
+/**
+ * @brief Primitivas de CSCI441 que puede dibujar el renderizador.
+ *
+ * Cada una corresponde a una llamada drawSolid*() con los parámetros que usaban los modelos.
+ */
+enum class DrawMesh : uint8_t {
+    CUBE,       // drawSolidCube(1.0f)
+    SPHERE,     // drawSolidSphere(1.0f, 20, 20)
+    CYLINDER,   // drawSolidCylinder(0.5f, 0.5f, 0.2f, 16, 16)
+    CONE,       // drawSolidCone(1.0f, 1.0f, 20, 20)
+    MODEL       // el modelo cargado del modo de estrés (StressScene)
+};
+
+/**
+ * @struct DrawItem
+ * @brief Una pieza de un modelo lista para dibujarse con el shader de iluminación.
+ *
+ * Se calcula en el hilo principal; el hilo de render solo multiplica por la vista y la proyección.
+ */
+struct DrawItem {
+    glm::mat4 modelMtx;
+    glm::mat3 normalMtx;
+    glm::vec3 color;        // ambiente = color * 0.2, difuso = color, especular = 0.5
+    float shininess;
+    DrawMesh mesh;
+
+    static DrawItem make(DrawMesh mesh, const glm::mat4& modelMtx, const glm::vec3& color, float shininess) {
+        return { modelMtx, glm::transpose(glm::inverse(glm::mat3(modelMtx))), color, shininess, mesh };
+    }
+};
+
+/**
+ * @struct FrameView
+ * @brief Un punto de vista de la escena y la región de la ventana donde se dibuja.
+ */
+struct FrameView {
+    glm::mat4 viewMtx;
+    glm::mat4 projMtx;
+    glm::vec3 eyePosition;
+    GLint viewport[4];
+    bool isInset;           // vista superpuesta: se dibuja fuera de pantalla y se compone encima
+};
+
+/**
+ * @struct SceneLights
+ * @brief Estado de las luces de la escena.
+ *
+ * revision cambia cada vez que se modifica alguna luz, así el renderizador solo reenvía los
+ * uniforms cuando es necesario.
+ */
+struct SceneLights {
+    struct Directional {
+        glm::vec3 direction;
+        glm::vec3 ambientColor;
+        glm::vec3 diffuseColor;
+        glm::vec3 specularColor;
+    } directional;
+
+    // El shader de iluminación se compila para una cantidad fija; ver LightingVariant
+    static constexpr int MAX_POINT_LIGHTS = 32;
+
+    struct Point {
+        glm::vec3 position;
+        glm::vec3 color;
+        float constant;
+        float linear;
+        float quadratic;
+    } points[MAX_POINT_LIGHTS];
+    int numPointLights = 1;
+
+    struct Spot {
+        glm::vec3 position;
+        glm::vec3 direction;
+        glm::vec3 color;
+        float cutoff;
+        float outerCutoff;
+        float exponent;
+        float constant;
+        float linear;
+        float quadratic;
+    } spot;
+
+    uint32_t revision = 0;
+};
+
+/**
+ * @struct FramePacket
+ * @brief Todo lo que el renderizador necesita para dibujar un frame.
+ *
+ * Lo llena el hilo principal después de actualizar la escena y, una vez publicado, no se
+ * modifica; el hilo de render lo consume sin tocar el estado de la simulación.
+ */
+struct FramePacket {
+    uint64_t frameNumber = 0;
+    std::chrono::steady_clock::time_point producedAt;
+
+    GLint framebufferWidth = 0;
+    GLint framebufferHeight = 0;
+
+    static constexpr int MAX_VIEWS = 2;
+    FrameView views[MAX_VIEWS];
+    int numViews = 0;
+
+    SceneLights lights;
+    std::vector<DrawItem> drawItems;
+
+    // Copias del modelo del modo de estrés (DrawMesh::MODEL), aparte porque se dibujan con su
+    // propia variante: todas en una llamada instanciada y balanceadas con ModelSway
+    std::vector<DrawItem> modelItems;
+    float modelSwayAngle = 0.0f;
+
+    // Tiles de terreno residentes, del más cercano al jugador al más lejano; el paquete los
+    // mantiene vivos aunque la simulación los descarte mientras se dibujan
+    std::vector<std::shared_ptr<Terrain>> terrainTiles;
+};
+
+#endif // RENDER_FRAME_PACKET_H
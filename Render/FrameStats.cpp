@@ -0,0 +1,94 @@
+#include "FrameStats.h"
+
+#include <algorithm>
+#include <cstdio>
+
+void FrameStats::Series::add(double value) {
+    recent[count % WINDOW] = value;
+    sum += value;
+    max = std::max(max, value);
+    ++count;
+}
+
+double FrameStats::Series::percentile(double p) const {
+    const size_t n = std::min(count, WINDOW);
+    if (n == 0) return 0.0;
+
+    double sorted[WINDOW];
+    std::copy(recent, recent + n, sorted);
+    const size_t index = std::min(n - 1, static_cast<size_t>(p * static_cast<double>(n)));
+    std::nth_element(sorted, sorted + index, sorted + n);
+    return sorted[index];
+}
+
+void FrameStats::recordSimulation(double seconds) {
+    _simulation.add(seconds);
+}
+
+void FrameStats::recordRender(double seconds) {
+    _render.add(seconds);
+}
+
+void FrameStats::recordPresented(Clock::time_point producedAt) {
+    const Clock::time_point now = Clock::now();
+    _latency.add(std::chrono::duration<double>(now - producedAt).count());
+    if (_hasPresented) {
+        _frameInterval.add(std::chrono::duration<double>(now - _lastPresented).count());
+    }
+    _lastPresented = now;
+    _hasPresented = true;
+}
+
+void FrameStats::recordGLCalls(const CSCI441::GLCallTracer::Counts& calls) {
+    for (int i = 0; i < CSCI441::GLCallTracer::NUM_CATEGORIES; ++i) {
+        _glCalls[i].add(static_cast<double>(calls.calls[i]));
+    }
+    _glCallsTotal.add(static_cast<double>(calls.total()));
+}
+
+FrameStats::Summary FrameStats::summarize() const {
+    Summary summary;
+    summary.framesPresented = _latency.count;
+    summary.framesPerSecond = _frameInterval.mean() > 0.0 ? 1.0 / _frameInterval.mean() : 0.0;
+    summary.simulationMean = _simulation.mean();
+    summary.renderMean = _render.mean();
+    summary.frameIntervalMean = _frameInterval.mean();
+    summary.frameIntervalP95 = _frameInterval.percentile(0.95);
+    return summary;
+}
+
+void FrameStats::printReport(const char* MODE_NAME) const {
+    const double fps = summarize().framesPerSecond;
+
+    fprintf(stdout, "\n[INFO]: /--------------------- Frame Stats --------------------\\\n");
+    fprintf(stdout, "[INFO]: | Mode: %-48s |\n", MODE_NAME);
+    fprintf(stdout, "[INFO]: | Frames presented: %-36zu |\n", _latency.count);
+    char throughput[64];
+    snprintf(throughput, sizeof(throughput), "%.2f fps", fps);
+    fprintf(stdout, "[INFO]: | Throughput: %-42s |\n", throughput);
+    fprintf(stdout, "[INFO]: | %-18s %9s %9s %9s %9s |\n", "(ms)", "mean", "p50", "p95", "max");
+    const struct { const char* name; const Series& series; } rows[] = {
+        { "simulation",     _simulation },
+        { "render submit",  _render },
+        { "latency",        _latency },
+        { "frame interval", _frameInterval }
+    };
+    for (const auto& row : rows) {
+        fprintf(stdout, "[INFO]: | %-18s %9.3f %9.3f %9.3f %9.3f |\n", row.name,
+                row.series.mean() * 1000.0, row.series.percentile(0.50) * 1000.0,
+                row.series.percentile(0.95) * 1000.0, row.series.max * 1000.0);
+    }
+    if (_glCallsTotal.count > 0) {
+        fprintf(stdout, "[INFO]: | %-18s %9s %9s %9s %9s |\n", "(GL calls)", "mean", "p50", "p95", "max");
+        for (int i = 0; i < CSCI441::GLCallTracer::NUM_CATEGORIES; ++i) {
+            const Series& series = _glCalls[i];
+            if (series.max == 0.0) continue;
+            fprintf(stdout, "[INFO]: | %-18s %9.1f %9.0f %9.0f %9.0f |\n",
+                    CSCI441::GLCallTracer::getCategoryName(static_cast<CSCI441::GLCallTracer::Category>(i)),
+                    series.mean(), series.percentile(0.50), series.percentile(0.95), series.max);
+        }
+        fprintf(stdout, "[INFO]: | %-18s %9.1f %9.0f %9.0f %9.0f |\n", "total",
+                _glCallsTotal.mean(), _glCallsTotal.percentile(0.50), _glCallsTotal.percentile(0.95), _glCallsTotal.max);
+    }
+    fprintf(stdout, "[INFO]: \\--------------------------------------------------------/\n");
+}
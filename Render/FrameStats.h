@@ -0,0 +1,91 @@
+#ifndef RENDER_FRAME_STATS_H
+#define RENDER_FRAME_STATS_H
+
+#include <GLCallTracer.hpp>
+
+#include <chrono>
+#include <cstddef>
+
+/**
+ * @class FrameStats
+ * @brief Mide la latencia y el rendimiento del bucle principal.
+ *
+ * Los tiempos de simulación los registra el hilo principal y los de render/presentación el
+ * hilo que dibuja; cada campo lo escribe un solo hilo y el reporte se imprime al terminar.
+ */
+class FrameStats {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Resumen de la ejecución para compararla con otras; los tiempos van en segundos.
+     */
+    struct Summary {
+        size_t framesPresented;
+        double framesPerSecond;
+        double simulationMean;
+        double renderMean;
+        double frameIntervalMean;
+        double frameIntervalP95;
+    };
+
+    /**
+     * @brief Tiempo que el hilo principal tardó en actualizar la escena y llenar el paquete.
+     */
+    void recordSimulation(double seconds);
+
+    /**
+     * @brief Tiempo que tomó emitir los comandos GL de un frame.
+     */
+    void recordRender(double seconds);
+
+    /**
+     * @brief Registra un frame presentado (después de glfwSwapBuffers).
+     *
+     * @param producedAt Momento en que el hilo principal terminó el paquete del frame.
+     */
+    void recordPresented(Clock::time_point producedAt);
+
+    /**
+     * @brief Llamadas GL de un frame presentado, por categoría (con el GLCallTracer instalado).
+     */
+    void recordGLCalls(const CSCI441::GLCallTracer::Counts& calls);
+
+    /**
+     * @brief Imprime el resumen de latencia y frames por segundo.
+     *
+     * @param MODE_NAME Nombre del modo de ejecución medido.
+     */
+    void printReport(const char* MODE_NAME) const;
+
+    /**
+     * @brief Frames presentados, frames por segundo y tiempos medios hasta ahora.
+     */
+    Summary summarize() const;
+
+private:
+    struct Series {
+        static constexpr size_t WINDOW = 512;   // muestras recientes para los percentiles
+
+        double sum = 0.0;
+        double max = 0.0;
+        size_t count = 0;
+        double recent[WINDOW] = {};
+
+        void add(double value);
+        double mean() const { return count > 0 ? sum / static_cast<double>(count) : 0.0; }
+        double percentile(double p) const;
+    };
+
+    Series _simulation;
+    Series _render;
+    Series _latency;
+    Series _frameInterval;
+    Series _glCalls[CSCI441::GLCallTracer::NUM_CATEGORIES];
+    Series _glCallsTotal;
+
+    Clock::time_point _lastPresented;
+    bool _hasPresented = false;
+};
+
+#endif // RENDER_FRAME_STATS_H
@@ -0,0 +1,83 @@
+#include "InstancedModelBatch.h"
+
+#include <ModelLoader.hpp>
+
+#include <cstddef>
+
+InstancedModelBatch::~InstancedModelBatch() {
+    cleanup();
+}
+
+void InstancedModelBatch::setup(const CSCI441::ModelLoader* model, const ModelSway& sway) {
+    _model = model;
+
+    glBindVertexArray(_model->getVertexArrayHandle());
+
+    const std::vector<ModelSway::SkinWeight>& weights = sway.getWeights();
+    glGenBuffers(1, &_skinBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _skinBuffer);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(weights.size() * sizeof(ModelSway::SkinWeight)), weights.data(), GL_STATIC_DRAW);
+
+    // Los índices son enteros en el shader: sin glVertexAttribIPointer llegarían convertidos a float
+    glEnableVertexAttribArray(BONE_INDICES_LOCATION);
+    glVertexAttribIPointer(BONE_INDICES_LOCATION, 4, GL_INT, sizeof(ModelSway::SkinWeight),
+                           (void*)offsetof(ModelSway::SkinWeight, boneIndices));
+    glEnableVertexAttribArray(BONE_WEIGHTS_LOCATION);
+    glVertexAttribPointer(BONE_WEIGHTS_LOCATION, 4, GL_FLOAT, GL_FALSE, sizeof(ModelSway::SkinWeight),
+                          (void*)offsetof(ModelSway::SkinWeight, boneWeights));
+
+    // Una mat4 ocupa cuatro ubicaciones seguidas, una por columna; todas avanzan por instancia
+    glGenBuffers(1, &_instanceBuffer);
+    glBindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+    for (GLuint column = 0; column < 4; ++column) {
+        glEnableVertexAttribArray(INSTANCE_MATRIX_LOCATION + column);
+        glVertexAttribPointer(INSTANCE_MATRIX_LOCATION + column, 4, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                              (void*)(offsetof(Instance, modelMtx) + column * sizeof(glm::vec4)));
+        glVertexAttribDivisor(INSTANCE_MATRIX_LOCATION + column, 1);
+    }
+    glEnableVertexAttribArray(INSTANCE_COLOR_LOCATION);
+    glVertexAttribPointer(INSTANCE_COLOR_LOCATION, 3, GL_FLOAT, GL_FALSE, sizeof(Instance),
+                          (void*)offsetof(Instance, color));
+    glVertexAttribDivisor(INSTANCE_COLOR_LOCATION, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstancedModelBatch::cleanup() {
+    if (_skinBuffer != 0) {
+        glDeleteBuffers(1, &_skinBuffer);
+        _skinBuffer = 0;
+    }
+    if (_instanceBuffer != 0) {
+        glDeleteBuffers(1, &_instanceBuffer);
+        _instanceBuffer = 0;
+    }
+    _instanceCapacity = 0;
+    _numInstances = 0;
+    _model = nullptr;
+}
+
+void InstancedModelBatch::upload(const std::vector<DrawItem>& modelItems) {
+    _instances.clear();
+    for (const DrawItem& item : modelItems) {
+        _instances.push_back({ item.modelMtx, item.color });
+    }
+    _numInstances = static_cast<GLsizei>(_instances.size());
+    if (_instances.empty()) return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, _instanceBuffer);
+    if (_instances.size() > _instanceCapacity) {
+        _instanceCapacity = _instances.capacity();
+        glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(_instanceCapacity * sizeof(Instance)), nullptr, GL_STREAM_DRAW);
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, 0, static_cast<GLsizeiptr>(_instances.size() * sizeof(Instance)), _instances.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void InstancedModelBatch::draw(const CSCI441::ShaderProgram& shaderProgram) const {
+    if (_model == nullptr || _numInstances == 0) return;
+
+    // Sin ubicaciones de material: el color llega por instancia y el MTL se ignora
+    _model->draw(shaderProgram.getShaderProgramHandle(), -1, -1, -1, -1, GL_TEXTURE0, _numInstances);
+}
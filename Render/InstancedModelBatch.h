@@ -0,0 +1,80 @@
+#ifndef RENDER_INSTANCED_MODEL_BATCH_H
+#define RENDER_INSTANCED_MODEL_BATCH_H
+
+#include "FramePacket.h"
+#include "ModelSway.h"
+
+#include <ShaderProgram.hpp>
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include <vector>
+
+namespace CSCI441 { class ModelLoader; }
+
+/**
+ * @class InstancedModelBatch
+ * @brief Dibuja todas las piezas DrawMesh::MODEL con una sola llamada instanciada.
+ *
+ * La matriz de modelo y el color de cada pieza van en un buffer por instancia conectado al VAO
+ * del modelo (ubicaciones 8 a 12 de la variante USE_INSTANCING de shaders/A3.v.glsl), junto con
+ * los pesos de ModelSway (ubicaciones 6 y 7 de USE_SKINNING). Todos los métodos deben llamarse
+ * en el hilo que posee el contexto GL.
+ */
+class InstancedModelBatch {
+public:
+    InstancedModelBatch() = default;
+    ~InstancedModelBatch();
+
+    InstancedModelBatch(const InstancedModelBatch&) = delete;
+    InstancedModelBatch& operator=(const InstancedModelBatch&) = delete;
+
+    /**
+     * @brief Crea los buffers y los conecta al VAO del modelo.
+     *
+     * Los pesos quedan en el VAO para cualquier programa que dibuje el modelo; los que no
+     * declaran esas ubicaciones los ignoran.
+     */
+    void setup(const CSCI441::ModelLoader* model, const ModelSway& sway);
+
+    /**
+     * @brief Libera los buffers.
+     */
+    void cleanup();
+
+    /**
+     * @brief Copia la matriz y el color de cada pieza al buffer de instancias.
+     *
+     * Se llama una vez por frame; todas las vistas dibujan las mismas instancias.
+     */
+    void upload(const std::vector<DrawItem>& modelItems);
+
+    /**
+     * @brief Dibuja las instancias subidas con el programa, que ya debe estar en uso.
+     */
+    void draw(const CSCI441::ShaderProgram& shaderProgram) const;
+
+    GLsizei getNumInstances() const { return _numInstances; }
+
+private:
+    // Formato de vInstanceModelMatrix y vInstanceColor
+    struct Instance {
+        glm::mat4 modelMtx;
+        glm::vec3 color;
+    };
+
+    static constexpr GLuint BONE_INDICES_LOCATION = 6;
+    static constexpr GLuint BONE_WEIGHTS_LOCATION = 7;
+    static constexpr GLuint INSTANCE_MATRIX_LOCATION = 8;
+    static constexpr GLuint INSTANCE_COLOR_LOCATION = 12;
+
+    const CSCI441::ModelLoader* _model = nullptr;
+    GLuint _skinBuffer = 0;
+    GLuint _instanceBuffer = 0;
+    size_t _instanceCapacity = 0;           // instancias que caben en _instanceBuffer
+    GLsizei _numInstances = 0;
+    std::vector<Instance> _instances;       // conserva su capacidad entre frames
+};
+
+#endif // RENDER_INSTANCED_MODEL_BATCH_H
@@ -0,0 +1,37 @@
+#include "ModelSway.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+void ModelSway::build(const glm::vec3* positions, size_t numVertices, const glm::vec3& base) {
+    _base = base;
+
+    float height = 0.0f;
+    for (size_t i = 0; i < numVertices; ++i) {
+        height = std::max(height, positions[i].y - base.y);
+    }
+
+    _weights.resize(numVertices);
+    for (size_t i = 0; i < numVertices; ++i) {
+        // Cuadrático: la mitad de abajo casi no se mueve y la curva queda suave
+        float t = height > 0.0f ? std::clamp((positions[i].y - base.y) / height, 0.0f, 1.0f) : 0.0f;
+        float weight = t * t;
+        _weights[i].boneIndices = glm::ivec4(0, 1, 0, 0);
+        _weights[i].boneWeights = glm::vec4(1.0f - weight, weight, 0.0f, 0.0f);
+    }
+}
+
+float ModelSway::angleAt(float seconds) {
+    const float amplitude = glm::radians(6.0f);
+    const float frequency = 1.5f;       // radianes por segundo
+    return amplitude * std::sin(seconds * frequency);
+}
+
+void ModelSway::computeBoneMatrices(float angle, glm::mat4 boneMatrices[NUM_BONES]) const {
+    boneMatrices[0] = glm::mat4(1.0f);
+    boneMatrices[1] = glm::translate(glm::mat4(1.0f), _base);
+    boneMatrices[1] = glm::rotate(boneMatrices[1], angle, glm::vec3(1.0f, 0.0f, 0.0f));
+    boneMatrices[1] = glm::translate(boneMatrices[1], -_base);
+}
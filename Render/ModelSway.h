@@ -0,0 +1,57 @@
+#ifndef RENDER_MODEL_SWAY_H
+#define RENDER_MODEL_SWAY_H
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class ModelSway
+ * @brief Esqueleto de dos huesos que balancea el modelo del modo de estrés, como una planta al
+ * viento.
+ *
+ * El hueso 0 queda fijo y el hueso 1 gira alrededor de la base del modelo; cada vértice pesa
+ * hacia el hueso 1 según su altura, así la base no se mueve y la parte de arriba se inclina el
+ * ángulo completo. Los pesos se calculan una vez desde la malla y los usa la variante
+ * USE_SKINNING de shaders/A3.v.glsl; SoftwareRasterizer hace la misma mezcla en la CPU.
+ */
+class ModelSway {
+public:
+    static constexpr int NUM_BONES = 2;
+
+    /**
+     * @struct SkinWeight
+     * @brief Atributos de un vértice con el formato de vBoneIndices y vBoneWeights.
+     */
+    struct SkinWeight {
+        glm::ivec4 boneIndices;
+        glm::vec4 boneWeights;
+    };
+
+    /**
+     * @brief Calcula el peso de cada vértice.
+     *
+     * @param positions Posiciones de la malla, en el espacio del modelo.
+     * @param base Punto alrededor del cual gira el hueso 1; su altura es la del peso 0.
+     */
+    void build(const glm::vec3* positions, size_t numVertices, const glm::vec3& base);
+
+    /**
+     * @brief Ángulo de balanceo después de seconds segundos de simulación.
+     */
+    static float angleAt(float seconds);
+
+    /**
+     * @brief Matrices de los huesos para un ángulo, en el espacio del modelo.
+     */
+    void computeBoneMatrices(float angle, glm::mat4 boneMatrices[NUM_BONES]) const;
+
+    const std::vector<SkinWeight>& getWeights() const { return _weights; }
+
+private:
+    glm::vec3 _base = glm::vec3(0.0f);
+    std::vector<SkinWeight> _weights;
+};
+
+#endif // RENDER_MODEL_SWAY_H
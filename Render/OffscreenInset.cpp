@@ -0,0 +1,132 @@
+#include "OffscreenInset.h"
+
+#include <algorithm>
+#include <cstdio>
+
+OffscreenInset::~OffscreenInset() {
+    cleanup();
+}
+
+void OffscreenInset::setup(const Settings& settings) {
+    _settings = settings;
+    _settings.resolutionScale = std::clamp(_settings.resolutionScale, 0.1f, 1.0f);
+    _settings.updateInterval = std::max(_settings.updateInterval, 1);
+
+    _compositeShaderProgram = new CSCI441::ShaderProgram("shaders/inset.v.glsl", "shaders/inset.f.glsl");
+    _insetTextureLocation = _compositeShaderProgram->getUniformLocation("insetTexture");
+    _compositeShaderProgram->setProgramUniform(_insetTextureLocation, 0);
+
+    // El quad se genera en el vertex shader, pero el perfil core exige un VAO enlazado
+    glGenVertexArrays(1, &_quadVAO);
+
+    fprintf(stdout, "[INFO]: Inset view: %.0f%% resolution, updated every %d frame(s)%s\n",
+            _settings.resolutionScale * 100.0f, _settings.updateInterval,
+            _settings.updateOnlyOnViewChange ? " when its camera moves" : "");
+}
+
+void OffscreenInset::cleanup() {
+    delete _compositeShaderProgram;
+    _compositeShaderProgram = nullptr;
+
+    if (_quadVAO != 0) {
+        glDeleteVertexArrays(1, &_quadVAO);
+        _quadVAO = 0;
+    }
+    if (_framebuffer != 0) {
+        glDeleteFramebuffers(1, &_framebuffer);
+        glDeleteTextures(1, &_colorTexture);
+        glDeleteRenderbuffers(1, &_depthRenderbuffer);
+        _framebuffer = _colorTexture = _depthRenderbuffer = 0;
+    }
+    _targetWidth = _targetHeight = 0;
+    _hasContent = false;
+}
+
+bool OffscreenInset::needsUpdate(const glm::mat4& viewMtx, GLint viewportWidth, GLint viewportHeight) {
+    const GLint width = std::max(1, static_cast<GLint>(static_cast<float>(viewportWidth) * _settings.resolutionScale));
+    const GLint height = std::max(1, static_cast<GLint>(static_cast<float>(viewportHeight) * _settings.resolutionScale));
+    if (width != _targetWidth || height != _targetHeight) {
+        _resizeTarget(width, height);
+    }
+
+    ++_framesSinceUpdate;
+    bool update;
+    if (!_hasContent) {
+        update = true;
+    } else if (_settings.updateOnlyOnViewChange) {
+        update = viewMtx != _lastViewMtx;
+    } else {
+        update = _framesSinceUpdate >= _settings.updateInterval;
+    }
+
+    if (update) {
+        _lastViewMtx = viewMtx;
+        _framesSinceUpdate = 0;
+    }
+    return update;
+}
+
+void OffscreenInset::beginUpdate() {
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &_previousFramebuffer);
+    glGetIntegerv(GL_VIEWPORT, _previousViewport);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    glViewport(0, 0, _targetWidth, _targetHeight);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+}
+
+void OffscreenInset::endUpdate() {
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(_previousFramebuffer));
+    glViewport(_previousViewport[0], _previousViewport[1], _previousViewport[2], _previousViewport[3]);
+    _hasContent = true;
+}
+
+void OffscreenInset::composite(GLint x, GLint y, GLint width, GLint height) const {
+    if (!_hasContent) return;
+
+    glViewport(x, y, width, height);
+
+    // El quad reemplaza lo que hay debajo sin importar la profundidad de la escena
+    glDisable(GL_DEPTH_TEST);
+    _compositeShaderProgram->useProgram();
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, _colorTexture);
+    glBindVertexArray(_quadVAO);
+    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
+    glBindVertexArray(0);
+    glEnable(GL_DEPTH_TEST);
+}
+
+void OffscreenInset::_resizeTarget(GLint width, GLint height) {
+    if (_framebuffer == 0) {
+        glGenFramebuffers(1, &_framebuffer);
+        glGenTextures(1, &_colorTexture);
+        glGenRenderbuffers(1, &_depthRenderbuffer);
+    }
+
+    glBindTexture(GL_TEXTURE_2D, _colorTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glBindRenderbuffer(GL_RENDERBUFFER, _depthRenderbuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+    GLint previousFramebuffer;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &previousFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, _framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, _colorTexture, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, _depthRenderbuffer);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        fprintf(stderr, "[ERROR]: Inset framebuffer is incomplete\n");
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(previousFramebuffer));
+
+    _targetWidth = width;
+    _targetHeight = height;
+    _hasContent = false;
+}
@@ -0,0 +1,98 @@
+#ifndef RENDER_OFFSCREEN_INSET_H
+#define RENDER_OFFSCREEN_INSET_H
+
+#include <ShaderProgram.hpp>
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+/**
+ * @class OffscreenInset
+ * @brief Vista superpuesta (picture-in-picture) que se dibuja en su propio framebuffer de menor
+ * resolución, se actualiza con menos frecuencia que la vista principal y se compone como un
+ * quad texturizado.
+ *
+ * Mientras no toque actualizarla, componer la vista cuesta un solo quad en lugar de volver a
+ * dibujar toda la escena. Todos los métodos deben llamarse en el hilo que posee el contexto GL.
+ */
+class OffscreenInset {
+public:
+    /**
+     * @brief Resolución y frecuencia de actualización; se fijan al iniciar.
+     */
+    struct Settings {
+        float resolutionScale = 0.5f;       // tamaño del framebuffer respecto al viewport del inset
+        int updateInterval = 2;             // actualizar cada N frames principales (1 = siempre)
+        bool updateOnlyOnViewChange = false;// actualizar solo cuando cambia la cámara del inset
+    };
+
+    OffscreenInset() = default;
+    ~OffscreenInset();
+
+    OffscreenInset(const OffscreenInset&) = delete;
+    OffscreenInset& operator=(const OffscreenInset&) = delete;
+
+    /**
+     * @brief Compila el shader de composición y crea el VAO vacío del quad.
+     */
+    void setup(const Settings& settings);
+
+    /**
+     * @brief Libera el framebuffer, el VAO y el shader.
+     */
+    void cleanup();
+
+    /**
+     * @brief Indica si el contenido debe volver a dibujarse este frame.
+     *
+     * Se debe llamar una vez por frame principal mientras el inset está visible.
+     *
+     * @param viewMtx Matriz de vista actual del inset.
+     * @param viewportWidth Ancho del viewport donde se compone.
+     * @param viewportHeight Alto del viewport donde se compone.
+     */
+    bool needsUpdate(const glm::mat4& viewMtx, GLint viewportWidth, GLint viewportHeight);
+
+    /**
+     * @brief Enlaza el framebuffer del inset, fija su viewport y lo limpia.
+     */
+    void beginUpdate();
+
+    /**
+     * @brief Restaura el framebuffer y el viewport que estaban enlazados antes de beginUpdate().
+     */
+    void endUpdate();
+
+    /**
+     * @brief Dibuja el último contenido del inset como un quad en el viewport dado.
+     */
+    void composite(GLint x, GLint y, GLint width, GLint height) const;
+
+    /**
+     * @brief Olvida el contenido; la próxima vez que se muestre se vuelve a dibujar.
+     */
+    void invalidate() { _hasContent = false; }
+
+private:
+    void _resizeTarget(GLint width, GLint height);
+
+    Settings _settings;
+
+    CSCI441::ShaderProgram* _compositeShaderProgram = nullptr;
+    GLint _insetTextureLocation = -1;
+    GLuint _quadVAO = 0;
+
+    GLuint _framebuffer = 0;
+    GLuint _colorTexture = 0;
+    GLuint _depthRenderbuffer = 0;
+    GLint _targetWidth = 0, _targetHeight = 0;
+
+    bool _hasContent = false;
+    int _framesSinceUpdate = 0;
+    glm::mat4 _lastViewMtx = glm::mat4(0.0f);
+
+    GLint _previousFramebuffer = 0;
+    GLint _previousViewport[4] = {};
+};
+
+#endif // RENDER_OFFSCREEN_INSET_H
@@ -0,0 +1,86 @@
+#include "RenderThread.h"
+
+#include "../Memory/AllocationTracker.h"
+
+#include <cstdio>
+#include <utility>
+
+RenderThread::RenderThread(GLFWwindow* pWindow, RenderFunction renderFrame, FrameStats& stats)
+    : _pWindow(pWindow),
+      _renderFrame(std::move(renderFrame)),
+      _stats(stats) {
+}
+
+RenderThread::~RenderThread() {
+    stop();
+}
+
+void RenderThread::start() {
+    if (_isRunning) return;
+
+    // Un contexto solo puede estar activo en un hilo a la vez
+    glfwMakeContextCurrent(nullptr);
+
+    _isRunning = true;
+    _thread = std::thread(&RenderThread::_threadMain, this);
+    fprintf(stdout, "[INFO]: Render thread started\n");
+}
+
+void RenderThread::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_isRunning) return;
+        _isRunning = false;
+    }
+    _packetPublished.notify_one();
+    _thread.join();
+
+    // Recuperar el contexto para la limpieza de recursos en shutdown()
+    glfwMakeContextCurrent(_pWindow);
+    fprintf(stdout, "[INFO]: Render thread stopped\n");
+}
+
+void RenderThread::submitFrame() {
+    const uint64_t frameNumber = _packets.writeBuffer().frameNumber;
+    _packets.publish();
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    _lastSubmittedFrame = frameNumber;
+    _hasNewPacket = true;
+    _packetPublished.notify_one();
+
+    // Como máximo un frame en vuelo: el render dibuja N mientras se simula N + 1
+    _packetTaken.wait(lock, [this, frameNumber] { return _lastTakenFrame >= frameNumber || !_isRunning; });
+}
+
+void RenderThread::_threadMain() {
+    glfwMakeContextCurrent(_pWindow);
+    AllocationTracker::registerThread("render");
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _packetPublished.wait(lock, [this] { return _hasNewPacket || !_isRunning; });
+            if (!_isRunning) break;
+            _hasNewPacket = false;
+            _packets.acquire();
+            _lastTakenFrame = _packets.readBuffer().frameNumber;
+        }
+        _packetTaken.notify_one();
+
+        const FramePacket& packet = _packets.readBuffer();
+
+        const FrameStats::Clock::time_point renderStart = FrameStats::Clock::now();
+        _renderFrame(packet);
+        _stats.recordRender(std::chrono::duration<double>(FrameStats::Clock::now() - renderStart).count());
+
+        glfwSwapBuffers(_pWindow);
+        _stats.recordPresented(packet.producedAt);
+        if (CSCI441::GLCallTracer::isInstalled()) {
+            _stats.recordGLCalls(CSCI441::GLCallTracer::endFrame());
+        }
+        AllocationTracker::endFrame();
+    }
+
+    glfwMakeContextCurrent(nullptr);
+}
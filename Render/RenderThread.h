@@ -0,0 +1,82 @@
+#ifndef RENDER_RENDER_THREAD_H
+#define RENDER_RENDER_THREAD_H
+
+#include "FramePacket.h"
+#include "FrameStats.h"
+#include "TripleBuffer.h"
+
+#include <GLFW/glfw3.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+/**
+ * @class RenderThread
+ * @brief Hilo dedicado que posee el contexto GL y dibuja los FramePacket del hilo principal.
+ *
+ * El hilo principal llena un paquete con beginFrame(), lo entrega con submitFrame() y sigue
+ * con la simulación del siguiente frame mientras este hilo dibuja el anterior y llama a
+ * glfwSwapBuffers(). El intercambio usa un TripleBuffer; submitFrame() solo espera cuando el
+ * hilo principal va más de un frame adelantado, de modo que la latencia queda acotada.
+ */
+class RenderThread {
+public:
+    /**
+     * @brief Función que emite los comandos GL de un paquete; se ejecuta en el hilo de render.
+     */
+    using RenderFunction = std::function<void(const FramePacket&)>;
+
+    /**
+     * @param pWindow Ventana cuyo contexto pasará al hilo de render.
+     * @param renderFrame Dibuja un paquete.
+     * @param stats Recibe los tiempos de render y presentación.
+     */
+    RenderThread(GLFWwindow* pWindow, RenderFunction renderFrame, FrameStats& stats);
+    ~RenderThread();
+
+    RenderThread(const RenderThread&) = delete;
+    RenderThread& operator=(const RenderThread&) = delete;
+
+    /**
+     * @brief Libera el contexto del hilo actual y arranca el hilo de render.
+     */
+    void start();
+
+    /**
+     * @brief Detiene el hilo de render y devuelve el contexto al hilo que llama.
+     */
+    void stop();
+
+    /**
+     * @brief Paquete que el hilo principal debe llenar para el siguiente frame.
+     */
+    FramePacket& beginFrame() { return _packets.writeBuffer(); }
+
+    /**
+     * @brief Publica el paquete llenado y espera si el render va un frame atrasado.
+     */
+    void submitFrame();
+
+private:
+    void _threadMain();
+
+    GLFWwindow* _pWindow;
+    RenderFunction _renderFrame;
+    FrameStats& _stats;
+
+    TripleBuffer<FramePacket> _packets;
+
+    std::thread _thread;
+    std::mutex _mutex;
+    std::condition_variable _packetPublished;
+    std::condition_variable _packetTaken;
+    bool _isRunning = false;
+    bool _hasNewPacket = false;
+    uint64_t _lastSubmittedFrame = 0;
+    uint64_t _lastTakenFrame = 0;
+};
+
+#endif // RENDER_RENDER_THREAD_H
@@ -0,0 +1,649 @@
+#include "SoftwareRasterizer.h"
+
+#include <ModelLoader.hpp>
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RASTER_USE_SSE2 1
+#endif
+
+namespace {
+    constexpr int WIDTH = 4;                // píxeles evaluados juntos
+    constexpr int ALL_LANES = (1 << WIDTH) - 1;
+
+#ifdef RASTER_USE_SSE2
+    // Cuatro floats en un registro SSE2
+    struct Float4 {
+        __m128 v;
+
+        static Float4 broadcast(float s) { return { _mm_set1_ps(s) }; }
+        // s, s + 1, s + 2, s + 3: los centros de cuatro píxeles seguidos
+        static Float4 ramp(float s) { return { _mm_setr_ps(s, s + 1.0f, s + 2.0f, s + 3.0f) }; }
+        void store(float* p) const { _mm_storeu_ps(p, v); }
+    };
+
+    inline Float4 operator+(Float4 a, Float4 b) { return { _mm_add_ps(a.v, b.v) }; }
+    inline Float4 operator*(Float4 a, Float4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+
+    // Un bit por elemento, como _mm_movemask_ps
+    inline int greaterThanZero(Float4 a) { return _mm_movemask_ps(_mm_cmpgt_ps(a.v, _mm_setzero_ps())); }
+    inline int equalToZero(Float4 a) { return _mm_movemask_ps(_mm_cmpeq_ps(a.v, _mm_setzero_ps())); }
+#else
+    // Sin SSE2: bucles de cuatro elementos que el compilador puede vectorizar
+    struct Float4 {
+        float v[WIDTH];
+
+        static Float4 broadcast(float s) { Float4 r; for (float& x : r.v) x = s; return r; }
+        static Float4 ramp(float s) { Float4 r; for (int i = 0; i < WIDTH; ++i) r.v[i] = s + static_cast<float>(i); return r; }
+        void store(float* p) const { for (int i = 0; i < WIDTH; ++i) p[i] = v[i]; }
+    };
+
+    inline Float4 operator+(Float4 a, Float4 b) { for (int i = 0; i < WIDTH; ++i) a.v[i] += b.v[i]; return a; }
+    inline Float4 operator*(Float4 a, Float4 b) { for (int i = 0; i < WIDTH; ++i) a.v[i] *= b.v[i]; return a; }
+
+    inline int greaterThanZero(Float4 a) { int m = 0; for (int i = 0; i < WIDTH; ++i) m |= (a.v[i] > 0.0f) << i; return m; }
+    inline int equalToZero(Float4 a) { int m = 0; for (int i = 0; i < WIDTH; ++i) m |= (a.v[i] == 0.0f) << i; return m; }
+#endif
+
+    // Función de arista a -> b: positiva dentro de un triángulo de área positiva. Se evalúa
+    // siempre como A * x + (B * y + C), así la arista compartida por dos triángulos da valores
+    // exactamente opuestos y ningún píxel se dibuja dos veces ni se pierde
+    struct Edge {
+        float A, B, C;
+        bool topLeft;                       // los píxeles justo sobre la arista son de este triángulo
+
+        Edge(const glm::vec2& a, const glm::vec2& b)
+            : A(a.y - b.y), B(b.x - a.x), C(a.x * b.y - a.y * b.x),
+              topLeft(A > 0.0f || (A == 0.0f && B > 0.0f)) {}
+
+        float evaluate(float x, float y) const { return A * x + (B * y + C); }
+
+        int covered(Float4 w) const { return greaterThanZero(w) | (topLeft ? equalToZero(w) : 0); }
+    };
+
+    // Copias de shaders/A3.v.glsl; el material es el de submitDrawItems()
+    struct Material {
+        glm::vec3 ambient;
+        glm::vec3 diffuse;
+        glm::vec3 specular;
+        float shininess;
+    };
+
+    inline float specularFactor(const Material& material, const glm::vec3& normal, const glm::vec3& lightVector, const glm::vec3& viewVector) {
+        const glm::vec3 reflectVector = glm::reflect(-lightVector, normal);
+        return std::pow(std::max(glm::dot(viewVector, reflectVector), 0.0f), material.shininess);
+    }
+
+    glm::vec3 shadeVertex(const SceneLights& lights, const Material& material, bool specular,
+                          const glm::vec3& position, const glm::vec3& normal, const glm::vec3& viewVector) {
+        glm::vec3 color(0.0f);
+
+        {
+            const SceneLights::Directional& light = lights.directional;
+            const glm::vec3 lightVector = glm::normalize(-light.direction);
+            color += light.ambientColor * material.ambient;
+            color += light.diffuseColor * material.diffuse * std::max(glm::dot(normal, lightVector), 0.0f);
+            if (specular) {
+                color += light.specularColor * material.specular * specularFactor(material, normal, lightVector, viewVector);
+            }
+        }
+
+        for (int i = 0; i < lights.numPointLights; ++i) {
+            const SceneLights::Point& light = lights.points[i];
+            const glm::vec3 lightVector = glm::normalize(light.position - position);
+            const float distance = glm::length(light.position - position);
+            const float attenuation = 1.0f / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
+            glm::vec3 sum = light.color * material.ambient + std::max(glm::dot(normal, lightVector), 0.0f) * light.color;
+            if (specular) {
+                sum += specularFactor(material, normal, lightVector, viewVector) * light.color;
+            }
+            color += sum * attenuation;
+        }
+
+        {
+            const SceneLights::Spot& light = lights.spot;
+            const glm::vec3 lightVector = glm::normalize(light.position - position);
+            const float theta = glm::dot(lightVector, glm::normalize(-light.direction));
+            if (theta > light.cutoff) {
+                const float distance = glm::length(light.position - position);
+                const float attenuation = 1.0f / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
+                float intensity = glm::clamp((theta - light.outerCutoff) / (light.cutoff - light.outerCutoff), 0.0f, 1.0f);
+                intensity = std::pow(intensity, light.exponent);
+                glm::vec3 sum = light.color * material.ambient + std::max(glm::dot(normal, lightVector), 0.0f) * light.color;
+                if (specular) {
+                    sum += specularFactor(material, normal, lightVector, viewVector) * light.color;
+                }
+                color += sum * intensity * attenuation;
+            }
+        }
+
+        return color;
+    }
+
+    // Bits de los planos del frustum que deja afuera un vértice en clip space
+    inline int outcode(const glm::vec4& p) {
+        return (p.x < -p.w ? 1 : 0) | (p.x > p.w ? 2 : 0) | (p.y < -p.w ? 4 : 0) |
+               (p.y > p.w ? 8 : 0) | (p.z < -p.w ? 16 : 0) | (p.z > p.w ? 32 : 0);
+    }
+    constexpr int NEAR_PLANE = 16;
+
+    inline uint8_t toUnorm8(float c) {
+        return static_cast<uint8_t>(std::lround(glm::clamp(c, 0.0f, 1.0f) * 255.0f));
+    }
+}
+
+SoftwareRasterizer::SoftwareRasterizer() {
+    _buildPrimitiveMeshes();
+}
+
+SoftwareRasterizer::~SoftwareRasterizer() {
+    stop();
+}
+
+void SoftwareRasterizer::start(const Settings& settings) {
+    stop();
+
+    _settings = settings;
+    _settings.width = std::max(_settings.width, 1);
+    _settings.height = std::max(_settings.height, 1);
+    _settings.tileSize = (std::max(_settings.tileSize, WIDTH) + WIDTH - 1) / WIDTH * WIDTH;
+    _settings.itemsPerChunk = std::max(_settings.itemsPerChunk, 1);
+
+    int numThreads = _settings.numThreads > 0 ? _settings.numThreads
+                                              : static_cast<int>(std::thread::hardware_concurrency());
+    numThreads = std::clamp(numThreads, 1, 64);
+
+    const size_t numPixels = static_cast<size_t>(_settings.width) * static_cast<size_t>(_settings.height);
+    _color.assign(numPixels * 3, 0);
+    _depth.assign(numPixels, 1.0f);
+    _tilesX = (_settings.width + _settings.tileSize - 1) / _settings.tileSize;
+    _tilesY = (_settings.height + _settings.tileSize - 1) / _settings.tileSize;
+
+    _bins.assign(static_cast<size_t>(numThreads) * static_cast<size_t>(_tilesX * _tilesY), {});
+    _vertexScratch.assign(static_cast<size_t>(numThreads), {});
+    _mergeScratch.assign(static_cast<size_t>(numThreads), {});
+    _threadTriangles.assign(static_cast<size_t>(numThreads), 0);
+    _threadFragments.assign(static_cast<size_t>(numThreads), 0);
+
+    // La generación se fija aquí: un hilo que arranque tarde no debe tomar como ya atendido
+    // el primer render()
+    _stopping = false;
+    _busyWorkers = 0;
+    for (int i = 1; i < numThreads; ++i) {
+        _workers.emplace_back(&SoftwareRasterizer::_workerMain, this, static_cast<size_t>(i), _generation);
+    }
+}
+
+void SoftwareRasterizer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _workAvailable.notify_all();
+    for (std::thread& worker : _workers) {
+        worker.join();
+    }
+    _workers.clear();
+}
+
+void SoftwareRasterizer::setModelMesh(const CSCI441::ModelLoader* model, const std::vector<ModelSway::SkinWeight>* skinWeights,
+                                      const glm::mat4* boneMatrices) {
+    Mesh& mesh = _meshes[static_cast<int>(DrawMesh::MODEL)];
+    mesh = Mesh();
+    _hasModel = model != nullptr && model->getVertices() != nullptr && model->getIndices() != nullptr;
+    if (!_hasModel) return;
+
+    const glm::vec3* positions = reinterpret_cast<const glm::vec3*>(model->getVertices());
+    const glm::vec3* normals = reinterpret_cast<const glm::vec3*>(model->getNormals());
+    const GLuint numVertices = model->getNumberOfVertices();
+    mesh.positions.assign(positions, positions + numVertices);
+    if (normals != nullptr) {
+        mesh.normals.assign(normals, normals + numVertices);
+    } else {
+        mesh.normals.assign(numVertices, glm::vec3(0.0f, 1.0f, 0.0f));
+    }
+
+    // La misma mezcla de huesos que el shader; todas las copias comparten la pose
+    if (skinWeights != nullptr && boneMatrices != nullptr && skinWeights->size() == numVertices) {
+        for (GLuint v = 0; v < numVertices; ++v) {
+            const ModelSway::SkinWeight& weight = (*skinWeights)[v];
+            glm::mat4 skinMtx(0.0f);
+            for (int b = 0; b < 4; ++b) {
+                skinMtx += weight.boneWeights[b] * boneMatrices[weight.boneIndices[b]];
+            }
+            mesh.positions[v] = glm::vec3(skinMtx * glm::vec4(mesh.positions[v], 1.0f));
+            mesh.normals[v] = glm::mat3(skinMtx) * mesh.normals[v];
+        }
+    }
+
+    // Índices fuera de rango se descartan con su triángulo en lugar de leer fuera de la malla
+    const GLuint* indices = model->getIndices();
+    const GLuint numIndices = model->getNumberOfIndices() / 3 * 3;
+    mesh.indices.reserve(numIndices);
+    for (GLuint i = 0; i < numIndices; i += 3) {
+        if (indices[i] < numVertices && indices[i + 1] < numVertices && indices[i + 2] < numVertices) {
+            mesh.indices.insert(mesh.indices.end(), indices + i, indices + i + 3);
+        }
+    }
+}
+
+void SoftwareRasterizer::render(const FrameView& view, const SceneLights& lights, const std::vector<DrawItem>& drawItems) {
+    // Sin start(): se usa la configuración por defecto en un solo hilo
+    if (_vertexScratch.empty()) {
+        Settings settings = _settings;
+        settings.numThreads = 1;
+        start(settings);
+    }
+
+    _drawItems = &drawItems;
+    _lights = &lights;
+    _viewProjMtx = view.projMtx * view.viewMtx;
+    _eyePosition = view.eyePosition;
+
+    // Las listas conservan su capacidad: tras el primer frame no se pide memoria al heap
+    for (std::vector<uint64_t>& bin : _bins) {
+        bin.clear();
+    }
+    std::fill(_threadTriangles.begin(), _threadTriangles.end(), 0);
+    std::fill(_threadFragments.begin(), _threadFragments.end(), 0);
+
+    const size_t itemsPerChunk = static_cast<size_t>(_settings.itemsPerChunk);
+    const size_t numChunks = (drawItems.size() + itemsPerChunk - 1) / itemsPerChunk;
+    if (_chunks.size() < numChunks) {
+        _chunks.resize(numChunks);
+    }
+
+    _runPhase(Phase::VERTICES, numChunks);
+    // Cada tile también se limpia en esta fase, así que siempre se recorren todos
+    _runPhase(Phase::RASTER, static_cast<size_t>(_tilesX * _tilesY));
+
+    _stats = Stats();
+    for (const DrawItem& item : drawItems) {
+        if (item.mesh == DrawMesh::MODEL && !_hasModel) continue;
+        _stats.trianglesSubmitted += _meshes[static_cast<int>(item.mesh)].indices.size() / 3;
+    }
+    for (size_t i = 0; i < _threadTriangles.size(); ++i) {
+        _stats.trianglesBinned += _threadTriangles[i];
+        _stats.fragmentsWritten += _threadFragments[i];
+    }
+
+    _drawItems = nullptr;
+    _lights = nullptr;
+}
+
+bool SoftwareRasterizer::writePPM(const char* FILENAME) const {
+    FILE* file = fopen(FILENAME, "wb");
+    if (file == nullptr) {
+        fprintf(stderr, "[ERROR]: Could not open \"%s\" for writing\n", FILENAME);
+        return false;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", _settings.width, _settings.height);
+    const bool written = fwrite(_color.data(), 1, _color.size(), file) == _color.size();
+    if (fclose(file) != 0 || !written) {
+        fprintf(stderr, "[ERROR]: Could not write \"%s\"\n", FILENAME);
+        return false;
+    }
+    return true;
+}
+
+void SoftwareRasterizer::_buildPrimitiveMeshes() {
+    // drawSolidCube(1.0f): los 8 vértices de generateCubeVAOIndexed con sus normales diagonales
+    {
+        Mesh& mesh = _meshes[static_cast<int>(DrawMesh::CUBE)];
+        const float c = 0.5f;
+        mesh.positions = { { -c, -c, -c }, { c, -c, -c }, { c, c, -c }, { -c, c, -c },
+                           { -c, -c,  c }, { c, -c,  c }, { c, c,  c }, { -c, c,  c } };
+        for (const glm::vec3& position : mesh.positions) {
+            mesh.normals.push_back(position * 2.0f);
+        }
+        mesh.indices = { 0, 2, 1,  0, 3, 2,  1, 2, 5,  5, 2, 6,  2, 7, 6,  3, 7, 2,
+                         0, 1, 4,  1, 5, 4,  4, 5, 6,  4, 6, 7,  0, 4, 3,  4, 7, 3 };
+    }
+
+    // drawSolidSphere(1.0f, 20, 20): misma parametrización que generateSphereVAO
+    {
+        Mesh& mesh = _meshes[static_cast<int>(DrawMesh::SPHERE)];
+        const uint32_t stacks = 20, slices = 20;
+        for (uint32_t stack = 0; stack <= stacks; ++stack) {
+            const float phi = glm::pi<float>() * static_cast<float>(stack) / static_cast<float>(stacks);
+            for (uint32_t slice = 0; slice <= slices; ++slice) {
+                const float theta = glm::two_pi<float>() * static_cast<float>(slice) / static_cast<float>(slices);
+                const glm::vec3 normal(-std::cos(theta) * std::sin(phi), -std::cos(phi), std::sin(theta) * std::sin(phi));
+                mesh.positions.push_back(normal);
+                mesh.normals.push_back(normal);
+            }
+        }
+        for (uint32_t stack = 0; stack < stacks; ++stack) {
+            for (uint32_t slice = 0; slice < slices; ++slice) {
+                const uint32_t a = stack * (slices + 1) + slice, b = a + 1;
+                const uint32_t c = a + slices + 1, d = c + 1;
+                // Los polos son un solo punto: ahí una de las dos mitades del quad es degenerada
+                if (stack > 0) mesh.indices.insert(mesh.indices.end(), { a, b, d });
+                if (stack + 1 < stacks) mesh.indices.insert(mesh.indices.end(), { a, d, c });
+            }
+        }
+    }
+
+    // Tubos abiertos de generateCylinderVAO: y de 0 a height, normales horizontales
+    const auto buildCylinder = [](Mesh& mesh, float base, float top, float height, uint32_t stacks, uint32_t slices) {
+        for (uint32_t stack = 0; stack <= stacks; ++stack) {
+            const float t = static_cast<float>(stack) / static_cast<float>(stacks);
+            const float radius = base * (1.0f - t) + top * t;
+            for (uint32_t slice = 0; slice <= slices; ++slice) {
+                const float theta = glm::two_pi<float>() * static_cast<float>(slice) / static_cast<float>(slices);
+                mesh.positions.emplace_back(std::cos(theta) * radius, height * t, std::sin(theta) * radius);
+                mesh.normals.emplace_back(std::cos(theta), 0.0f, std::sin(theta));
+            }
+        }
+        for (uint32_t stack = 0; stack < stacks; ++stack) {
+            for (uint32_t slice = 0; slice < slices; ++slice) {
+                const uint32_t a = stack * (slices + 1) + slice, b = a + 1;
+                const uint32_t c = a + slices + 1, d = c + 1;
+                mesh.indices.insert(mesh.indices.end(), { a, c, b,  b, c, d });
+            }
+        }
+    };
+    buildCylinder(_meshes[static_cast<int>(DrawMesh::CYLINDER)], 0.5f, 0.5f, 0.2f, 16, 16);
+    buildCylinder(_meshes[static_cast<int>(DrawMesh::CONE)], 1.0f, 0.0f, 1.0f, 20, 20);
+}
+
+void SoftwareRasterizer::_runPhase(Phase phase, size_t numJobs) {
+    if (numJobs == 0) return;
+
+    _phase = phase;
+    _numJobs = numJobs;
+    _nextJob.store(0, std::memory_order_relaxed);
+
+    // Con un solo trabajo no vale la pena despertar a nadie
+    const bool parallel = numJobs > 1 && !_workers.empty();
+    if (parallel) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            ++_generation;
+            _busyWorkers = static_cast<int>(_workers.size());
+        }
+        _workAvailable.notify_all();
+    }
+
+    _runJobs(0);
+
+    if (parallel) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _workDone.wait(lock, [this] { return _busyWorkers == 0; });
+    }
+}
+
+void SoftwareRasterizer::_runJobs(size_t threadIndex) {
+    for (size_t job = _nextJob.fetch_add(1, std::memory_order_relaxed); job < _numJobs;
+         job = _nextJob.fetch_add(1, std::memory_order_relaxed)) {
+        if (_phase == Phase::VERTICES) {
+            _processChunk(job, threadIndex);
+        } else {
+            _rasterTile(job, threadIndex);
+        }
+    }
+}
+
+void SoftwareRasterizer::_processChunk(size_t chunkIndex, size_t threadIndex) {
+    std::vector<ScreenTriangle>& triangles = _chunks[chunkIndex].triangles;
+    triangles.clear();
+
+    const std::vector<DrawItem>& drawItems = *_drawItems;
+    const size_t first = chunkIndex * static_cast<size_t>(_settings.itemsPerChunk);
+    const size_t last = std::min(first + static_cast<size_t>(_settings.itemsPerChunk), drawItems.size());
+    std::vector<ClipVertex>& vertices = _vertexScratch[threadIndex];
+
+    for (size_t i = first; i < last; ++i) {
+        const DrawItem& item = drawItems[i];
+        if (item.mesh == DrawMesh::MODEL && !_hasModel) continue;
+        const Mesh& mesh = _meshes[static_cast<int>(item.mesh)];
+
+        // Mismo material que envía submitDrawItems()
+        const Material material = { item.color * 0.2f, item.color, glm::vec3(0.5f), item.shininess };
+        const glm::mat4 mvpMtx = _viewProjMtx * item.modelMtx;
+        // El modelo se dibuja con la variante instanciada, que ilumina en coordenadas de mundo
+        const bool instanced = item.mesh == DrawMesh::MODEL;
+
+        vertices.resize(mesh.positions.size());
+        for (size_t v = 0; v < mesh.positions.size(); ++v) {
+            const glm::vec4 position(mesh.positions[v], 1.0f);
+            const glm::vec3 normal = glm::normalize(item.normalMtx * mesh.normals[v]);
+            // Igual que el shader sin instancing: la vista y las luces puntuales se miden desde
+            // vPos, la posición sin la matriz de modelo
+            const glm::vec3 fragmentPos = instanced ? glm::vec3(item.modelMtx * position) : mesh.positions[v];
+            const glm::vec3 viewVector = glm::normalize(_eyePosition - fragmentPos);
+            vertices[v].position = mvpMtx * position;
+            vertices[v].color = shadeVertex(*_lights, material, _settings.specular, fragmentPos, normal, viewVector);
+        }
+
+        for (size_t t = 0; t + 2 < mesh.indices.size(); t += 3) {
+            _emitTriangle(vertices[mesh.indices[t]], vertices[mesh.indices[t + 1]], vertices[mesh.indices[t + 2]],
+                          static_cast<uint32_t>(chunkIndex), threadIndex);
+        }
+    }
+}
+
+void SoftwareRasterizer::_emitTriangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, uint32_t chunkIndex, size_t threadIndex) {
+    const int codeA = outcode(a.position), codeB = outcode(b.position), codeC = outcode(c.position);
+    // Los tres vértices fuera del mismo plano: el triángulo no se ve
+    if ((codeA & codeB & codeC) != 0) return;
+
+    if (((codeA | codeB | codeC) & NEAR_PLANE) == 0) {
+        _setupTriangle(a, b, c, chunkIndex, threadIndex);
+        return;
+    }
+
+    // Recorte contra el plano cercano (z = -w); el polígono resultante tiene 3 o 4 vértices
+    const ClipVertex* input[3] = { &a, &b, &c };
+    ClipVertex polygon[4];
+    int numVertices = 0;
+    for (int i = 0; i < 3; ++i) {
+        const ClipVertex& current = *input[i];
+        const ClipVertex& next = *input[(i + 1) % 3];
+        const float currentDistance = current.position.z + current.position.w;
+        const float nextDistance = next.position.z + next.position.w;
+        if (currentDistance >= 0.0f) {
+            polygon[numVertices++] = current;
+        }
+        if ((currentDistance >= 0.0f) != (nextDistance >= 0.0f)) {
+            const float t = currentDistance / (currentDistance - nextDistance);
+            polygon[numVertices].position = glm::mix(current.position, next.position, t);
+            polygon[numVertices].color = glm::mix(current.color, next.color, t);
+            ++numVertices;
+        }
+    }
+    for (int i = 1; i + 1 < numVertices; ++i) {
+        _setupTriangle(polygon[0], polygon[i], polygon[i + 1], chunkIndex, threadIndex);
+    }
+}
+
+void SoftwareRasterizer::_setupTriangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, uint32_t chunkIndex, size_t threadIndex) {
+    const float width = static_cast<float>(_settings.width), height = static_cast<float>(_settings.height);
+    const ClipVertex* vertices[3] = { &a, &b, &c };
+    glm::vec2 screen[3];
+    float depth[3], invW[3];
+    for (int i = 0; i < 3; ++i) {
+        const glm::vec4& clip = vertices[i]->position;
+        invW[i] = 1.0f / clip.w;
+        // Viewport de toda la imagen con la fila 0 arriba
+        screen[i] = glm::vec2((clip.x * invW[i] * 0.5f + 0.5f) * width, (0.5f - clip.y * invW[i] * 0.5f) * height);
+        depth[i] = clip.z * invW[i] * 0.5f + 0.5f;
+    }
+
+    // No se descartan caras: las que quedan al revés se reordenan para que el área sea positiva
+    const float area = Edge(screen[0], screen[1]).evaluate(screen[2].x, screen[2].y);
+    if (area == 0.0f || !std::isfinite(area)) return;
+    int order[3] = { 0, 1, 2 };
+    if (area < 0.0f) std::swap(order[1], order[2]);
+
+    ScreenTriangle triangle;
+    triangle.p0 = screen[order[0]];  triangle.p1 = screen[order[1]];  triangle.p2 = screen[order[2]];
+    triangle.z0 = depth[order[0]];   triangle.z1 = depth[order[1]];   triangle.z2 = depth[order[2]];
+    triangle.invW0 = invW[order[0]]; triangle.invW1 = invW[order[1]]; triangle.invW2 = invW[order[2]];
+    triangle.colorW0 = vertices[order[0]]->color * invW[order[0]];
+    triangle.colorW1 = vertices[order[1]]->color * invW[order[1]];
+    triangle.colorW2 = vertices[order[2]]->color * invW[order[2]];
+
+    // Caja de los centros de píxel que caen dentro de la del triángulo, recortada a la imagen.
+    // Los triángulos lejanos suelen ser menores que un píxel y muchos no tienen ningún centro:
+    // se descartan aquí sin anotarse en ningún tile
+    const glm::vec2 minimum = glm::min(glm::min(screen[0], screen[1]), screen[2]);
+    const glm::vec2 maximum = glm::max(glm::max(screen[0], screen[1]), screen[2]);
+    triangle.minX = static_cast<int>(std::max(std::ceil(minimum.x - 0.5f), 0.0f));
+    triangle.minY = static_cast<int>(std::max(std::ceil(minimum.y - 0.5f), 0.0f));
+    triangle.maxX = static_cast<int>(std::min(std::floor(maximum.x - 0.5f), width - 1.0f));
+    triangle.maxY = static_cast<int>(std::min(std::floor(maximum.y - 0.5f), height - 1.0f));
+    if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY) return;
+
+    std::vector<ScreenTriangle>& triangles = _chunks[chunkIndex].triangles;
+    const uint64_t id = (static_cast<uint64_t>(chunkIndex) << 32) | static_cast<uint64_t>(triangles.size());
+    triangles.push_back(triangle);
+    ++_threadTriangles[threadIndex];
+
+    const size_t numTiles = static_cast<size_t>(_tilesX * _tilesY);
+    std::vector<uint64_t>* bins = &_bins[threadIndex * numTiles];
+    for (int tileY = triangle.minY / _settings.tileSize; tileY <= triangle.maxY / _settings.tileSize; ++tileY) {
+        for (int tileX = triangle.minX / _settings.tileSize; tileX <= triangle.maxX / _settings.tileSize; ++tileX) {
+            bins[tileY * _tilesX + tileX].push_back(id);
+        }
+    }
+}
+
+void SoftwareRasterizer::_rasterTile(size_t tileIndex, size_t threadIndex) {
+    const int tileX0 = static_cast<int>(tileIndex % static_cast<size_t>(_tilesX)) * _settings.tileSize;
+    const int tileY0 = static_cast<int>(tileIndex / static_cast<size_t>(_tilesX)) * _settings.tileSize;
+    const int tileX1 = std::min(tileX0 + _settings.tileSize, _settings.width);
+    const int tileY1 = std::min(tileY0 + _settings.tileSize, _settings.height);
+
+    const uint8_t clear[3] = { toUnorm8(_settings.clearColor.r), toUnorm8(_settings.clearColor.g), toUnorm8(_settings.clearColor.b) };
+    for (int y = tileY0; y < tileY1; ++y) {
+        const size_t row = static_cast<size_t>(y) * static_cast<size_t>(_settings.width);
+        std::fill(_depth.begin() + static_cast<std::ptrdiff_t>(row + tileX0), _depth.begin() + static_cast<std::ptrdiff_t>(row + tileX1), 1.0f);
+        for (int x = tileX0; x < tileX1; ++x) {
+            std::copy(clear, clear + 3, &_color[(row + static_cast<size_t>(x)) * 3]);
+        }
+    }
+
+    // Las listas de cada hilo ya vienen en orden; juntas se ordenan para dibujar los
+    // triángulos en el orden en que se enviaron, como GL
+    std::vector<uint64_t>& ids = _mergeScratch[threadIndex];
+    ids.clear();
+    const size_t numTiles = static_cast<size_t>(_tilesX * _tilesY);
+    int nonEmptyBins = 0;
+    for (size_t thread = 0; thread < _vertexScratch.size(); ++thread) {
+        const std::vector<uint64_t>& bin = _bins[thread * numTiles + tileIndex];
+        if (bin.empty()) continue;
+        ids.insert(ids.end(), bin.begin(), bin.end());
+        ++nonEmptyBins;
+    }
+    if (nonEmptyBins > 1) {
+        std::sort(ids.begin(), ids.end());
+    }
+
+    size_t fragments = 0;
+    for (const uint64_t id : ids) {
+        const ScreenTriangle& triangle = _chunks[id >> 32].triangles[id & 0xFFFFFFFFu];
+        _rasterTriangle(triangle, tileX0, tileY0, tileX1, tileY1, fragments);
+    }
+    _threadFragments[threadIndex] += fragments;
+}
+
+void SoftwareRasterizer::_rasterTriangle(const ScreenTriangle& triangle, int tileX0, int tileY0, int tileX1, int tileY1, size_t& fragments) {
+    // Las aristas se evalúan relativas a la esquina del tile: con coordenadas de toda la imagen
+    // los términos de C son miles de veces mayores que el área de un triángulo delgado y la
+    // cancelación arruina sus pesos. Dos triángulos con una arista en común usan la misma
+    // esquina, así que siguen dando valores exactamente opuestos
+    const glm::vec2 origin(static_cast<float>(tileX0), static_cast<float>(tileY0));
+    const glm::vec2 p0 = triangle.p0 - origin, p1 = triangle.p1 - origin, p2 = triangle.p2 - origin;
+
+    // Arista opuesta a cada vértice: su valor sobre el área es el peso de ese vértice
+    const Edge edge0(p1, p2);
+    const Edge edge1(p2, p0);
+    const Edge edge2(p0, p1);
+    const float area = edge2.evaluate(p2.x, p2.y);
+    // Tan delgado que cambió de signo al moverlo: no cubre ningún centro de píxel
+    if (!(area > 0.0f)) return;
+    const float invArea = 1.0f / area;
+    // La profundidad se interpola como diferencias a z0 para que el error de los pesos no se
+    // multiplique por el valor completo (casi 1) de la profundidad
+    const float dz1 = triangle.z1 - triangle.z0, dz2 = triangle.z2 - triangle.z0;
+
+    const int minY = std::max(triangle.minY, tileY0), maxY = std::min(triangle.maxY, tileY1 - 1);
+    // tileX0 es múltiplo de 4, así que los grupos de cuatro nunca cruzan al tile vecino por la izquierda
+    const int minX = tileX0 + (std::max(triangle.minX, tileX0) - tileX0) / WIDTH * WIDTH;
+    const int maxX = std::min(triangle.maxX, tileX1 - 1);
+
+    const Float4 A0 = Float4::broadcast(edge0.A), A1 = Float4::broadcast(edge1.A), A2 = Float4::broadcast(edge2.A);
+    float w0[WIDTH], w1[WIDTH], w2[WIDTH];
+
+    for (int y = minY; y <= maxY; ++y) {
+        const float centerY = static_cast<float>(y - tileY0) + 0.5f;
+        const Float4 row0 = Float4::broadcast(edge0.B * centerY + edge0.C);
+        const Float4 row1 = Float4::broadcast(edge1.B * centerY + edge1.C);
+        const Float4 row2 = Float4::broadcast(edge2.B * centerY + edge2.C);
+        const size_t rowStart = static_cast<size_t>(y) * static_cast<size_t>(_settings.width);
+
+        for (int x = minX; x <= maxX; x += WIDTH) {
+            const Float4 centerX = Float4::ramp(static_cast<float>(x - tileX0) + 0.5f);
+            const Float4 e0 = A0 * centerX + row0;
+            const Float4 e1 = A1 * centerX + row1;
+            const Float4 e2 = A2 * centerX + row2;
+
+            // Solo los píxeles de este tile: los de la derecha son de otro hilo
+            const int validLanes = ALL_LANES >> std::max(WIDTH - (tileX1 - x), 0);
+            const int mask = edge0.covered(e0) & edge1.covered(e1) & edge2.covered(e2) & validLanes;
+            if (mask == 0) continue;
+
+            e0.store(w0);
+            e1.store(w1);
+            e2.store(w2);
+            for (int lane = 0; lane < WIDTH; ++lane) {
+                if ((mask & (1 << lane)) == 0) continue;
+
+                const float l0 = w0[lane] * invArea, l1 = w1[lane] * invArea, l2 = w2[lane] * invArea;
+                const size_t pixel = rowStart + static_cast<size_t>(x + lane);
+                // La profundidad se interpola en pantalla, como el depth buffer de GL
+                const float z = triangle.z0 + l1 * dz1 + l2 * dz2;
+                if (!(z < _depth[pixel])) continue;
+                _depth[pixel] = z;
+
+                // El color en perspectiva
+                const float invW = l0 * triangle.invW0 + l1 * triangle.invW1 + l2 * triangle.invW2;
+                const glm::vec3 color = (l0 * triangle.colorW0 + l1 * triangle.colorW1 + l2 * triangle.colorW2) / invW;
+                uint8_t* out = &_color[pixel * 3];
+                out[0] = toUnorm8(color.r);
+                out[1] = toUnorm8(color.g);
+                out[2] = toUnorm8(color.b);
+                ++fragments;
+            }
+        }
+    }
+}
+
+void SoftwareRasterizer::_workerMain(size_t workerIndex, uint64_t lastGeneration) {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workAvailable.wait(lock, [&] { return _stopping || _generation != lastGeneration; });
+            if (_stopping) return;
+            lastGeneration = _generation;
+        }
+
+        _runJobs(workerIndex);
+
+        bool lastWorker;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            lastWorker = --_busyWorkers == 0;
+        }
+        if (lastWorker) {
+            _workDone.notify_one();
+        }
+    }
+}
@@ -0,0 +1,193 @@
+#ifndef RENDER_SOFTWARE_RASTERIZER_H
+#define RENDER_SOFTWARE_RASTERIZER_H
+
+#include "FramePacket.h"
+#include "ModelSway.h"
+
+#include <glm/glm.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CSCI441 { class ModelLoader; }
+
+/**
+ * @class SoftwareRasterizer
+ * @brief Dibuja en la CPU las mismas piezas (DrawItem) que submitDrawItems() envía a OpenGL,
+ * sin contexto GL ni GPU.
+ *
+ * Las mallas son copias de CPU de las primitivas de objects.hpp con los mismos parámetros que
+ * usa DrawMesh, más la malla del modelo cargado. La iluminación replica shaders/A3.v.glsl
+ * (Gouraud: el color se calcula por vértice y se interpola en perspectiva), con la prueba de
+ * profundidad GL_LESS y sin descartar caras, igual que el renderizador.
+ *
+ * Cada frame tiene dos fases repartidas entre hilos:
+ *  1. Vértices: bloques de piezas se transforman, se iluminan, se recortan contra el plano
+ *     cercano y sus triángulos se anotan en los tiles de pantalla que tocan.
+ *  2. Raster: cada hilo toma tiles completos; dentro de un tile los triángulos se recorren en
+ *     el orden en que se enviaron y las funciones de arista se evalúan de a cuatro píxeles
+ *     (SSE2 si está disponible).
+ *
+ * Ningún píxel depende de cómo se repartió el trabajo, así que la imagen es la misma con
+ * cualquier número de hilos y sirve para comparar frames entre ejecuciones.
+ */
+class SoftwareRasterizer {
+public:
+    /**
+     * @brief Tamaño de la imagen y reparto del trabajo.
+     */
+    struct Settings {
+        int width = 640;
+        int height = 360;
+        int tileSize = 32;                  // píxeles por lado de cada tile; se redondea a múltiplo de 4
+        int numThreads = 0;                 // 0: uno por núcleo
+        int itemsPerChunk = 32;             // piezas por bloque de la fase de vértices
+        bool specular = true;               // false: variante Lambert del shader
+        glm::vec3 clearColor = glm::vec3(0.0f);
+    };
+
+    /**
+     * @brief Conteos del último render().
+     */
+    struct Stats {
+        size_t trianglesSubmitted = 0;      // triángulos de todas las piezas
+        size_t trianglesBinned = 0;         // los que quedaron en pantalla después de recortar
+        size_t fragmentsWritten = 0;        // píxeles que pasaron la prueba de profundidad
+    };
+
+    SoftwareRasterizer();
+    ~SoftwareRasterizer();
+
+    SoftwareRasterizer(const SoftwareRasterizer&) = delete;
+    SoftwareRasterizer& operator=(const SoftwareRasterizer&) = delete;
+
+    /**
+     * @brief Reserva la imagen y lanza los hilos auxiliares; quien llama a render() también
+     * procesa bloques y tiles.
+     */
+    void start(const Settings& settings);
+
+    /**
+     * @brief Detiene los hilos auxiliares.
+     */
+    void stop();
+
+    /**
+     * @brief Copia la malla del modelo que dibujan las piezas DrawMesh::MODEL.
+     *
+     * @param model Modelo ya cargado, o nullptr para no dibujar esas piezas.
+     * @param skinWeights Pesos de ModelSway; con boneMatrices, la copia queda en esa pose
+     * igual que en la variante USE_SKINNING del shader. nullptr deja la malla en reposo.
+     */
+    void setModelMesh(const CSCI441::ModelLoader* model, const std::vector<ModelSway::SkinWeight>* skinWeights = nullptr,
+                      const glm::mat4* boneMatrices = nullptr);
+
+    /**
+     * @brief Limpia la imagen y dibuja las piezas desde un punto de vista.
+     *
+     * El viewport de view se ignora: la vista ocupa toda la imagen.
+     */
+    void render(const FrameView& view, const SceneLights& lights, const std::vector<DrawItem>& drawItems);
+
+    /**
+     * @brief Escribe la imagen como PPM binario (P6).
+     *
+     * @return false si el archivo no se pudo escribir.
+     */
+    bool writePPM(const char* FILENAME) const;
+
+    int getWidth() const { return _settings.width; }
+    int getHeight() const { return _settings.height; }
+    int getNumThreads() const { return static_cast<int>(_workers.size()) + 1; }
+    // RGB de 8 bits por canal, de la fila superior a la inferior
+    const std::vector<uint8_t>& getColorBuffer() const { return _color; }
+    // Profundidad en [0, 1] como la del depth buffer de GL; 1 donde no se dibujó nada
+    const std::vector<float>& getDepthBuffer() const { return _depth; }
+    const Stats& getStats() const { return _stats; }
+
+private:
+    struct Mesh {
+        std::vector<glm::vec3> positions;
+        std::vector<glm::vec3> normals;
+        std::vector<uint32_t> indices;
+    };
+
+    // Vértice ya transformado e iluminado
+    struct ClipVertex {
+        glm::vec4 position;
+        glm::vec3 color;
+    };
+
+    // Triángulo en coordenadas de pantalla, listo para el raster
+    struct ScreenTriangle {
+        glm::vec2 p0, p1, p2;
+        float z0, z1, z2;                   // profundidad en [0, 1]; se interpola en pantalla
+        float invW0, invW1, invW2;
+        glm::vec3 colorW0, colorW1, colorW2; // color / w, para interpolar en perspectiva
+        int minX, minY, maxX, maxY;         // caja en píxeles, ya recortada a la imagen
+    };
+
+    // Triángulos de un bloque, en el orden de las piezas
+    struct Chunk {
+        std::vector<ScreenTriangle> triangles;
+    };
+
+    enum class Phase { VERTICES, RASTER };
+
+    void _buildPrimitiveMeshes();
+    void _runPhase(Phase phase, size_t numJobs);
+    void _runJobs(size_t threadIndex);
+    void _processChunk(size_t chunkIndex, size_t threadIndex);
+    void _emitTriangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, uint32_t chunkIndex, size_t threadIndex);
+    void _setupTriangle(const ClipVertex& a, const ClipVertex& b, const ClipVertex& c, uint32_t chunkIndex, size_t threadIndex);
+    void _rasterTile(size_t tileIndex, size_t threadIndex);
+    void _rasterTriangle(const ScreenTriangle& triangle, int tileX0, int tileY0, int tileX1, int tileY1, size_t& fragments);
+    void _workerMain(size_t workerIndex, uint64_t lastGeneration);
+
+    Settings _settings;
+    Stats _stats;
+
+    Mesh _meshes[static_cast<int>(DrawMesh::MODEL) + 1];
+    bool _hasModel = false;
+
+    // Imagen
+    std::vector<uint8_t> _color;
+    std::vector<float> _depth;
+    int _tilesX = 0, _tilesY = 0;
+
+    // Entrada del frame actual
+    const std::vector<DrawItem>* _drawItems = nullptr;
+    const SceneLights* _lights = nullptr;
+    glm::mat4 _viewProjMtx = glm::mat4(1.0f);
+    glm::vec3 _eyePosition = glm::vec3(0.0f);
+
+    std::vector<Chunk> _chunks;
+
+    // Un juego de listas por hilo y tile; cada entrada es (bloque << 32) | triángulo. Un hilo
+    // toma los bloques en orden creciente, así que cada lista ya está ordenada
+    std::vector<std::vector<uint64_t>> _bins;
+    std::vector<std::vector<ClipVertex>> _vertexScratch;
+    std::vector<std::vector<uint64_t>> _mergeScratch;
+    std::vector<size_t> _threadTriangles;
+    std::vector<size_t> _threadFragments;
+
+    // Reparto del trabajo con los hilos auxiliares
+    std::mutex _mutex;
+    std::condition_variable _workAvailable;
+    std::condition_variable _workDone;
+    uint64_t _generation = 0;
+    int _busyWorkers = 0;
+    bool _stopping = false;
+    Phase _phase = Phase::VERTICES;
+    std::atomic<size_t> _nextJob{0};
+    size_t _numJobs = 0;
+
+    std::vector<std::thread> _workers;
+};
+
+#endif // RENDER_SOFTWARE_RASTERIZER_H
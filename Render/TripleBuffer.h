@@ -0,0 +1,67 @@
+#ifndef RENDER_TRIPLE_BUFFER_H
+#define RENDER_TRIPLE_BUFFER_H
+
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @class TripleBuffer
+ * @brief Intercambio sin bloqueos entre un único productor y un único consumidor.
+ *
+ * El productor escribe siempre en su propio búfer y lo publica intercambiándolo con el
+ * búfer intermedio; el consumidor toma el intermedio solo cuando hay uno nuevo. Ninguno
+ * espera al otro y el consumidor siempre ve el último valor publicado. Los tres búferes
+ * se reutilizan, así que los contenedores internos de T conservan su capacidad.
+ *
+ * @tparam T Tipo del dato intercambiado.
+ */
+template<typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+    TripleBuffer(const TripleBuffer&) = delete;
+    TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+    /**
+     * @brief Búfer donde el productor prepara el siguiente valor.
+     */
+    T& writeBuffer() { return _buffers[_backIndex]; }
+
+    /**
+     * @brief Publica el búfer de escritura; el productor recibe otro libre.
+     */
+    void publish() {
+        const uint8_t previous = _middle.exchange(static_cast<uint8_t>(_backIndex | DIRTY_BIT), std::memory_order_acq_rel);
+        _backIndex = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Toma el último valor publicado si hay uno que el consumidor no haya visto.
+     *
+     * @return true si readBuffer() cambió.
+     */
+    bool acquire() {
+        if ((_middle.load(std::memory_order_relaxed) & DIRTY_BIT) == 0) {
+            return false;
+        }
+        const uint8_t previous = _middle.exchange(_frontIndex, std::memory_order_acq_rel);
+        _frontIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Último valor tomado por el consumidor.
+     */
+    const T& readBuffer() const { return _buffers[_frontIndex]; }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x3;
+    static constexpr uint8_t DIRTY_BIT = 0x4;
+
+    T _buffers[3];
+    uint8_t _backIndex = 0;             // solo lo toca el productor
+    std::atomic<uint8_t> _middle{1};    // índice compartido más el bit de "nuevo"
+    uint8_t _frontIndex = 2;            // solo lo toca el consumidor
+};
+
+#endif // RENDER_TRIPLE_BUFFER_H
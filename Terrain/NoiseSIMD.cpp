@@ -0,0 +1,147 @@
+#include "NoiseSIMD.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define NOISE_SIMD_USE_SSE2 1
+#endif
+
+namespace {
+
+#ifdef NOISE_SIMD_USE_SSE2
+    // Cuatro floats en un registro SSE2
+    struct Float4 {
+        __m128 v;
+
+        static Float4 load(const float* p) { return { _mm_loadu_ps(p) }; }
+        static Float4 broadcast(float s) { return { _mm_set1_ps(s) }; }
+        void store(float* p) const { _mm_storeu_ps(p, v); }
+    };
+
+    inline Float4 operator+(Float4 a, Float4 b) { return { _mm_add_ps(a.v, b.v) }; }
+    inline Float4 operator-(Float4 a, Float4 b) { return { _mm_sub_ps(a.v, b.v) }; }
+    inline Float4 operator*(Float4 a, Float4 b) { return { _mm_mul_ps(a.v, b.v) }; }
+    inline Float4 operator/(Float4 a, Float4 b) { return { _mm_div_ps(a.v, b.v) }; }
+
+    // SSE2 no tiene floor: se trunca y se resta 1 donde el truncado quedó por encima
+    inline Float4 floor4(Float4 a) {
+        const __m128 truncated = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+        const __m128 correction = _mm_and_ps(_mm_cmpgt_ps(truncated, a.v), _mm_set1_ps(1.0f));
+        return { _mm_sub_ps(truncated, correction) };
+    }
+
+    inline Float4 abs4(Float4 a) { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v) }; }
+#else
+    // Sin SSE2: bucles de cuatro elementos que el compilador puede vectorizar
+    struct Float4 {
+        float v[NoiseSIMD::WIDTH];
+
+        static Float4 load(const float* p) { Float4 r; for (int i = 0; i < NoiseSIMD::WIDTH; ++i) r.v[i] = p[i]; return r; }
+        static Float4 broadcast(float s) { Float4 r; for (float& x : r.v) x = s; return r; }
+        void store(float* p) const { for (int i = 0; i < NoiseSIMD::WIDTH; ++i) p[i] = v[i]; }
+    };
+
+    inline Float4 operator+(Float4 a, Float4 b) { for (int i = 0; i < NoiseSIMD::WIDTH; ++i) a.v[i] += b.v[i]; return a; }
+    inline Float4 operator-(Float4 a, Float4 b) { for (int i = 0; i < NoiseSIMD::WIDTH; ++i) a.v[i] -= b.v[i]; return a; }
+    inline Float4 operator*(Float4 a, Float4 b) { for (int i = 0; i < NoiseSIMD::WIDTH; ++i) a.v[i] *= b.v[i]; return a; }
+    inline Float4 operator/(Float4 a, Float4 b) { for (int i = 0; i < NoiseSIMD::WIDTH; ++i) a.v[i] /= b.v[i]; return a; }
+    inline Float4 floor4(Float4 a) { for (float& x : a.v) x = std::floor(x); return a; }
+    inline Float4 abs4(Float4 a) { for (float& x : a.v) x = std::fabs(x); return a; }
+#endif
+
+    inline Float4 operator+(Float4 a, float s) { return a + Float4::broadcast(s); }
+    inline Float4 operator-(Float4 a, float s) { return a - Float4::broadcast(s); }
+    inline Float4 operator*(float s, Float4 a) { return Float4::broadcast(s) * a; }
+
+    // Mismas operaciones, en el mismo orden, que glm/detail/_noise.hpp y glm::mix/mod/fract
+    inline Float4 fract4(Float4 a) { return a - floor4(a); }
+    inline Float4 mod289(Float4 a) { return a - floor4(a * Float4::broadcast(1.0f / 289.0f)) * Float4::broadcast(289.0f); }
+    inline Float4 modulo289(Float4 a) { return a - Float4::broadcast(289.0f) * floor4(a / Float4::broadcast(289.0f)); }
+    inline Float4 permute(Float4 a) { return mod289(((a * Float4::broadcast(34.0f)) + 1.0f) * a); }
+    inline Float4 taylorInvSqrt(Float4 r) { return Float4::broadcast(1.79284291400159f) - Float4::broadcast(0.85373472095314f) * r; }
+    inline Float4 fade(Float4 t) { return (t * t * t) * (t * (t * Float4::broadcast(6.0f) - 15.0f) + 10.0f); }
+    inline Float4 mix(Float4 x, Float4 y, Float4 a) { return x * (Float4::broadcast(1.0f) - a) + y * a; }
+
+    // Gradiente de una esquina de la celda, ya normalizado, proyectado sobre (fx, fy)
+    inline Float4 cornerContribution(Float4 ix, Float4 iy, Float4 fx, Float4 fy) {
+        const Float4 i = permute(permute(ix) + iy);
+
+        Float4 gx = 2.0f * fract4(i / Float4::broadcast(41.0f)) - 1.0f;
+        const Float4 gy = abs4(gx) - 0.5f;
+        const Float4 tx = floor4(gx + 0.5f);
+        gx = gx - tx;
+
+        const Float4 norm = taylorInvSqrt(gx * gx + gy * gy);
+        return (gx * norm) * fx + (gy * norm) * fy;
+    }
+
+    inline Float4 perlin4(Float4 x, Float4 y) {
+        const Float4 floorX = floor4(x), floorY = floor4(y);
+        const Float4 ix0 = modulo289(floorX), iy0 = modulo289(floorY);
+        const Float4 ix1 = modulo289(floorX + 1.0f), iy1 = modulo289(floorY + 1.0f);
+        const Float4 fx0 = fract4(x), fy0 = fract4(y);
+        const Float4 fx1 = fx0 - 1.0f, fy1 = fy0 - 1.0f;
+
+        const Float4 n00 = cornerContribution(ix0, iy0, fx0, fy0);
+        const Float4 n10 = cornerContribution(ix1, iy0, fx1, fy0);
+        const Float4 n01 = cornerContribution(ix0, iy1, fx0, fy1);
+        const Float4 n11 = cornerContribution(ix1, iy1, fx1, fy1);
+
+        const Float4 fadeX = fade(fx0), fadeY = fade(fy0);
+        const Float4 nx0 = mix(n00, n10, fadeX);
+        const Float4 nx1 = mix(n01, n11, fadeX);
+        return 2.3f * mix(nx0, nx1, fadeY);
+    }
+
+    // Desplazamiento en [0, 289) de una octava; 289 es el periodo de la permutación
+    inline float octaveOffset(uint32_t seed, uint32_t octave, uint32_t axis) {
+        uint32_t h = seed * 0x9E3779B9u ^ (octave * 0x85EBCA6Bu + axis * 0xC2B2AE35u);
+        h ^= h >> 16;
+        h *= 0x7FEB352Du;
+        h ^= h >> 15;
+        return static_cast<float>(h & 0xFFFFu) * (289.0f / 65536.0f);
+    }
+}
+
+void NoiseSIMD::perlin(const float* X, const float* Y, float* out) {
+    perlin4(Float4::load(X), Float4::load(Y)).store(out);
+}
+
+void NoiseSIMD::fractalRow(const FractalParams& params, float originX, float spacing, int firstIndex, int count, float z, float* out) {
+    float totalAmplitude = 0.0f;
+    float amplitude = 1.0f;
+    for (int octave = 0; octave < params.numOctaves; ++octave) {
+        totalAmplitude += amplitude;
+        amplitude *= params.gain;
+    }
+    const Float4 normalization = Float4::broadcast(totalAmplitude > 0.0f ? 1.0f / totalAmplitude : 0.0f);
+
+    for (int start = 0; start < count; start += WIDTH) {
+        float xs[WIDTH];
+        for (int lane = 0; lane < WIDTH; ++lane) {
+            xs[lane] = originX + static_cast<float>(firstIndex + start + lane) * spacing;
+        }
+        const Float4 x = Float4::load(xs);
+        const Float4 zs = Float4::broadcast(z);
+
+        Float4 sum = Float4::broadcast(0.0f);
+        float frequency = params.baseFrequency;
+        amplitude = 1.0f;
+        for (int octave = 0; octave < params.numOctaves; ++octave) {
+            const Float4 px = x * Float4::broadcast(frequency) + octaveOffset(params.seed, static_cast<uint32_t>(octave), 0);
+            const Float4 pz = zs * Float4::broadcast(frequency) + octaveOffset(params.seed, static_cast<uint32_t>(octave), 1);
+            sum = sum + Float4::broadcast(amplitude) * perlin4(px, pz);
+            frequency *= params.lacunarity;
+            amplitude *= params.gain;
+        }
+
+        // El último grupo puede pasarse de count; esos carriles se calculan y se descartan
+        float result[WIDTH];
+        (sum * normalization).store(result);
+        const int lanes = count - start < WIDTH ? count - start : WIDTH;
+        for (int lane = 0; lane < lanes; ++lane) {
+            out[start + lane] = result[lane];
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef TERRAIN_NOISE_SIMD_H
+#define TERRAIN_NOISE_SIMD_H
+
+#include <cstdint>
+
+/**
+ * @brief Ruido de Perlin 2D evaluado en varios puntos a la vez.
+ *
+ * Es la misma fórmula que glm::perlin(glm::vec2) de glm/gtc/noise.hpp, reescrita en forma
+ * "estructura de arreglos": cada operación trabaja sobre WIDTH puntos distintos, así que se
+ * traduce a instrucciones SSE2 cuando están disponibles y a bucles que el compilador puede
+ * vectorizar en otro caso. Cada punto se calcula solo a partir de sus coordenadas, por lo que
+ * el resultado no depende de cómo se agrupen los puntos ni de cuántos hilos los repartan.
+ */
+namespace NoiseSIMD {
+
+    /// Puntos evaluados por cada operación vectorial
+    constexpr int WIDTH = 4;
+
+    /**
+     * @brief Parámetros del ruido fractal (suma de octavas de Perlin).
+     */
+    struct FractalParams {
+        int numOctaves = 5;
+        float baseFrequency = 1.0f / 48.0f; // ciclos por unidad de mundo en la primera octava
+        float lacunarity = 2.0f;            // multiplicador de frecuencia entre octavas
+        float gain = 0.5f;                  // multiplicador de amplitud entre octavas
+        uint32_t seed = 0;                  // desplaza cada octava a otra zona del ruido
+    };
+
+    /**
+     * @brief glm::perlin para WIDTH puntos.
+     *
+     * @param X Coordenadas x de los puntos.
+     * @param Y Coordenadas y de los puntos.
+     * @param out Ruido en [-1, 1] aproximadamente.
+     */
+    void perlin(const float* X, const float* Y, float* out);
+
+    /**
+     * @brief Ruido fractal normalizado para una fila de puntos equiespaciados.
+     *
+     * El punto i está en (originX + (firstIndex + i) * spacing, z); la coordenada se calcula
+     * a partir del índice global para que un punto valga lo mismo en cualquier fila parcial.
+     *
+     * @param params Octavas, frecuencia y semilla.
+     * @param originX Coordenada x del índice 0.
+     * @param spacing Distancia entre puntos.
+     * @param firstIndex Índice global del primer punto de la fila.
+     * @param count Puntos a evaluar.
+     * @param z Coordenada z de la fila.
+     * @param out Ruido en [-1, 1] aproximadamente, count valores.
+     */
+    void fractalRow(const FractalParams& params, float originX, float spacing, int firstIndex, int count, float z, float* out);
+}
+
+#endif // TERRAIN_NOISE_SIMD_H
@@ -0,0 +1,334 @@
+#include "Terrain.h"
+
+#include "TerrainGenerator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+Terrain::~Terrain() {
+    cleanup();
+}
+
+void Terrain::generate(const Settings& settings, uint32_t seed) {
+    _settings = settings;
+    _settings.patchResolution = std::clamp(_settings.patchResolution, 2, 64);
+    _settings.maxDepth = std::clamp(_settings.maxDepth, 0, 6);
+    _settings.detailThreshold = std::max(_settings.detailThreshold, 0.0f);
+
+    const int resolution = _settings.patchResolution;
+    _verticesPerChunk = (resolution + 1) * (resolution + 1) + 4 * (resolution + 1);
+    _indicesPerChunk = resolution * resolution * 6 + 4 * resolution * 6;
+    _trianglesPerChunk = _indicesPerChunk / 3;
+    // Siempre se puede dibujar al menos la raíz
+    _settings.triangleBudget = std::max(_settings.triangleBudget, static_cast<int>(_trianglesPerChunk));
+
+    // Heightfield con la resolución de las hojas del quadtree; la muestra ix del tile es la
+    // _firstSampleX + ix de la retícula global, compartida con los tiles vecinos
+    _samplesPerSide = resolution * (1 << _settings.maxDepth) + 1;
+    _sampleSpacing = 2.0f * _settings.halfSize / static_cast<float>(_samplesPerSide - 1);
+    _firstSampleX = _settings.tileX * (_samplesPerSide - 1);
+    _firstSampleZ = _settings.tileZ * (_samplesPerSide - 1);
+
+    // Una muestra extra por lado para que las normales del borde usen diferencias centradas,
+    // igual que las del tile vecino, y no se note la costura en la iluminación
+    const int apronSide = _samplesPerSide + 2;
+    std::vector<float> apron(static_cast<size_t>(apronSide) * apronSide);
+    TerrainGenerator::Settings generatorSettings;
+    generatorSettings.numThreads = _settings.generatorThreads;
+    TerrainGenerator(generatorSettings).generateHeightfield(seed, -_settings.halfSize, -_settings.halfSize, _sampleSpacing,
+                                                            _firstSampleX - 1, _firstSampleZ - 1, apronSide, apronSide,
+                                                            _settings.maxHeight, apron.data());
+    auto apronSample = [&](int ix, int iz) { return apron[static_cast<size_t>(iz + 1) * apronSide + ix + 1]; };
+
+    _heights.resize(static_cast<size_t>(_samplesPerSide) * _samplesPerSide);
+    _normals.resize(_heights.size());
+    for (int iz = 0; iz < _samplesPerSide; ++iz) {
+        for (int ix = 0; ix < _samplesPerSide; ++ix) {
+            const float dx = (apronSample(ix + 1, iz) - apronSample(ix - 1, iz)) / (2.0f * _sampleSpacing);
+            const float dz = (apronSample(ix, iz + 1) - apronSample(ix, iz - 1)) / (2.0f * _sampleSpacing);
+            _heights[static_cast<size_t>(iz) * _samplesPerSide + ix] = apronSample(ix, iz);
+            _normals[static_cast<size_t>(iz) * _samplesPerSide + ix] = glm::normalize(glm::vec3(-dx, 1.0f, -dz));
+        }
+    }
+
+    // Quadtree en anchura: los cuatro hijos de cada chunk quedan consecutivos
+    _chunks.clear();
+    _chunkCellX.clear();
+    _chunkCellZ.clear();
+    _chunks.push_back(_makeChunk(0, 0, 0));
+    _chunkCellX.push_back(0);
+    _chunkCellZ.push_back(0);
+    for (size_t i = 0; i < _chunks.size(); ++i) {
+        if (_chunks[i].depth == _settings.maxDepth) continue;
+
+        _chunks[i].firstChild = static_cast<GLint>(_chunks.size());
+        const int depth = _chunks[i].depth + 1;
+        const int cellX = _chunkCellX[i] * 2, cellZ = _chunkCellZ[i] * 2;
+        for (int dz = 0; dz < 2; ++dz) {
+            for (int dx = 0; dx < 2; ++dx) {
+                _chunks.push_back(_makeChunk(depth, cellX + dx, cellZ + dz));
+                _chunkCellX.push_back(cellX + dx);
+                _chunkCellZ.push_back(cellZ + dz);
+            }
+        }
+    }
+
+    // Mallas de todos los chunks; los índices son los mismos para todos y cada chunk se
+    // dibuja con su baseVertex
+    _vertices.clear();
+    _vertices.reserve(_chunks.size() * static_cast<size_t>(_verticesPerChunk));
+    for (size_t i = 0; i < _chunks.size(); ++i) {
+        _appendChunkVertices(_chunks[i], _chunkCellX[i], _chunkCellZ[i], _vertices);
+    }
+
+    _indices.clear();
+    _indices.reserve(static_cast<size_t>(_indicesPerChunk));
+    auto gridIndex = [resolution](int i, int j) { return static_cast<GLushort>(j * (resolution + 1) + i); };
+    for (int j = 0; j < resolution; ++j) {
+        for (int i = 0; i < resolution; ++i) {
+            const GLushort v00 = gridIndex(i, j), v10 = gridIndex(i + 1, j);
+            const GLushort v01 = gridIndex(i, j + 1), v11 = gridIndex(i + 1, j + 1);
+            _indices.insert(_indices.end(), { v00, v01, v10, v10, v01, v11 });
+        }
+    }
+    const GLushort firstSkirtVertex = static_cast<GLushort>((resolution + 1) * (resolution + 1));
+    for (int edge = 0; edge < 4; ++edge) {
+        for (int k = 0; k < resolution; ++k) {
+            auto edgeIndex = [&](int n) {
+                return edge == 0 ? gridIndex(n, 0)
+                     : edge == 1 ? gridIndex(resolution, n)
+                     : edge == 2 ? gridIndex(n, resolution)
+                     :             gridIndex(0, n);
+            };
+            const GLushort a = edgeIndex(k), b = edgeIndex(k + 1);
+            const GLushort skirtA = static_cast<GLushort>(firstSkirtVertex + edge * (resolution + 1) + k);
+            const GLushort skirtB = static_cast<GLushort>(skirtA + 1);
+            _indices.insert(_indices.end(), { a, b, skirtA, b, skirtB, skirtA });
+        }
+    }
+}
+
+Terrain::Chunk Terrain::_makeChunk(int depth, int cellX, int cellZ) const {
+    const int step = 1 << (_settings.maxDepth - depth);
+    const int samplesPerChunk = _settings.patchResolution * step;
+    const int ix0 = cellX * samplesPerChunk, iz0 = cellZ * samplesPerChunk;
+
+    float minHeight = _sample(ix0, iz0), maxHeight = minHeight;
+    for (int iz = iz0; iz <= iz0 + samplesPerChunk; iz += step) {
+        for (int ix = ix0; ix <= ix0 + samplesPerChunk; ix += step) {
+            minHeight = std::min(minHeight, _sample(ix, iz));
+            maxHeight = std::max(maxHeight, _sample(ix, iz));
+        }
+    }
+
+    Chunk chunk;
+    chunk.vertexSpacing = static_cast<float>(step) * _sampleSpacing;
+    // La falda baja una separación de vértices por debajo del punto más bajo del chunk
+    chunk.boundsMin = glm::vec3(_sampleCoordinate(_firstSampleX, ix0),
+                                minHeight - chunk.vertexSpacing,
+                                _sampleCoordinate(_firstSampleZ, iz0));
+    chunk.boundsMax = glm::vec3(_sampleCoordinate(_firstSampleX, ix0 + samplesPerChunk),
+                                maxHeight,
+                                _sampleCoordinate(_firstSampleZ, iz0 + samplesPerChunk));
+    chunk.depth = depth;
+    chunk.firstChild = -1;
+    return chunk;
+}
+
+void Terrain::_appendChunkVertices(const Chunk& chunk, int cellX, int cellZ, std::vector<Vertex>& vertices) const {
+    const int resolution = _settings.patchResolution;
+    const int step = 1 << (_settings.maxDepth - chunk.depth);
+    const int ix0 = cellX * resolution * step, iz0 = cellZ * resolution * step;
+
+    auto gridVertex = [&](int i, int j) {
+        const int ix = ix0 + i * step, iz = iz0 + j * step;
+        return Vertex{ glm::vec3(_sampleCoordinate(_firstSampleX, ix),
+                                 _sample(ix, iz),
+                                 _sampleCoordinate(_firstSampleZ, iz)),
+                       _sampleNormal(ix, iz) };
+    };
+
+    for (int j = 0; j <= resolution; ++j) {
+        for (int i = 0; i <= resolution; ++i) {
+            vertices.push_back(gridVertex(i, j));
+        }
+    }
+
+    // Faldas: copia de cada borde desplazada hacia abajo (z = 0, x = max, z = max, x = 0)
+    const float skirtDepth = chunk.vertexSpacing;
+    for (int edge = 0; edge < 4; ++edge) {
+        for (int k = 0; k <= resolution; ++k) {
+            Vertex vertex = edge == 0 ? gridVertex(k, 0)
+                          : edge == 1 ? gridVertex(resolution, k)
+                          : edge == 2 ? gridVertex(k, resolution)
+                          :             gridVertex(0, k);
+            vertex.position.y -= skirtDepth;
+            vertices.push_back(vertex);
+        }
+    }
+}
+
+void Terrain::setupBuffers(GLint positionLocation, GLint normalLocation) {
+    if (_vao != 0) return;
+
+    glGenVertexArrays(1, &_vao);
+    glBindVertexArray(_vao);
+
+    glGenBuffers(1, &_vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, _vbo);
+    glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(_vertices.size() * sizeof(Vertex)), _vertices.data(), GL_STATIC_DRAW);
+
+    glEnableVertexAttribArray(positionLocation);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)nullptr);
+    glEnableVertexAttribArray(normalLocation);
+    glVertexAttribPointer(normalLocation, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+
+    glGenBuffers(1, &_ibo);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, _ibo);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(_indices.size() * sizeof(GLushort)), _indices.data(), GL_STATIC_DRAW);
+
+    glBindVertexArray(0);
+}
+
+size_t Terrain::getMemoryUsage() const {
+    const size_t meshBytes = _vertices.size() * sizeof(Vertex) + _indices.size() * sizeof(GLushort);
+    return _heights.size() * sizeof(float) + _normals.size() * sizeof(glm::vec3)
+         + _chunks.size() * (sizeof(Chunk) + 2 * sizeof(int))
+         + 2 * meshBytes;   // copia de CPU y copia de GPU
+}
+
+void Terrain::cleanup() {
+    if (_vao != 0) {
+        glDeleteVertexArrays(1, &_vao);
+        glDeleteBuffers(1, &_vbo);
+        glDeleteBuffers(1, &_ibo);
+        _vao = _vbo = _ibo = 0;
+    }
+}
+
+float Terrain::getHeight(float x, float z) const {
+    if (_heights.empty()) return 0.0f;
+
+    const float maxCoordinate = static_cast<float>(_samplesPerSide - 1);
+    const float fx = std::clamp((x + _settings.halfSize) / _sampleSpacing - static_cast<float>(_firstSampleX), 0.0f, maxCoordinate);
+    const float fz = std::clamp((z + _settings.halfSize) / _sampleSpacing - static_cast<float>(_firstSampleZ), 0.0f, maxCoordinate);
+    const int ix = std::min(static_cast<int>(fx), _samplesPerSide - 2);
+    const int iz = std::min(static_cast<int>(fz), _samplesPerSide - 2);
+    const float tx = fx - static_cast<float>(ix), tz = fz - static_cast<float>(iz);
+
+    const float h0 = _sample(ix, iz) + (_sample(ix + 1, iz) - _sample(ix, iz)) * tx;
+    const float h1 = _sample(ix, iz + 1) + (_sample(ix + 1, iz + 1) - _sample(ix, iz + 1)) * tx;
+    return h0 + (h1 - h0) * tz;
+}
+
+glm::vec3 Terrain::getNormal(float x, float z) const {
+    if (_normals.empty()) return glm::vec3(0.0f, 1.0f, 0.0f);
+
+    const float maxCoordinate = static_cast<float>(_samplesPerSide - 1);
+    const float fx = std::clamp((x + _settings.halfSize) / _sampleSpacing - static_cast<float>(_firstSampleX), 0.0f, maxCoordinate);
+    const float fz = std::clamp((z + _settings.halfSize) / _sampleSpacing - static_cast<float>(_firstSampleZ), 0.0f, maxCoordinate);
+    const int ix = std::min(static_cast<int>(fx), _samplesPerSide - 2);
+    const int iz = std::min(static_cast<int>(fz), _samplesPerSide - 2);
+    const float tx = fx - static_cast<float>(ix), tz = fz - static_cast<float>(iz);
+
+    const glm::vec3 n0 = glm::mix(_sampleNormal(ix, iz), _sampleNormal(ix + 1, iz), tx);
+    const glm::vec3 n1 = glm::mix(_sampleNormal(ix, iz + 1), _sampleNormal(ix + 1, iz + 1), tx);
+    return glm::normalize(glm::mix(n0, n1, tz));
+}
+
+float Terrain::_chunkError(const Chunk& chunk, const glm::vec3& eye) const {
+    const glm::vec3 closestPoint = glm::clamp(eye, chunk.boundsMin, chunk.boundsMax);
+    const float distance = std::max(glm::distance(eye, closestPoint), 0.001f);
+    return chunk.vertexSpacing / distance;
+}
+
+bool Terrain::_isVisible(const Chunk& chunk, const glm::vec4 planes[][6], int numViews) {
+    for (int view = 0; view < numViews; ++view) {
+        bool inside = true;
+        for (int p = 0; p < 6 && inside; ++p) {
+            const glm::vec4& plane = planes[view][p];
+            // Vértice de la caja más adentro del plano
+            const glm::vec3 positive(plane.x >= 0.0f ? chunk.boundsMax.x : chunk.boundsMin.x,
+                                     plane.y >= 0.0f ? chunk.boundsMax.y : chunk.boundsMin.y,
+                                     plane.z >= 0.0f ? chunk.boundsMax.z : chunk.boundsMin.z);
+            inside = glm::dot(glm::vec3(plane), positive) + plane.w >= 0.0f;
+        }
+        if (inside) return true;
+    }
+    return false;
+}
+
+void Terrain::selectChunks(const glm::vec3& lodEye, const glm::mat4* viewProjectionMatrices, int numViews, Selection& selection,
+                           int triangleBudget) const {
+    selection.chunks.clear();
+    selection.numTriangles = 0;
+    selection._queue.clear();
+    if (_chunks.empty()) return;
+
+    // Planos del frustum de cada vista a partir de las filas de la matriz
+    numViews = std::clamp(numViews, 1, MAX_VIEWS);
+    glm::vec4 planes[MAX_VIEWS][6];
+    for (int view = 0; view < numViews; ++view) {
+        const glm::mat4& m = viewProjectionMatrices[view];
+        const glm::vec4 row0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        const glm::vec4 row1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        const glm::vec4 row2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        const glm::vec4 row3(m[0][3], m[1][3], m[2][3], m[3][3]);
+        planes[view][0] = row3 + row0;
+        planes[view][1] = row3 - row0;
+        planes[view][2] = row3 + row1;
+        planes[view][3] = row3 - row1;
+        planes[view][4] = row3 + row2;
+        planes[view][5] = row3 - row2;
+    }
+
+    if (!_isVisible(_chunks[0], planes, numViews)) return;
+    if (triangleBudget < 0) triangleBudget = _settings.triangleBudget;
+
+    // Montículo de máximos por error: se subdivide primero lo que más se nota
+    auto& queue = selection._queue;
+    queue.emplace_back(_chunkError(_chunks[0], lodEye), 0);
+    GLsizei numTriangles = _trianglesPerChunk;
+    while (!queue.empty()) {
+        std::pop_heap(queue.begin(), queue.end());
+        const auto [error, index] = queue.back();
+        queue.pop_back();
+
+        const Chunk& chunk = _chunks[index];
+        if (chunk.firstChild < 0 || error < _settings.detailThreshold) {
+            selection.chunks.push_back(index);
+            continue;
+        }
+
+        GLint visibleChildren[4];
+        int numVisibleChildren = 0;
+        for (GLint child = chunk.firstChild; child < chunk.firstChild + 4; ++child) {
+            if (_isVisible(_chunks[child], planes, numViews)) {
+                visibleChildren[numVisibleChildren++] = child;
+            }
+        }
+
+        const GLsizei trianglesAfterSplit = numTriangles + (numVisibleChildren - 1) * _trianglesPerChunk;
+        if (trianglesAfterSplit > triangleBudget) {
+            selection.chunks.push_back(index);
+            continue;
+        }
+
+        numTriangles = trianglesAfterSplit;
+        for (int i = 0; i < numVisibleChildren; ++i) {
+            queue.emplace_back(_chunkError(_chunks[visibleChildren[i]], lodEye), visibleChildren[i]);
+            std::push_heap(queue.begin(), queue.end());
+        }
+    }
+    selection.numTriangles = numTriangles;
+}
+
+void Terrain::bind() const {
+    glBindVertexArray(_vao);
+}
+
+void Terrain::drawChunk(GLint chunk, GLsizei instanceCount) const {
+    glDrawElementsInstancedBaseVertex(GL_TRIANGLES, _indicesPerChunk, GL_UNSIGNED_SHORT, (void*)nullptr,
+                                      instanceCount, chunk * _verticesPerChunk);
+}
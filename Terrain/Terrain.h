@@ -0,0 +1,208 @@
+#ifndef TERRAIN_TERRAIN_H
+#define TERRAIN_TERRAIN_H
+
+#include <glad/gl.h>
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @class Terrain
+ * @brief Tile de terreno de colinas generado a partir de un heightfield y dividido en un
+ * quadtree de chunks con varios niveles de detalle.
+ *
+ * Todos los chunks tienen la misma malla de patchResolution x patchResolution quads; un chunk
+ * de nivel d cubre 1/2^d del mapa por lado, así que los niveles más profundos tienen más
+ * detalle. Cada chunk lleva una falda (skirt) vertical en sus bordes que tapa las grietas
+ * entre vecinos de distinto nivel. Las mallas de todos los niveles se generan una sola vez y
+ * comparten un único buffer de índices; cada chunk se dibuja con su baseVertex.
+ *
+ * El heightfield lo calcula TerrainGenerator repartido entre varios hilos. Las muestras se
+ * indexan en una retícula global, así que los bordes de tiles vecinos coinciden exactamente.
+ *
+ * generate() y las consultas de altura y normal no usan GL, así que la simulación puede
+ * usarlas desde cualquier hilo una vez generado el tile; setupBuffers(), cleanup(),
+ * selectChunks() y drawChunk() pertenecen al hilo de render.
+ */
+class Terrain {
+public:
+    /**
+     * @brief Forma del mapa y límites del LOD; se fijan al generar.
+     */
+    struct Settings {
+        float halfSize = 52.5f;             // el tile cubre su centro ± halfSize en X y Z
+        int tileX = 0, tileZ = 0;           // el centro del tile está en (tileX, tileZ) * 2 * halfSize
+        float maxHeight = 10.0f;            // altura de las colinas más altas
+        int patchResolution = 16;           // quads por lado de cada chunk
+        int maxDepth = 3;                   // niveles del quadtree bajo la raíz
+        int triangleBudget = 40000;         // triángulos máximos seleccionados por frame en todos los tiles
+        float detailThreshold = 0.02f;      // separación de vértices / distancia a partir de la que se subdivide
+        int generatorThreads = 0;           // hilos que generan el heightfield; 0 = uno por núcleo
+    };
+
+    /**
+     * @brief Resultado de selectChunks(); se reutiliza entre frames para no reservar memoria.
+     */
+    struct Selection {
+        std::vector<GLint> chunks;          // chunks a dibujar
+        GLsizei numTriangles = 0;           // triángulos de todos los chunks seleccionados
+
+    private:
+        friend class Terrain;
+        std::vector<std::pair<float, GLint>> _queue;
+    };
+
+    Terrain() = default;
+    ~Terrain();
+
+    Terrain(const Terrain&) = delete;
+    Terrain& operator=(const Terrain&) = delete;
+
+    /**
+     * @brief Genera el heightfield, el quadtree de chunks con sus cajas envolventes y las
+     * mallas que después sube setupBuffers().
+     *
+     * @param settings Tamaño, altura y límites del LOD.
+     * @param seed Semilla del ruido; la misma semilla produce el mismo mapa.
+     */
+    void generate(const Settings& settings, uint32_t seed);
+
+    /**
+     * @brief Sube las mallas de todos los chunks a la GPU; las copias de CPU se conservan para
+     * poder volver a subirlas después de cleanup().
+     *
+     * @param positionLocation Ubicación del atributo de posición.
+     * @param normalLocation Ubicación del atributo de normal.
+     */
+    void setupBuffers(GLint positionLocation, GLint normalLocation);
+
+    /**
+     * @brief Libera el VAO y los buffers.
+     */
+    void cleanup();
+
+    /**
+     * @brief Altura del terreno en un punto, interpolada entre las muestras del heightfield.
+     */
+    float getHeight(float x, float z) const;
+
+    /**
+     * @brief Normal del terreno en un punto, interpolada entre las muestras del heightfield.
+     */
+    glm::vec3 getNormal(float x, float z) const;
+
+    /**
+     * @brief Elige los chunks a dibujar sin superar el presupuesto de triángulos.
+     *
+     * Parte de la raíz y subdivide primero los chunks con mayor error (separación de vértices
+     * sobre distancia al ojo) mientras el error supere detailThreshold y quede presupuesto.
+     * Un chunk se descarta si su caja envolvente queda fuera de todos los frustums.
+     *
+     * @param lodEye Posición desde la que se mide la distancia para el LOD.
+     * @param viewProjectionMatrices Matrices de vista-proyección de las vistas a cubrir.
+     * @param numViews Número de matrices.
+     * @param selection Resultado; su contenido anterior se descarta.
+     * @param triangleBudget Presupuesto para este tile; si es negativo se usa el de Settings.
+     * Siempre se permite al menos la raíz.
+     */
+    void selectChunks(const glm::vec3& lodEye, const glm::mat4* viewProjectionMatrices, int numViews, Selection& selection,
+                      int triangleBudget = -1) const;
+
+    /**
+     * @brief Enlaza el VAO del terreno; debe llamarse antes de drawChunk().
+     */
+    void bind() const;
+
+    /**
+     * @brief Dibuja un chunk con el programa que esté en uso.
+     *
+     * @param chunk Índice devuelto por selectChunks().
+     * @param instanceCount Instancias a dibujar (una por vista en la ruta multi-view).
+     */
+    void drawChunk(GLint chunk, GLsizei instanceCount = 1) const;
+
+    /**
+     * @brief El tile cubre getCenter() ± halfSize en X y Z.
+     */
+    float getHalfSize() const { return _settings.halfSize; }
+
+    /**
+     * @brief Centro del tile en el plano XZ.
+     */
+    glm::vec2 getCenter() const { return 2.0f * _settings.halfSize * glm::vec2(_settings.tileX, _settings.tileZ); }
+
+    /**
+     * @brief true si las mallas ya están en la GPU.
+     */
+    bool hasBuffers() const { return _vao != 0; }
+
+    /**
+     * @brief Bytes que ocupa el tile: datos de CPU más la copia de las mallas en la GPU.
+     */
+    size_t getMemoryUsage() const;
+
+    /**
+     * @brief Triángulos de un chunk, con su falda.
+     */
+    GLsizei getTrianglesPerChunk() const { return _trianglesPerChunk; }
+
+    /**
+     * @brief Número total de chunks en todos los niveles.
+     */
+    GLint getNumChunks() const { return static_cast<GLint>(_chunks.size()); }
+
+private:
+    struct Chunk {
+        glm::vec3 boundsMin;
+        glm::vec3 boundsMax;
+        float vertexSpacing;                // distancia entre vértices de la malla del chunk
+        int depth;
+        GLint firstChild;                   // -1 en las hojas; los cuatro hijos son consecutivos
+    };
+
+    struct Vertex {
+        glm::vec3 position;
+        glm::vec3 normal;
+    };
+
+    static constexpr int MAX_VIEWS = 4;
+
+    Chunk _makeChunk(int depth, int cellX, int cellZ) const;
+    void _appendChunkVertices(const Chunk& chunk, int cellX, int cellZ, std::vector<Vertex>& vertices) const;
+    float _chunkError(const Chunk& chunk, const glm::vec3& eye) const;
+    static bool _isVisible(const Chunk& chunk, const glm::vec4 planes[][6], int numViews);
+
+    // Coordenada de mundo de la muestra ix (o iz) del tile
+    float _sampleCoordinate(int firstSample, int index) const {
+        return -_settings.halfSize + static_cast<float>(firstSample + index) * _sampleSpacing;
+    }
+
+    float _sample(int ix, int iz) const { return _heights[static_cast<size_t>(iz) * _samplesPerSide + ix]; }
+    const glm::vec3& _sampleNormal(int ix, int iz) const { return _normals[static_cast<size_t>(iz) * _samplesPerSide + ix]; }
+
+    Settings _settings;
+    int _samplesPerSide = 0;                // muestras del heightfield por lado
+    float _sampleSpacing = 1.0f;            // distancia entre muestras
+    int _firstSampleX = 0, _firstSampleZ = 0;   // índice global de la primera muestra del tile
+    std::vector<float> _heights;
+    std::vector<glm::vec3> _normals;
+
+    std::vector<Chunk> _chunks;             // la raíz es el chunk 0
+    std::vector<int> _chunkCellX, _chunkCellZ;  // celda de cada chunk dentro de su nivel
+
+    std::vector<Vertex> _vertices;          // mallas de todos los chunks, en orden
+    std::vector<GLushort> _indices;         // compartidos por todos los chunks
+
+    GLsizei _verticesPerChunk = 0;
+    GLsizei _indicesPerChunk = 0;
+    GLsizei _trianglesPerChunk = 0;
+
+    GLuint _vao = 0;
+    GLuint _vbo = 0;
+    GLuint _ibo = 0;
+};
+
+#endif // TERRAIN_TERRAIN_H
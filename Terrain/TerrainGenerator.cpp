@@ -0,0 +1,131 @@
+#include "TerrainGenerator.h"
+
+#include "NoiseSIMD.h"
+#include "Terrain.h"
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <thread>
+
+namespace {
+    // Valor pseudoaleatorio en [0, 1) a partir de la semilla y dos índices
+    float hashUnit(uint32_t seed, uint32_t a, uint32_t b) {
+        uint32_t h = seed ^ (a * 374761393u) ^ (b * 668265263u);
+        h = (h ^ (h >> 13)) * 1274126177u;
+        h ^= h >> 16;
+        return static_cast<float>(h >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Candidatos evaluados para cada moneda y distancia de sus zombies
+    constexpr int COIN_CANDIDATES = 16;
+    constexpr float ZOMBIE_MIN_RADIUS = 4.0f;
+    constexpr float ZOMBIE_MAX_RADIUS = 7.0f;
+
+    // Sal que separa los números de las monedas de los del ruido con la misma semilla
+    constexpr uint32_t SPAWN_SALT = 0x5BD1E995u;
+}
+
+TerrainGenerator::TerrainGenerator(const Settings& settings) : _settings(settings) {
+    _settings.tileSize = std::max(_settings.tileSize, NoiseSIMD::WIDTH);
+    _numThreads = _settings.numThreads > 0 ? _settings.numThreads
+                                           : static_cast<int>(std::thread::hardware_concurrency());
+    _numThreads = std::clamp(_numThreads, 1, 64);
+}
+
+void TerrainGenerator::generateHeightfield(uint32_t seed, float originX, float originZ, float spacing, int firstSampleX, int firstSampleZ,
+                                           int samplesX, int samplesZ, float maxHeight, float* heights) const {
+    if (samplesX <= 0 || samplesZ <= 0) return;
+
+    NoiseSIMD::FractalParams params;
+    params.seed = seed;
+
+    const int tileSize = _settings.tileSize;
+    const int tilesX = (samplesX + tileSize - 1) / tileSize;
+    const int tilesZ = (samplesZ + tileSize - 1) / tileSize;
+    const int numTiles = tilesX * tilesZ;
+    std::atomic<int> nextTile{0};
+
+    auto worker = [&]() {
+        for (int tile = nextTile.fetch_add(1, std::memory_order_relaxed); tile < numTiles;
+             tile = nextTile.fetch_add(1, std::memory_order_relaxed)) {
+            const int x0 = (tile % tilesX) * tileSize, z0 = (tile / tilesX) * tileSize;
+            const int width = std::min(tileSize, samplesX - x0);
+            const int rows = std::min(tileSize, samplesZ - z0);
+
+            for (int iz = z0; iz < z0 + rows; ++iz) {
+                float* row = heights + static_cast<size_t>(iz) * samplesX + x0;
+                NoiseSIMD::fractalRow(params, originX, spacing, firstSampleX + x0, width,
+                                      originZ + static_cast<float>(firstSampleZ + iz) * spacing, row);
+                // El ruido se concentra en [-0.5, 0.5]; se estira un poco para tener valles planos y cimas
+                for (int i = 0; i < width; ++i) {
+                    row[i] = maxHeight * std::clamp(0.5f + 1.25f * row[i], 0.0f, 1.0f);
+                }
+            }
+        }
+    };
+
+    // El hilo que llama también trabaja; no se lanzan más hilos que tiles
+    const int numWorkers = std::min(_numThreads, numTiles) - 1;
+    std::vector<std::thread> threads;
+    threads.reserve(static_cast<size_t>(numWorkers));
+    for (int i = 0; i < numWorkers; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+TerrainGenerator::SpawnLayout TerrainGenerator::generateSpawns(const Terrain& terrain, uint32_t seed, int numCoins,
+                                                               int zombiesPerCoin, float margin) const {
+    SpawnLayout layout;
+    numCoins = std::max(numCoins, 0);
+    zombiesPerCoin = std::max(zombiesPerCoin, 0);
+    layout.coins.reserve(static_cast<size_t>(numCoins));
+    layout.zombies.reserve(static_cast<size_t>(numCoins) * zombiesPerCoin);
+    if (numCoins == 0) return layout;
+
+    const uint32_t spawnSeed = seed ^ SPAWN_SALT;
+    const float halfSize = terrain.getHalfSize();
+    const glm::vec2 center = terrain.getCenter();
+    const int cellsPerSide = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(numCoins))));
+    const float cellSize = 2.0f * halfSize / static_cast<float>(cellsPerSide);
+    const float usable = std::max(cellSize - 2.0f * margin, 0.0f);
+
+    for (int coin = 0; coin < numCoins; ++coin) {
+        const float cellX = center.x - halfSize + static_cast<float>(coin % cellsPerSide) * cellSize;
+        const float cellZ = center.y - halfSize + static_cast<float>(coin / cellsPerSide) * cellSize;
+        const float left = cellX + 0.5f * (cellSize - usable);
+        const float top = cellZ + 0.5f * (cellSize - usable);
+
+        // La moneda va a la cima más alta entre los candidatos de su celda
+        glm::vec2 best(left + 0.5f * usable, top + 0.5f * usable);
+        float bestHeight = terrain.getHeight(best.x, best.y);
+        for (int candidate = 0; candidate < COIN_CANDIDATES; ++candidate) {
+            const uint32_t key = static_cast<uint32_t>(coin * COIN_CANDIDATES + candidate);
+            const glm::vec2 position(left + usable * hashUnit(spawnSeed, key, 0),
+                                     top + usable * hashUnit(spawnSeed, key, 1));
+            const float height = terrain.getHeight(position.x, position.y);
+            if (height > bestHeight) {
+                best = position;
+                bestHeight = height;
+            }
+        }
+        layout.coins.push_back(best);
+
+        // Zombies repartidos alrededor de la moneda con ángulo y distancia variables
+        for (int zombie = 0; zombie < zombiesPerCoin; ++zombie) {
+            const uint32_t key = static_cast<uint32_t>(coin * zombiesPerCoin + zombie);
+            const float angle = glm::two_pi<float>() * (static_cast<float>(zombie) + hashUnit(spawnSeed ^ 0xA5A5A5A5u, key, 0))
+                              / static_cast<float>(zombiesPerCoin);
+            const float radius = ZOMBIE_MIN_RADIUS + (ZOMBIE_MAX_RADIUS - ZOMBIE_MIN_RADIUS) * hashUnit(spawnSeed ^ 0xA5A5A5A5u, key, 1);
+            const glm::vec2 position = best + radius * glm::vec2(std::cos(angle), std::sin(angle));
+            layout.zombies.push_back(glm::clamp(position, center - (halfSize - 1.0f), center + (halfSize - 1.0f)));
+        }
+    }
+    return layout;
+}
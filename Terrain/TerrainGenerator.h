@@ -0,0 +1,84 @@
+#ifndef TERRAIN_TERRAIN_GENERATOR_H
+#define TERRAIN_TERRAIN_GENERATOR_H
+
+#include <glm/glm.hpp>
+
+#include <cstdint>
+#include <vector>
+
+class Terrain;
+
+/**
+ * @class TerrainGenerator
+ * @brief Genera el heightfield del terreno y la distribución de monedas y zombies a partir
+ * de una semilla.
+ *
+ * El heightfield se divide en tiles cuadrados que varios hilos toman de una cola compartida;
+ * cada muestra se calcula solo a partir de su índice global con NoiseSIMD, así que el
+ * resultado es idéntico bit a bit con cualquier número de hilos o tamaño de tile.
+ */
+class TerrainGenerator {
+public:
+    /**
+     * @brief Reparto del trabajo entre hilos.
+     */
+    struct Settings {
+        int tileSize = 32;                  // muestras por lado de cada tile
+        int numThreads = 0;                 // hilos en total, incluido el que llama; 0 = uno por núcleo
+    };
+
+    /**
+     * @brief Posiciones en el plano XZ de los objetos del mapa; la altura la pone quien los coloca.
+     */
+    struct SpawnLayout {
+        std::vector<glm::vec2> coins;
+        std::vector<glm::vec2> zombies;     // zombiesPerCoin consecutivos alrededor de cada moneda
+    };
+
+    explicit TerrainGenerator(const Settings& settings);
+
+    /**
+     * @brief Rellena un heightfield de samplesX x samplesZ muestras, fila por fila.
+     *
+     * La muestra (i, j) está en (originX + (firstSampleX + i) * spacing, originZ + (firstSampleZ + j) * spacing):
+     * dos regiones con el mismo origen y separación dan valores idénticos donde se solapan.
+     *
+     * @param seed Semilla del ruido; la misma semilla produce el mismo mapa.
+     * @param originX Coordenada x de la columna global 0.
+     * @param originZ Coordenada z de la fila global 0.
+     * @param spacing Distancia entre muestras.
+     * @param firstSampleX Columna global de la primera muestra.
+     * @param firstSampleZ Fila global de la primera muestra.
+     * @param samplesX Muestras por fila.
+     * @param samplesZ Número de filas.
+     * @param maxHeight Altura de las colinas más altas.
+     * @param heights Destino, samplesX * samplesZ valores.
+     */
+    void generateHeightfield(uint32_t seed, float originX, float originZ, float spacing, int firstSampleX, int firstSampleZ,
+                             int samplesX, int samplesZ, float maxHeight, float* heights) const;
+
+    /**
+     * @brief Elige dónde aparecen las monedas y los zombies que las vigilan.
+     *
+     * El tile se divide en una celda por moneda; cada moneda va a la cima más alta entre
+     * varios candidatos de su celda y sus zombies la rodean a pocos metros.
+     *
+     * @param terrain Terreno ya generado, para medir alturas.
+     * @param seed Semilla; la misma semilla y el mismo terreno producen la misma distribución.
+     * @param numCoins Monedas a colocar.
+     * @param zombiesPerCoin Zombies alrededor de cada moneda.
+     * @param margin Distancia mínima de las monedas a los bordes de su celda.
+     */
+    SpawnLayout generateSpawns(const Terrain& terrain, uint32_t seed, int numCoins, int zombiesPerCoin, float margin) const;
+
+    /**
+     * @brief Hilos que usará generateHeightfield().
+     */
+    int getNumThreads() const { return _numThreads; }
+
+private:
+    Settings _settings;
+    int _numThreads = 1;
+};
+
+#endif // TERRAIN_TERRAIN_GENERATOR_H
@@ -0,0 +1,187 @@
+#include "StressScene.h"
+
+#include "../Coin.h"
+#include "../ECS/Components.h"
+#include "../Enemies/Zombie.h"
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+namespace {
+    // Valor pseudoaleatorio en [0, 1) a partir de la semilla y dos índices
+    float hashUnit(uint32_t seed, uint32_t a, uint32_t b) {
+        uint32_t h = seed ^ (a * 374761393u) ^ (b * 668265263u);
+        h = (h ^ (h >> 13)) * 1274126177u;
+        h ^= h >> 16;
+        return static_cast<float>(h >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Una sal por tipo de objeto: subir la cantidad de uno no mueve a los demás
+    constexpr uint32_t ZOMBIE_SALT = 0x2C1B3C6Du;
+    constexpr uint32_t COIN_SALT = 0x297A2D39u;
+    constexpr uint32_t LIGHT_SALT = 0x6A09E667u;
+    constexpr uint32_t MODEL_SALT = 0xBB67AE85u;
+
+    // Las monedas de la escena no pertenecen a ningún tile: collectCoins() no encuentra su tile
+    // y solo las destruye
+    constexpr int NO_TILE = std::numeric_limits<int>::min();
+
+    constexpr float LIGHT_HEIGHT = 3.0f;
+
+    // Punto uniforme dentro del disco de radio radius alrededor del origen
+    glm::vec2 diskPoint(uint32_t seed, uint32_t index, float radius) {
+        const float distance = radius * std::sqrt(hashUnit(seed, index, 0));
+        const float angle = glm::two_pi<float>() * hashUnit(seed, index, 1);
+        return distance * glm::vec2(std::cos(angle), std::sin(angle));
+    }
+}
+
+bool StressScene::loadConfig(const char* FILENAME, Settings& settings) {
+    FILE* file = fopen(FILENAME, "r");
+    if (file == nullptr) {
+        fprintf(stderr, "[ERROR]: Could not open stress scene config \"%s\"\n", FILENAME);
+        return false;
+    }
+
+    bool valid = true;
+    char line[512];
+    int lineNumber = 0;
+    while (fgets(line, sizeof(line), file) != nullptr) {
+        ++lineNumber;
+        char key[64], value[448];
+        if (sscanf(line, " %63s", key) != 1 || key[0] == '#') continue;
+        if (sscanf(line, " %63s %447[^\r\n]", key, value) != 2) {
+            fprintf(stderr, "[ERROR]: %s:%d: missing value for \"%s\"\n", FILENAME, lineNumber, key);
+            valid = false;
+            continue;
+        }
+
+        if (strcmp(key, "zombies") == 0) {
+            settings.numZombies = atoi(value);
+        } else if (strcmp(key, "coins") == 0) {
+            settings.numCoins = atoi(value);
+        } else if (strcmp(key, "lights") == 0) {
+            settings.numPointLights = atoi(value);
+        } else if (strcmp(key, "models") == 0) {
+            settings.numModels = atoi(value);
+        } else if (strcmp(key, "model") == 0) {
+            settings.modelFilename = value;
+        } else if (strcmp(key, "radius") == 0) {
+            settings.radius = static_cast<float>(atof(value));
+        } else if (strcmp(key, "seed") == 0) {
+            settings.seed = strtoll(value, nullptr, 10);
+        } else if (strcmp(key, "results") == 0) {
+            settings.resultsFilename = value;
+        } else {
+            fprintf(stderr, "[ERROR]: %s:%d: unknown key \"%s\"\n", FILENAME, lineNumber, key);
+            valid = false;
+        }
+    }
+    fclose(file);
+
+    settings.enabled = true;
+    return valid;
+}
+
+void StressScene::setSettings(const Settings& settings) {
+    _settings = settings;
+    _settings.numZombies = std::max(_settings.numZombies, 0);
+    _settings.numCoins = std::max(_settings.numCoins, 0);
+    _settings.numModels = std::max(_settings.numModels, 0);
+    _settings.radius = std::max(_settings.radius, 1.0f);
+    if (_settings.numPointLights > SceneLights::MAX_POINT_LIGHTS) {
+        fprintf(stderr, "[WARN]: Stress scene: %d point lights requested, the lighting shader holds %d\n",
+                _settings.numPointLights, SceneLights::MAX_POINT_LIGHTS);
+    }
+    _settings.numPointLights = std::clamp(_settings.numPointLights, 0, SceneLights::MAX_POINT_LIGHTS);
+}
+
+int StressScene::getNumPointLights() const {
+    return _settings.enabled ? _settings.numPointLights : 1;
+}
+
+size_t StressScene::getNumZombies() const {
+    return _settings.enabled ? static_cast<size_t>(_settings.numZombies) : 0;
+}
+
+void StressScene::populate(uint32_t seed, bool hasModel, WorldStreamer& world, ECS::Registry& registry, SceneLights& lights) {
+    if (!_settings.enabled) return;
+
+    // Cada tipo tiene su tabla; se reserva entera para no crecer mientras se llena
+    registry.reserve<Zombie, ECS::AgentSchedule>(static_cast<size_t>(_settings.numZombies));
+    registry.reserve<Coin, ECS::Transform, ECS::TileSlot>(static_cast<size_t>(_settings.numCoins));
+    _numModels = hasModel ? _settings.numModels : 0;
+    registry.reserve<ECS::ModelInstance, ECS::Transform>(static_cast<size_t>(_numModels));
+
+    for (int i = 0; i < _settings.numZombies; ++i) {
+        const glm::vec2 spawn = diskPoint(seed ^ ZOMBIE_SALT, static_cast<uint32_t>(i), _settings.radius);
+        Zombie zombie;
+        zombie.setPosition(glm::vec3(spawn.x, world.getHeight(spawn.x, spawn.y) + WorldStreamer::ZOMBIE_HEIGHT, spawn.y));
+        ECS::AgentSchedule schedule;
+        schedule.phase = static_cast<uint32_t>(i);
+        registry.create(std::move(zombie), schedule);
+    }
+
+    for (int i = 0; i < _settings.numCoins; ++i) {
+        const glm::vec2 spawn = diskPoint(seed ^ COIN_SALT, static_cast<uint32_t>(i), _settings.radius);
+        const glm::vec3 position(spawn.x, world.getHeight(spawn.x, spawn.y) + WorldStreamer::COIN_HEIGHT, spawn.y);
+        registry.create(Coin(), ECS::Transform{ position, 0.0f }, ECS::TileSlot{ NO_TILE, NO_TILE, i });
+    }
+
+    for (int i = 0; i < _numModels; ++i) {
+        const uint32_t key = static_cast<uint32_t>(i);
+        const glm::vec2 spawn = diskPoint(seed ^ MODEL_SALT, key, _settings.radius);
+        const float heading = glm::two_pi<float>() * hashUnit(seed ^ MODEL_SALT, key, 2);
+        const glm::vec3 color(0.4f + 0.6f * hashUnit(seed ^ MODEL_SALT, key, 3),
+                              0.4f + 0.6f * hashUnit(seed ^ MODEL_SALT, key, 4),
+                              0.4f + 0.6f * hashUnit(seed ^ MODEL_SALT, key, 5));
+        registry.create(ECS::ModelInstance{ color }, ECS::Transform{ glm::vec3(spawn.x, world.getHeight(spawn.x, spawn.y), spawn.y), heading });
+    }
+
+    // Misma atenuación que la luz puntual de la escena normal, con colores cálidos variados
+    lights.numPointLights = _settings.numPointLights;
+    for (int i = 0; i < lights.numPointLights; ++i) {
+        const uint32_t key = static_cast<uint32_t>(i);
+        const glm::vec2 spawn = diskPoint(seed ^ LIGHT_SALT, key, _settings.radius);
+        SceneLights::Point& point = lights.points[i];
+        point.position  = glm::vec3(spawn.x, world.getHeight(spawn.x, spawn.y) + LIGHT_HEIGHT, spawn.y);
+        point.color     = glm::vec3(0.9f, 0.5f + 0.4f * hashUnit(seed ^ LIGHT_SALT, key, 2), 0.2f + 0.4f * hashUnit(seed ^ LIGHT_SALT, key, 3));
+        point.constant  = 1.0f;
+        point.linear    = 0.7f;
+        point.quadratic = 0.1f;
+    }
+    lights.revision++;
+
+    fprintf(stdout, "[INFO]: Stress scene: %d zombies, %d coins, %d point lights and %d models within %.1f units of the origin, seed %u\n",
+            _settings.numZombies, _settings.numCoins, lights.numPointLights, _numModels, _settings.radius, seed);
+}
+
+void StressScene::appendResults(uint32_t seed, const FrameStats::Summary& frames, size_t peakHeapBytes) const {
+    if (!_settings.enabled || _settings.resultsFilename.empty()) return;
+
+    // El encabezado solo se escribe si el archivo es nuevo, así un barrido se acumula en un solo CSV
+    FILE* existing = fopen(_settings.resultsFilename.c_str(), "r");
+    const bool isNew = existing == nullptr;
+    if (existing != nullptr) fclose(existing);
+
+    FILE* file = fopen(_settings.resultsFilename.c_str(), "a");
+    if (file == nullptr) {
+        fprintf(stderr, "[ERROR]: Could not open stress scene results \"%s\"\n", _settings.resultsFilename.c_str());
+        return;
+    }
+    if (isNew) {
+        fprintf(file, "seed,zombies,coins,point_lights,models,frames,fps,simulation_ms,render_ms,frame_ms,frame_ms_p95,peak_heap_mb\n");
+    }
+    fprintf(file, "%u,%d,%d,%d,%d,%zu,%.2f,%.3f,%.3f,%.3f,%.3f,%.1f\n", seed, _settings.numZombies, _settings.numCoins,
+            _settings.numPointLights, _numModels, frames.framesPresented, frames.framesPerSecond,
+            frames.simulationMean * 1000.0, frames.renderMean * 1000.0, frames.frameIntervalMean * 1000.0,
+            frames.frameIntervalP95 * 1000.0, static_cast<double>(peakHeapBytes) / (1 << 20));
+    fclose(file);
+    fprintf(stdout, "[INFO]: Stress scene results appended to %s\n", _settings.resultsFilename.c_str());
+}
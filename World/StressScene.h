@@ -0,0 +1,91 @@
+#ifndef WORLD_STRESS_SCENE_H
+#define WORLD_STRESS_SCENE_H
+
+#include "../ECS/Registry.h"
+#include "../Render/FramePacket.h"
+#include "../Render/FrameStats.h"
+#include "WorldStreamer.h"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * @class StressScene
+ * @brief Escena de prueba de escala: una cantidad fija de zombies, monedas, luces puntuales y
+ * copias de un modelo cargado, repartidas alrededor del origen según la semilla.
+ *
+ * En este modo los tiles del mundo solo traen terreno; todas las entidades las crea
+ * populate() al iniciar y no se descargan con los tiles. La posición de cada objeto depende
+ * solo de la semilla y de su número, así que al subir una cantidad los primeros objetos no se
+ * mueven y dos ejecuciones con la misma configuración dibujan la misma escena.
+ *
+ * Al terminar, appendResults() agrega una fila a un CSV con la configuración, los tiempos del
+ * frame y el pico de memoria, para graficar el costo contra el tamaño de la escena.
+ */
+class StressScene {
+public:
+    /**
+     * @brief Cantidades, modelo y área de la escena.
+     */
+    struct Settings {
+        bool enabled = false;
+        int numZombies = 0;
+        int numCoins = 0;
+        int numPointLights = 1;             // hasta SceneLights::MAX_POINT_LIGHTS
+        int numModels = 0;
+        std::string modelFilename;          // OBJ, OFF, PLY o STL que lee CSCI441::ModelLoader
+        float radius = 50.0f;               // todo se reparte en un disco de este radio alrededor del origen
+        int64_t seed = -1;                  // semilla fijada en el archivo de configuración; -1 usa la de la sesión
+        std::string resultsFilename;        // CSV al que se agrega una fila por ejecución; vacío para no escribir
+    };
+
+    /**
+     * @brief Lee un archivo de configuración con una clave y su valor por línea.
+     *
+     * Claves: zombies, coins, lights, models, model, radius, seed y results. Las líneas vacías
+     * y las que empiezan con # se ignoran. Las claves presentes reemplazan las de settings y
+     * activan el modo.
+     *
+     * @return false si el archivo no se pudo abrir o tiene una línea inválida.
+     */
+    static bool loadConfig(const char* FILENAME, Settings& settings);
+
+    void setSettings(const Settings& settings);
+    const Settings& getSettings() const { return _settings; }
+    bool isEnabled() const { return _settings.enabled; }
+
+    /**
+     * @brief Luces puntuales que tendrá la escena; el shader se compila para esta cantidad.
+     */
+    int getNumPointLights() const;
+
+    /**
+     * @brief Crea los zombies, las monedas y las copias del modelo y reemplaza las luces
+     * puntuales de lights.
+     *
+     * Consulta la altura del terreno bajo cada objeto, así que los tiles que cubre el disco
+     * se generan aquí si todavía no están residentes.
+     *
+     * @param seed Semilla de la sesión.
+     * @param hasModel false si el modelo no se pudo cargar; entonces no se crean copias.
+     */
+    void populate(uint32_t seed, bool hasModel, WorldStreamer& world, ECS::Registry& registry, SceneLights& lights);
+
+    /**
+     * @brief Zombies que crea populate(), para reservar la evasión entre zombies.
+     */
+    size_t getNumZombies() const;
+
+    /**
+     * @brief Agrega una fila con la configuración y el resultado de la ejecución a resultsFilename.
+     *
+     * @param peakHeapBytes Pico de memoria viva del AllocationTracker; 0 si no estaba activo.
+     */
+    void appendResults(uint32_t seed, const FrameStats::Summary& frames, size_t peakHeapBytes) const;
+
+private:
+    Settings _settings;
+    int _numModels = 0;                     // copias creadas; 0 si el modelo no cargó
+};
+
+#endif // WORLD_STRESS_SCENE_H
@@ -0,0 +1,391 @@
+#include "WorldStreamer.h"
+
+#include "../Coin.h"
+#include "../ECS/Components.h"
+#include "../Enemies/Zombie.h"
+#include "../Memory/AllocationTracker.h"
+#include "../Terrain/TerrainGenerator.h"
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+    constexpr float COIN_MARGIN = 8.0f;     // distancia mínima de una moneda al borde de su tile
+
+    int chebyshevDistance(int x0, int z0, int x1, int z1) {
+        return std::max(std::abs(x1 - x0), std::abs(z1 - z0));
+    }
+}
+
+WorldStreamer::~WorldStreamer() {
+    stop();
+}
+
+void WorldStreamer::start(const Settings& settings, const Terrain::Settings& tileSettings, uint32_t seed, ECS::Registry& registry) {
+    stop();
+
+    _registry = &registry;
+    _settings = settings;
+    _settings.loadRadius = std::max(_settings.loadRadius, 0);
+    _settings.unloadRadius = std::max(_settings.unloadRadius, _settings.loadRadius);
+    _settings.numThreads = std::clamp(_settings.numThreads, 1, 16);
+    _settings.coinsPerTile = std::max(_settings.coinsPerTile, 0);
+    _settings.zombiesPerCoin = std::max(_settings.zombiesPerCoin, 0);
+    _tileSettings = tileSettings;
+    _seed = seed;
+    _tileSize = 2.0f * _tileSettings.halfSize;
+    _stopping = false;
+
+    // Todos los tiles ocupan lo mismo; el del origen fija cuántos caben en el presupuesto
+    std::unique_ptr<Tile> origin = _generateTile(0, 0, _tileSettings.generatorThreads);
+    _maxTiles = static_cast<int>(std::max<size_t>(_settings.memoryBudgetBytes / std::max<size_t>(origin->bytes, 1), 1));
+    const int ringTiles = (2 * _settings.loadRadius + 1) * (2 * _settings.loadRadius + 1);
+    fprintf(stdout, "[INFO]: World streaming: %.0f x %.0f tiles of %.1f MB, %d of %d ring tiles fit in %.1f MB, %d threads\n",
+            _tileSize, _tileSize, static_cast<double>(origin->bytes) / (1 << 20), std::min(_maxTiles, ringTiles), ringTiles,
+            static_cast<double>(_settings.memoryBudgetBytes) / (1 << 20), _settings.numThreads);
+    if (_maxTiles < ringTiles) {
+        fprintf(stderr, "[WARN]: World streaming budget only holds the %d nearest tiles of the load ring\n", _maxTiles);
+    }
+
+    // Lugar para las entidades de todos los tiles que pueden estar cargados a la vez: cargar
+    // y descargar tiles reutiliza esas filas sin reservar memoria
+    const size_t residentTiles = static_cast<size_t>(std::min(_maxTiles, (2 * _settings.unloadRadius + 1) * (2 * _settings.unloadRadius + 1)));
+    const size_t coinsPerTile = static_cast<size_t>(_settings.coinsPerTile);
+    _registry->reserve<Coin, ECS::Transform, ECS::TileSlot>(residentTiles * coinsPerTile);
+    _maxZombies = residentTiles * coinsPerTile * static_cast<size_t>(_settings.zombiesPerCoin);
+    _registry->reserve<Zombie, ECS::AgentSchedule>(_maxZombies);
+    _addTile(std::move(origin));
+
+    if (_settings.asynchronous) {
+        for (int i = 0; i < _settings.numThreads; ++i) {
+            _workers.emplace_back(&WorldStreamer::_workerMain, this);
+        }
+    }
+}
+
+void WorldStreamer::stop() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+        _requests.clear();
+    }
+    _workAvailable.notify_all();
+    for (std::thread& worker : _workers) {
+        worker.join();
+    }
+    _workers.clear();
+
+    _completed.clear();
+    _inFlight.clear();
+    for (std::unique_ptr<Tile>& tile : _tiles) {
+        _destroyEntities(*tile);
+    }
+    _tiles.clear();
+    _desired.clear();
+}
+
+void WorldStreamer::update(const glm::vec3& playerPosition) {
+    const glm::ivec2 center = _tileAt(playerPosition.x, playerPosition.z);
+    const glm::vec2 player(playerPosition.x, playerPosition.z);
+
+    // Anillo de carga, del más cercano al más lejano, recortado al presupuesto
+    _desired.clear();
+    for (int z = center.y - _settings.loadRadius; z <= center.y + _settings.loadRadius; ++z) {
+        for (int x = center.x - _settings.loadRadius; x <= center.x + _settings.loadRadius; ++x) {
+            _desired.push_back({ x, z, glm::distance(_tileCenter(x, z), player) });
+        }
+    }
+    std::sort(_desired.begin(), _desired.end(), [](const Request& a, const Request& b) { return a.distance < b.distance; });
+    if (static_cast<int>(_desired.size()) > _maxTiles) {
+        _desired.resize(static_cast<size_t>(_maxTiles));
+    }
+    auto isDesired = [this](int x, int z) {
+        return std::any_of(_desired.begin(), _desired.end(), [&](const Request& r) { return r.x == x && r.z == z; });
+    };
+
+    // Tiles terminados por los hilos de fondo
+    {
+        const AllocationTracker::Tag loadTag("WorldStreamer tile loads", true);
+        std::vector<std::unique_ptr<Tile>> completed;
+        {
+            // Un tile sigue en _inFlight hasta que se consume aquí: si un hilo lo termina después
+            // de este intercambio, la cola de abajo tampoco lo vuelve a pedir
+            std::lock_guard<std::mutex> lock(_mutex);
+            completed.swap(_completed);
+            for (const std::unique_ptr<Tile>& tile : completed) {
+                _inFlight.erase(_key(tile->x, tile->z));
+            }
+        }
+        for (std::unique_ptr<Tile>& tile : completed) {
+            if (_findTile(tile->x, tile->z) != nullptr || !isDesired(tile->x, tile->z)) {
+                // Ya se generó al alcanzarlo el jugador, el jugador se alejó mientras se generaba
+                // o ya no cabe en el presupuesto: incorporarlo solo crearía entidades para destruirlas
+                ++_discardedLoads;
+                continue;
+            }
+            _addTile(std::move(tile));
+        }
+    }
+
+    for (std::unique_ptr<Tile>& tile : _tiles) {
+        tile->distance = glm::distance(_tileCenter(tile->x, tile->z), player);
+    }
+    std::sort(_tiles.begin(), _tiles.end(), [](const std::unique_ptr<Tile>& a, const std::unique_ptr<Tile>& b) { return a->distance < b->distance; });
+
+    // Los tiles del anillo tienen su lugar reservado; con el espacio que sobra se conservan los
+    // más cercanos de los demás mientras no pasen de unloadRadius
+    int spareSlots = _maxTiles - static_cast<int>(_desired.size());
+    auto keep = [&](const Tile& tile) {
+        if (isDesired(tile.x, tile.z)) return true;
+        if (chebyshevDistance(center.x, center.y, tile.x, tile.z) > _settings.unloadRadius || spareSlots <= 0) return false;
+        --spareSlots;
+        return true;
+    };
+    // Partición estable a mano: std::stable_partition pide un buffer al heap en cada llamada
+    size_t numKept = 0;
+    for (size_t i = 0; i < _tiles.size(); ++i) {
+        if (keep(*_tiles[i])) {
+            if (numKept != i) _tiles[numKept] = std::move(_tiles[i]);
+            ++numKept;
+        } else {
+            _destroyEntities(*_tiles[i]);
+            ++_tilesUnloaded;
+        }
+    }
+    _tiles.erase(_tiles.begin() + static_cast<std::ptrdiff_t>(numKept), _tiles.end());
+
+    if (!_settings.asynchronous) {
+        // Lo que falta del anillo se genera aquí, del más cercano al más lejano: las entidades
+        // aparecen siempre en el mismo tick
+        const AllocationTracker::Tag loadTag("WorldStreamer tile loads", true);
+        for (const Request& request : _desired) {
+            if (_findTile(request.x, request.z) != nullptr) continue;
+            _addTile(_generateTile(request.x, request.z, _tileSettings.generatorThreads));
+            _tiles.back()->distance = request.distance;
+        }
+        return;
+    }
+
+    // Cola de peticiones: lo que falta del anillo, con el más cercano al final
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _requests.clear();
+        for (auto it = _desired.rbegin(); it != _desired.rend(); ++it) {
+            if (_findTile(it->x, it->z) == nullptr && _inFlight.count(_key(it->x, it->z)) == 0) {
+                _requests.push_back(*it);
+            }
+        }
+    }
+    _workAvailable.notify_all();
+}
+
+float WorldStreamer::getHeight(float x, float z) {
+    const glm::ivec2 tileCoordinates = _tileAt(x, z);
+    const Tile* tile = _findTile(tileCoordinates.x, tileCoordinates.y);
+    if (tile == nullptr) {
+        // El jugador llegó antes que los hilos de fondo: se genera aquí, con todos los núcleos
+        ++_blockingLoads;
+        const AllocationTracker::Tag loadTag("WorldStreamer blocking loads", true);
+        if (static_cast<int>(_tiles.size()) >= _maxTiles) {
+            // Presupuesto lleno: sale el tile más lejano al punto consultado
+            const glm::vec2 point(x, z);
+            auto farthest = std::max_element(_tiles.begin(), _tiles.end(), [&](const std::unique_ptr<Tile>& a, const std::unique_ptr<Tile>& b) {
+                return glm::distance(_tileCenter(a->x, a->z), point) < glm::distance(_tileCenter(b->x, b->z), point);
+            });
+            _destroyEntities(**farthest);
+            _tiles.erase(farthest);
+            ++_tilesUnloaded;
+        }
+        _addTile(_generateTile(tileCoordinates.x, tileCoordinates.y, _tileSettings.generatorThreads));
+        tile = _tiles.back().get();
+    }
+    return tile->terrain->getHeight(x, z);
+}
+
+int WorldStreamer::collectCoins(const glm::vec3& position, float radius, FrameArena& frameArena) {
+    FrameVector<ECS::Entity> collectedEntities{ ArenaAllocator<ECS::Entity>(frameArena) };
+    _registry->each<Coin, ECS::Transform, ECS::TileSlot>(
+        [&](ECS::Entity entity, const Coin&, const ECS::Transform& transform, const ECS::TileSlot& tileSlot) {
+            if (glm::distance(transform.position, position) < radius) {
+                const AllocationTracker::Tag pickupTag("WorldStreamer coin pickups", true);
+                _collectedCoins.insert({ tileSlot.tileX, tileSlot.tileZ, tileSlot.slot });
+                collectedEntities.push_back(entity);
+            }
+        });
+
+    // Fuera del recorrido: destruir mueve filas de la tabla. El tile ya no es dueño de la moneda
+    for (const ECS::Entity entity : collectedEntities) {
+        const ECS::TileSlot& tileSlot = *_registry->get<ECS::TileSlot>(entity);
+        if (Tile* tile = _findTile(tileSlot.tileX, tileSlot.tileZ)) {
+            tile->entities.erase(std::remove(tile->entities.begin(), tile->entities.end(), entity), tile->entities.end());
+        }
+        _registry->destroy(entity);
+    }
+    return static_cast<int>(collectedEntities.size());
+}
+
+void WorldStreamer::updateProps(float deltaTime, const FlowField& flowField, CrowdAvoidance& crowd, AgentUpdateScheduler& scheduler) {
+    // Grupo de cada zombie según la cámara; los intervalos dependen de cuántos hay en cada uno
+    _registry->each<Zombie, ECS::AgentSchedule>([&](const Zombie& zombie, ECS::AgentSchedule& schedule) {
+        schedule.group = static_cast<uint8_t>(scheduler.classify(zombie.getPosition()));
+    });
+    scheduler.planTick();
+
+    // Todos los zombies residentes se resuelven juntos: los de tiles vecinos también se evitan.
+    // Los que no tienen turno entran sin paso de tiempo, solo como vecinos. Los tres recorridos
+    // visitan los zombies en el mismo orden, así que el agente i es el i-ésimo zombie
+    crowd.clear();
+    _registry->each<Zombie, ECS::AgentSchedule>([&](const Zombie& zombie, ECS::AgentSchedule& schedule) {
+        schedule.timeStep = 0.0f;
+        scheduler.shouldUpdate(static_cast<AgentUpdateScheduler::Group>(schedule.group), schedule.phase, deltaTime,
+                               schedule.pendingTime, schedule.timeStep);
+
+        const glm::vec3 position = zombie.getPosition();
+        crowd.addAgent(glm::vec2(position.x, position.z), zombie.getVelocity(),
+                       schedule.timeStep > 0.0f ? flowField.sample(position.x, position.z) * Zombie::WALK_SPEED : glm::vec2(0.0f),
+                       schedule.timeStep);
+    });
+    crowd.solve();
+
+    size_t agent = 0;
+    _registry->each<Zombie, ECS::AgentSchedule>([&](Zombie& zombie, const ECS::AgentSchedule& schedule) {
+        const glm::vec2 velocity = crowd.getVelocity(agent++);
+        if (schedule.timeStep <= 0.0f) return;
+        zombie.update(schedule.timeStep, velocity);
+
+        // Sigue el suelo solo sobre tiles residentes; nunca genera uno para un zombie
+        glm::vec3 position = zombie.getPosition();
+        const glm::ivec2 tileCoordinates = _tileAt(position.x, position.z);
+        const Tile* ground = _findTile(tileCoordinates.x, tileCoordinates.y);
+        if (ground != nullptr) {
+            position.y = ground->terrain->getHeight(position.x, position.z) + ZOMBIE_HEIGHT;
+            zombie.setPosition(position);
+        }
+    });
+}
+
+void WorldStreamer::getTerrainTiles(std::vector<std::shared_ptr<Terrain>>& terrainTiles) const {
+    terrainTiles.clear();
+    terrainTiles.reserve(static_cast<size_t>(_maxTiles));
+    for (const std::unique_ptr<Tile>& tile : _tiles) {
+        terrainTiles.push_back(tile->terrain);
+    }
+}
+
+void WorldStreamer::printReport() const {
+    fprintf(stdout, "[INFO]: World streaming: %llu tiles loaded, %llu unloaded, %llu discarded, %llu generated on demand, peak %.1f MB\n",
+            static_cast<unsigned long long>(_tilesLoaded), static_cast<unsigned long long>(_tilesUnloaded),
+            static_cast<unsigned long long>(_discardedLoads), static_cast<unsigned long long>(_blockingLoads),
+            static_cast<double>(_peakBytes) / (1 << 20));
+}
+
+std::unique_ptr<WorldStreamer::Tile> WorldStreamer::_generateTile(int x, int z, int generatorThreads) const {
+    std::unique_ptr<Tile> tile(new Tile());
+    tile->x = x;
+    tile->z = z;
+    tile->distance = 0.0f;
+
+    Terrain::Settings terrainSettings = _tileSettings;
+    terrainSettings.tileX = x;
+    terrainSettings.tileZ = z;
+    terrainSettings.generatorThreads = generatorThreads;
+    tile->terrain = std::make_shared<Terrain>();
+    tile->terrain->generate(terrainSettings, _seed);
+
+    // Cada tile tiene su propia semilla para los objetos; el terreno usa la del mundo para
+    // que los bordes coincidan
+    const uint32_t tileSeed = _seed ^ (static_cast<uint32_t>(x) * 0x8DA6B343u) ^ (static_cast<uint32_t>(z) * 0xD8163841u);
+    TerrainGenerator::Settings generatorSettings;
+    generatorSettings.numThreads = 1;
+    const TerrainGenerator::SpawnLayout spawns =
+        TerrainGenerator(generatorSettings).generateSpawns(*tile->terrain, tileSeed, _settings.coinsPerTile, _settings.zombiesPerCoin, COIN_MARGIN);
+
+    for (const glm::vec2& spawn : spawns.coins) {
+        tile->coinSpawns.emplace_back(spawn.x, tile->terrain->getHeight(spawn.x, spawn.y) + COIN_HEIGHT, spawn.y);
+    }
+    for (const glm::vec2& spawn : spawns.zombies) {
+        tile->zombieSpawns.emplace_back(spawn.x, tile->terrain->getHeight(spawn.x, spawn.y) + ZOMBIE_HEIGHT, spawn.y);
+    }
+
+    // Las entidades que creará _addTile() cuentan para el presupuesto desde ahora
+    tile->bytes = sizeof(Tile) + tile->terrain->getMemoryUsage()
+                + tile->coinSpawns.size() * (sizeof(glm::vec3) + sizeof(ECS::Entity) + sizeof(Coin) + sizeof(ECS::Transform) + sizeof(ECS::TileSlot))
+                + tile->zombieSpawns.size() * (sizeof(glm::vec3) + sizeof(ECS::Entity) + sizeof(Zombie) + sizeof(ECS::AgentSchedule));
+    return tile;
+}
+
+void WorldStreamer::_addTile(std::unique_ptr<Tile> tile) {
+    // Las monedas recogidas no vuelven a aparecer
+    tile->entities.reserve(tile->coinSpawns.size() + tile->zombieSpawns.size());
+    for (size_t i = 0; i < tile->coinSpawns.size(); ++i) {
+        if (_collectedCoins.count({ tile->x, tile->z, static_cast<int>(i) }) != 0) continue;
+        tile->entities.push_back(_registry->create(Coin(), ECS::Transform{ tile->coinSpawns[i], 0.0f },
+                                                   ECS::TileSlot{ tile->x, tile->z, static_cast<int>(i) }));
+    }
+    for (size_t i = 0; i < tile->zombieSpawns.size(); ++i) {
+        Zombie zombie;
+        zombie.setPosition(tile->zombieSpawns[i]);
+        // La fase solo depende del tile y del zombie, así que sobrevive a las recargas
+        ECS::AgentSchedule schedule;
+        schedule.phase = static_cast<uint32_t>(i) + static_cast<uint32_t>(tile->x) * 7919u + static_cast<uint32_t>(tile->z) * 104729u;
+        tile->entities.push_back(_registry->create(std::move(zombie), schedule));
+    }
+
+    // Queda al final hasta el próximo update(), que vuelve a ordenar por distancia
+    _tiles.push_back(std::move(tile));
+    ++_tilesLoaded;
+    _peakBytes = std::max(_peakBytes, _residentBytes());
+}
+
+void WorldStreamer::_destroyEntities(Tile& tile) {
+    for (const ECS::Entity entity : tile.entities) {
+        _registry->destroy(entity);
+    }
+    tile.entities.clear();
+}
+
+WorldStreamer::Tile* WorldStreamer::_findTile(int x, int z) {
+    for (std::unique_ptr<Tile>& tile : _tiles) {
+        if (tile->x == x && tile->z == z) return tile.get();
+    }
+    return nullptr;
+}
+
+glm::ivec2 WorldStreamer::_tileAt(float x, float z) const {
+    // El tile (i, j) cubre su centro (i, j) * _tileSize ± _tileSize / 2
+    return glm::ivec2(static_cast<int>(std::floor(x / _tileSize + 0.5f)),
+                      static_cast<int>(std::floor(z / _tileSize + 0.5f)));
+}
+
+size_t WorldStreamer::_residentBytes() const {
+    size_t bytes = 0;
+    for (const std::unique_ptr<Tile>& tile : _tiles) {
+        bytes += tile->bytes;
+    }
+    return bytes;
+}
+
+void WorldStreamer::_workerMain() {
+    for (;;) {
+        Request request;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _workAvailable.wait(lock, [this] { return _stopping || !_requests.empty(); });
+            if (_stopping) return;
+            request = _requests.back();
+            _requests.pop_back();
+            _inFlight.insert(_key(request.x, request.z));
+        }
+
+        // Los tiles de fondo usan un solo hilo cada uno; el paralelismo está entre tiles
+        std::unique_ptr<Tile> tile = _generateTile(request.x, request.z, 1);
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _completed.push_back(std::move(tile));
+        }
+    }
+}
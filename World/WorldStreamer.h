@@ -0,0 +1,193 @@
+#ifndef WORLD_WORLD_STREAMER_H
+#define WORLD_WORLD_STREAMER_H
+
+#include "../ECS/Registry.h"
+#include "../Enemies/AgentUpdateScheduler.h"
+#include "../Enemies/CrowdAvoidance.h"
+#include "../Enemies/FlowField.h"
+#include "../Memory/FrameArena.h"
+#include "../Terrain/Terrain.h"
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @class WorldStreamer
+ * @brief Mundo abierto dividido en tiles de terreno que se cargan y descargan en anillos
+ * alrededor del jugador.
+ *
+ * Los tiles a menos de loadRadius se piden a una cola ordenada por distancia que atienden
+ * hilos de fondo; cada tile trae su terreno y dónde aparecen sus monedas y sus zombies, que se
+ * crean como entidades del registro al incorporar el tile y se destruyen con él. Los que quedan más
+ * allá de unloadRadius se descartan y nunca hay más tiles residentes de los que caben en
+ * memoryBudgetBytes, así que la memoria no depende del tamaño del mapa.
+ *
+ * Todo lo público se llama desde el hilo de simulación. El tile donde está el jugador siempre
+ * está disponible: si todavía no se cargó, getHeight() lo genera en el momento. Cada tile solo
+ * depende de la semilla y de su posición, pero el tick en que se incorpora depende de cuándo
+ * terminen los hilos de fondo, y con él cuándo aparecen sus entidades. Para grabar y reproducir
+ * se desactiva asynchronous y el anillo completo se genera en update().
+ */
+class WorldStreamer {
+public:
+    /**
+     * @brief Radios de carga, presupuesto de memoria e hilos.
+     */
+    struct Settings {
+        int loadRadius = 2;                     // tiles pedidos en cada dirección alrededor del jugador
+        int unloadRadius = 3;                   // los tiles a mayor distancia se descartan
+        size_t memoryBudgetBytes = 64u << 20;   // memoria máxima de los tiles residentes (CPU + GPU)
+        int numThreads = 2;                     // hilos de fondo que generan tiles
+        int coinsPerTile = 1;
+        int zombiesPerCoin = 2;
+        bool asynchronous = true;               // false: el anillo se genera en update(), para reproducir grabaciones igual
+    };
+
+    // Alturas sobre el suelo
+    static constexpr float COIN_HEIGHT = 1.2f;
+    static constexpr float ZOMBIE_HEIGHT = 1.5f;
+
+    WorldStreamer() = default;
+    ~WorldStreamer();
+
+    WorldStreamer(const WorldStreamer&) = delete;
+    WorldStreamer& operator=(const WorldStreamer&) = delete;
+
+    /**
+     * @brief Genera el tile del origen y lanza los hilos de fondo si settings.asynchronous.
+     *
+     * @param settings Radios, presupuesto, hilos y objetos por tile.
+     * @param tileSettings Forma de cada tile; tileX y tileZ se ignoran.
+     * @param seed Semilla del mundo.
+     * @param registry Donde viven las monedas y los zombies; debe sobrevivir a stop().
+     */
+    void start(const Settings& settings, const Terrain::Settings& tileSettings, uint32_t seed, ECS::Registry& registry);
+
+    /**
+     * @brief Detiene los hilos de fondo y descarta todos los tiles con sus entidades.
+     */
+    void stop();
+
+    /**
+     * @brief Incorpora los tiles terminados, descarta los lejanos y vuelve a ordenar la cola
+     * de peticiones según la nueva posición del jugador. No bloquea, salvo sin asynchronous,
+     * donde genera aquí los tiles que faltan del anillo.
+     */
+    void update(const glm::vec3& playerPosition);
+
+    /**
+     * @brief Altura del terreno; genera el tile en el momento si no está residente.
+     *
+     * Si el presupuesto ya está lleno, antes descarta el tile más lejano al punto consultado.
+     */
+    float getHeight(float x, float z);
+
+    /**
+     * @brief Recoge las monedas a menos de radius de position.
+     *
+     * Las monedas recogidas no reaparecen aunque su tile se descargue y se vuelva a cargar.
+     *
+     * @param frameArena Memoria del frame para la lista de monedas recogidas.
+     * @return Número de monedas recogidas.
+     */
+    int collectCoins(const glm::vec3& position, float radius, FrameArena& frameArena);
+
+    /**
+     * @brief Mueve los zombies de los tiles residentes siguiendo el campo de direcciones.
+     *
+     * @param crowd Separa a los zombies entre sí; con crowd desactivado cada uno sigue el
+     * campo sin mirar a los demás.
+     * @param scheduler Decide qué zombies se actualizan en este tick; beginTick() ya debe
+     * haberse llamado con la cámara activa.
+     */
+    void updateProps(float deltaTime, const FlowField& flowField, CrowdAvoidance& crowd, AgentUpdateScheduler& scheduler);
+
+    /**
+     * @brief Terrenos de los tiles residentes, del más cercano al jugador al más lejano.
+     */
+    void getTerrainTiles(std::vector<std::shared_ptr<Terrain>>& terrainTiles) const;
+
+    /**
+     * @brief Cuántos zombies puede haber a la vez con los tiles que caben en el presupuesto.
+     */
+    size_t getMaxZombies() const { return _maxZombies; }
+
+    /**
+     * @brief Lado del cuadrado que cubren los tiles residentes hasta unloadRadius.
+     */
+    float getResidentExtent() const { return static_cast<float>(2 * _settings.unloadRadius + 1) * _tileSize; }
+
+    /**
+     * @brief Imprime cuántos tiles se cargaron y descargaron y el pico de memoria.
+     */
+    void printReport() const;
+
+private:
+    struct Tile {
+        int x, z;
+        std::shared_ptr<Terrain> terrain;   // lo comparte con los paquetes del hilo de render
+        std::vector<glm::vec3> coinSpawns;
+        std::vector<glm::vec3> zombieSpawns;
+        std::vector<ECS::Entity> entities;  // creadas al incorporar el tile
+        size_t bytes;
+        float distance;                     // del centro del tile al jugador en el último update()
+    };
+
+    struct Request {
+        int x, z;
+        float distance;
+    };
+
+    static int64_t _key(int x, int z) { return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(z); }
+
+    std::unique_ptr<Tile> _generateTile(int x, int z, int generatorThreads) const;
+    void _addTile(std::unique_ptr<Tile> tile);
+    void _destroyEntities(Tile& tile);
+    Tile* _findTile(int x, int z);
+    glm::ivec2 _tileAt(float x, float z) const;
+    glm::vec2 _tileCenter(int x, int z) const { return _tileSize * glm::vec2(x, z); }
+    size_t _residentBytes() const;
+    void _workerMain();
+
+    Settings _settings;
+    Terrain::Settings _tileSettings;
+    uint32_t _seed = 0;
+    float _tileSize = 1.0f;
+    int _maxTiles = 1;                      // tiles que caben en el presupuesto
+    size_t _maxZombies = 0;                 // zombies de todos los tiles residentes a la vez
+    ECS::Registry* _registry = nullptr;
+
+    // Solo el hilo de simulación
+    std::vector<std::unique_ptr<Tile>> _tiles;          // residentes, del más cercano al más lejano
+    std::vector<Request> _desired;                      // anillo de carga, del más cercano al más lejano
+    std::set<std::array<int, 3>> _collectedCoins;       // (tile x, tile z, moneda)
+
+    // Compartido con los hilos de fondo
+    std::mutex _mutex;
+    std::condition_variable _workAvailable;
+    std::vector<Request> _requests;                     // el más cercano al final
+    std::unordered_set<int64_t> _inFlight;             // tomados por un hilo y todavía sin consumir en update()
+    std::vector<std::unique_ptr<Tile>> _completed;
+    bool _stopping = false;
+
+    std::vector<std::thread> _workers;
+
+    // Estadísticas
+    uint64_t _tilesLoaded = 0;
+    uint64_t _tilesUnloaded = 0;
+    uint64_t _blockingLoads = 0;            // tiles que el jugador alcanzó antes que los hilos de fondo
+    uint64_t _discardedLoads = 0;           // tiles que llegaron cuando ya no se necesitaban
+    size_t _peakBytes = 0;
+};
+
+#endif // WORLD_WORLD_STREAMER_H
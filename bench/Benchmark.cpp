@@ -0,0 +1,144 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    struct Entry {
+        const char* name;
+        Bench::Function function;
+        double itemsPerOp;
+    };
+
+    // se construye en el primer uso para no depender del orden de inicialización estática
+    std::vector<Entry>& registry() {
+        static std::vector<Entry> entries;
+        return entries;
+    }
+
+    // Contadores y presupuestos excedidos del benchmark que se está ejecutando
+    std::vector<std::pair<std::string, double>> currentCounters;
+    std::vector<std::string> currentFailures;
+    bool failed = false;
+
+    constexpr double MIN_SAMPLE_SECONDS = 0.02;
+    constexpr int NUM_SAMPLES = 7;
+
+    double timeSeconds(Bench::Function function, size_t iterations) {
+        auto start = std::chrono::steady_clock::now();
+        function(iterations);
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+bool Bench::registerBenchmark(const char* NAME, Function function, double ITEMS_PER_OP) {
+    registry().push_back({NAME, function, ITEMS_PER_OP});
+    return true;
+}
+
+std::vector<Bench::Result> Bench::runAll(const std::string& FILTER) {
+    std::vector<Result> results;
+
+    // El orden de registro depende del orden de enlace; por nombre, la salida y el JSON de dos
+    // builds se comparan línea por línea
+    std::vector<Entry> entries = registry();
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) { return strcmp(a.name, b.name) < 0; });
+
+    for(const Entry& entry : entries) {
+        if(!FILTER.empty() && std::string(entry.name).find(FILTER) == std::string::npos) continue;
+        currentCounters.clear();
+        currentFailures.clear();
+
+        // una llamada de calentamiento para que la inicialización perezosa (archivos temporales,
+        // modelos, mallas) no cuente como una muestra rápida; luego duplicar las iteraciones hasta
+        // que una muestra sea medible
+        entry.function(1);
+        size_t iterations = 1;
+        while(timeSeconds(entry.function, iterations) < MIN_SAMPLE_SECONDS && iterations < (size_t(1) << 40)) {
+            iterations *= 2;
+        }
+
+        std::vector<double> nsPerOp;
+        for(int i = 0; i < NUM_SAMPLES; ++i) {
+            nsPerOp.push_back(timeSeconds(entry.function, iterations) * 1e9 / (double)iterations);
+        }
+        std::sort(nsPerOp.begin(), nsPerOp.end());
+
+        const double itemsPerSecond = entry.itemsPerOp > 0.0 ? entry.itemsPerOp * 1e9 / nsPerOp[NUM_SAMPLES / 2] : 0.0;
+        Result result = {entry.name, iterations, nsPerOp[NUM_SAMPLES / 2], nsPerOp.front(), itemsPerSecond, currentCounters};
+        if(result.itemsPerSecond > 0.0) {
+            printf("%-48s %12zu it %12.2f ns/op (min %.2f) %12.1f items/s\n", result.name.c_str(), result.iterations,
+                   result.nsPerOpMedian, result.nsPerOpMin, result.itemsPerSecond);
+        } else {
+            printf("%-48s %12zu it %12.2f ns/op (min %.2f)\n", result.name.c_str(), result.iterations, result.nsPerOpMedian, result.nsPerOpMin);
+        }
+        for(const auto& counter : result.counters) {
+            printf("    %-44s %12.2f\n", counter.first.c_str(), counter.second);
+        }
+        for(const std::string& failure : currentFailures) {
+            fprintf(stderr, "[ERROR]: %s: %s\n", result.name.c_str(), failure.c_str());
+        }
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+void Bench::setCounter(const char* NAME, double VALUE) {
+    for(auto& counter : currentCounters) {
+        if(counter.first == NAME) {
+            counter.second = VALUE;
+            return;
+        }
+    }
+    currentCounters.emplace_back(NAME, VALUE);
+}
+
+void Bench::expectAtMost(const char* NAME, double VALUE, double LIMIT) {
+    if(VALUE <= LIMIT) return;
+    failed = true;
+
+    // cada presupuesto se reporta una sola vez aunque se exceda en todas las muestras
+    const std::string prefix = std::string(NAME) + " ";
+    for(const std::string& failure : currentFailures) {
+        if(failure.compare(0, prefix.size(), prefix) == 0) return;
+    }
+    char message[256];
+    snprintf(message, sizeof(message), "%s is %.2f, over its budget of %.2f", NAME, VALUE, LIMIT);
+    currentFailures.emplace_back(message);
+}
+
+bool Bench::hasFailed() {
+    return failed;
+}
+
+bool Bench::writeJSON(const std::vector<Result>& RESULTS, const char* FILENAME) {
+    FILE* file = fopen(FILENAME, "w");
+    if(file == nullptr) {
+        fprintf(stderr, "[ERROR]: Could not open %s for writing\n", FILENAME);
+        return false;
+    }
+
+    fprintf(file, "{\n  \"benchmarks\": [\n");
+    for(size_t i = 0; i < RESULTS.size(); ++i) {
+        const Result& result = RESULTS[i];
+        fprintf(file, "    {\"name\": \"%s\", \"iterations\": %zu, \"ns_per_op\": %.4f, \"ns_per_op_min\": %.4f",
+                result.name.c_str(), result.iterations, result.nsPerOpMedian, result.nsPerOpMin);
+        if(result.itemsPerSecond > 0.0) {
+            fprintf(file, ", \"items_per_second\": %.1f", result.itemsPerSecond);
+        }
+        if(!result.counters.empty()) {
+            fprintf(file, ", \"counters\": {");
+            for(size_t j = 0; j < result.counters.size(); ++j) {
+                fprintf(file, "%s\"%s\": %.4f", (j > 0 ? ", " : ""), result.counters[j].first.c_str(), result.counters[j].second);
+            }
+            fprintf(file, "}");
+        }
+        fprintf(file, "}%s\n", (i + 1 < RESULTS.size() ? "," : ""));
+    }
+    fprintf(file, "  ]\n}\n");
+    fclose(file);
+    return true;
+}
@@ -0,0 +1,97 @@
+#ifndef MP_BENCHMARK_H
+#define MP_BENCHMARK_H
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Arnés mínimo de microbenchmarks para mp_bench.
+ *
+ * Cada benchmark recibe el número de iteraciones a ejecutar; el arnés calibra ese número
+ * hasta que una muestra dura lo suficiente, repite varias muestras y reporta ns por operación.
+ */
+namespace Bench {
+
+    /**
+     * @brief Resultado de un benchmark.
+     */
+    struct Result {
+        std::string name;
+        size_t iterations;      // iteraciones por muestra tras la calibración
+        double nsPerOpMedian;   // mediana de ns por operación entre muestras
+        double nsPerOpMin;      // mejor muestra
+        double itemsPerSecond;  // elementos procesados por segundo en la muestra mediana; 0 si no aplica
+        std::vector<std::pair<std::string, double>> counters;   // los de setCounter(), en orden
+    };
+
+    /**
+     * @brief Firma de un benchmark: ejecuta la operación medida ITERATIONS veces.
+     */
+    using Function = void (*)(size_t ITERATIONS);
+
+    /**
+     * @brief Registra un benchmark para que lo ejecute runAll().
+     *
+     * @param ITEMS_PER_OP Elementos (tiles, vértices...) que procesa cada operación; si es mayor
+     * que 0 también se reporta el throughput en elementos por segundo.
+     * @return Siempre true, para poder inicializar una variable estática con el registro.
+     */
+    bool registerBenchmark(const char* NAME, Function function, double ITEMS_PER_OP = 0.0);
+
+    /**
+     * @brief Ejecuta, en orden alfabético, los benchmarks cuyo nombre contiene FILTER (todos si
+     * está vacío).
+     */
+    std::vector<Result> runAll(const std::string& FILTER);
+
+    /**
+     * @brief Publica un valor medido por el benchmark en curso (llamadas GL por operación, bytes...).
+     *
+     * Puede llamarse en cada ejecución; queda el último valor.
+     */
+    void setCounter(const char* NAME, double VALUE);
+
+    /**
+     * @brief Presupuesto del benchmark en curso: si VALUE supera LIMIT el benchmark falla.
+     *
+     * La falla se reporta una vez al terminar sus muestras y hace que hasFailed() devuelva true.
+     */
+    void expectAtMost(const char* NAME, double VALUE, double LIMIT);
+
+    /**
+     * @brief true si algún benchmark ejecutado superó un presupuesto de expectAtMost().
+     */
+    bool hasFailed();
+
+    /**
+     * @brief Escribe los resultados en formato JSON.
+     *
+     * @return true si el archivo se pudo escribir.
+     */
+    bool writeJSON(const std::vector<Result>& RESULTS, const char* FILENAME);
+
+    /**
+     * @brief Evita que el compilador elimine un cálculo cuyo resultado no se usa.
+     */
+    template<typename T>
+    inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const T* sink;
+        sink = &value;
+#endif
+    }
+}
+
+// Registra una función void(size_t) como benchmark al cargar el programa
+#define MP_BENCHMARK(FUNCTION) \
+    static const bool FUNCTION##_registered = Bench::registerBenchmark(#FUNCTION, FUNCTION)
+
+// Igual que MP_BENCHMARK, reportando además ITEMS_PER_OP elementos por operación
+#define MP_BENCHMARK_ITEMS(FUNCTION, ITEMS_PER_OP) \
+    static const bool FUNCTION##_registered = Bench::registerBenchmark(#FUNCTION, FUNCTION, ITEMS_PER_OP)
+
+#endif // MP_BENCHMARK_H
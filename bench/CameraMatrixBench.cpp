@@ -0,0 +1,84 @@
+/*
+ *  Matemática de matrices de cada frame, sin OpenGL:
+ *   - arcballOrbit: lo que hace un tick con el mouse en la cámara arcball (seguir al héroe,
+ *     rotar, acercar) más la vista por proyección que reciben las vistas del paquete.
+ *   - heroMatrices / zombieMatrices128: armar las piezas de los modelos (matriz de modelo y de
+ *     normales de cada una) y multiplicar cada una por la vista y la proyección, como
+ *     submitDrawItems() antes de enviar el MVP.
+ */
+
+#include "Benchmark.h"
+
+#include "../Cameras/Arcballcam.h"
+#include "../Enemies/Zombie.h"
+#include "../Heroes/Aaron_Inti.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <vector>
+
+namespace {
+    constexpr int NUM_ZOMBIES = 128;
+
+    const glm::mat4& projection() {
+        static const glm::mat4 PROJECTION = glm::perspective(glm::radians(45.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+        return PROJECTION;
+    }
+
+    // Suma los MVP para que el compilador no descarte el cálculo
+    float multiplyByViewProjection(const glm::mat4& viewProjMtx, const std::vector<DrawItem>& drawItems) {
+        float sum = 0.0f;
+        for (const DrawItem& item : drawItems) {
+            const glm::mat4 mvpMtx = viewProjMtx * item.modelMtx;
+            sum += mvpMtx[3][0] + item.normalMtx[0][0];
+        }
+        return sum;
+    }
+
+    void arcballOrbit(size_t ITERATIONS) {
+        ArcballCam camera;
+        glm::mat4 viewProjMtx(1.0f);
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            const float t = static_cast<float>(i & 1023);
+            camera.setLookAtPoint(glm::vec3(t * 0.1f, 0.0f, -t * 0.1f));
+            camera.rotate(3.0f, (i & 1) ? 2.0f : -2.0f, 1280, 720);
+            camera.zoom((i & 2) ? 0.5f : -0.5f);
+            viewProjMtx = projection() * camera.getViewMatrix();
+            Bench::doNotOptimize(viewProjMtx);
+        }
+    }
+    MP_BENCHMARK(arcballOrbit);
+
+    void heroMatrices(size_t ITERATIONS) {
+        const Aaron_Inti hero;
+        const glm::mat4 viewProjMtx = projection() * glm::lookAt(glm::vec3(0.0f, 10.0f, 20.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        std::vector<DrawItem> drawItems;
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            drawItems.clear();
+            glm::mat4 heroModelMtx = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 1.3f, 0.0f));
+            heroModelMtx = glm::rotate(heroModelMtx, static_cast<float>(i & 255) * 0.01f, glm::vec3(0.0f, 1.0f, 0.0f));
+            hero.emitDrawItems(heroModelMtx, drawItems);
+            Bench::doNotOptimize(multiplyByViewProjection(viewProjMtx, drawItems));
+        }
+        Bench::setCounter("drawItems", static_cast<double>(drawItems.size()));
+    }
+    MP_BENCHMARK(heroMatrices);
+
+    void zombieMatrices128(size_t ITERATIONS) {
+        std::vector<Zombie> zombies(NUM_ZOMBIES);
+        for (int z = 0; z < NUM_ZOMBIES; ++z) {
+            zombies[z].setPosition(glm::vec3(static_cast<float>(z % 16) * 2.0f, 0.0f, static_cast<float>(z / 16) * 2.0f));
+        }
+        const glm::mat4 viewProjMtx = projection() * glm::lookAt(glm::vec3(0.0f, 10.0f, 20.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        std::vector<DrawItem> drawItems;
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            drawItems.clear();
+            for (const Zombie& zombie : zombies) {
+                zombie.emitDrawItems(glm::mat4(1.0f), drawItems);
+            }
+            Bench::doNotOptimize(multiplyByViewProjection(viewProjMtx, drawItems));
+        }
+        Bench::setCounter("drawItems", static_cast<double>(drawItems.size()));
+    }
+    MP_BENCHMARK_ITEMS(zombieMatrices128, static_cast<double>(NUM_ZOMBIES));
+}
@@ -0,0 +1,84 @@
+/*
+ *  Un tick de CrowdAvoidance::solve sobre una horda que converge hacia el origen, en agentes
+ *  por segundo. Con 10 000 y 100 000 agentes el throughput debería ser parecido (costo
+ *  lineal); la versión de un solo hilo muestra cuánto aporta el reparto por bloques.
+ *
+ *  Cada muestra también compara las velocidades con las de un solo hilo: si algún bit
+ *  difiere, el reparto entre hilos cambió el resultado y se reporta un error.
+ */
+
+#include "Benchmark.h"
+
+#include "../Enemies/CrowdAvoidance.h"
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+    constexpr uint32_t SEED = 12345u;
+    constexpr float AGENT_SPACING = 2.5f;   // un poco más que el diámetro de un zombie
+    constexpr float WALK_SPEED = 1.5f;
+    constexpr float DELTA_TIME = 1.0f / 60.0f;
+
+    // Retícula cuadrada con algo de desorden; todos caminan hacia el centro
+    void solveHorde(CrowdAvoidance& crowd, size_t numAgents, std::vector<glm::vec2>& velocities) {
+        const int agentsPerSide = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(numAgents))));
+        uint32_t state = SEED;
+        crowd.clear();
+        for (size_t i = 0; i < numAgents; ++i) {
+            state = state * 1664525u + 1013904223u;
+            const float jitter = static_cast<float>(state >> 8) / 16777216.0f - 0.5f;
+            const glm::vec2 position = (glm::vec2(static_cast<float>(i % agentsPerSide), static_cast<float>(i / agentsPerSide))
+                                        - 0.5f * static_cast<float>(agentsPerSide) + jitter) * AGENT_SPACING;
+            const glm::vec2 preferred = glm::length(position) > 0.0f ? -glm::normalize(position) * WALK_SPEED : glm::vec2(0.0f);
+            crowd.addAgent(position, preferred, preferred, DELTA_TIME);
+        }
+        crowd.solve();
+
+        velocities.resize(numAgents);
+        for (size_t i = 0; i < numAgents; ++i) {
+            velocities[i] = crowd.getVelocity(i);
+        }
+    }
+
+    const std::vector<glm::vec2>& singleThreadReference(size_t numAgents) {
+        static std::vector<glm::vec2> reference;
+        if (reference.size() != numAgents) {
+            CrowdAvoidance::Settings settings;
+            settings.numThreads = 1;
+            CrowdAvoidance crowd;
+            crowd.start(settings);
+            solveHorde(crowd, numAgents, reference);
+        }
+        return reference;
+    }
+
+    void runCrowd(size_t numAgents, int numThreads, size_t ITERATIONS) {
+        static std::vector<glm::vec2> velocities;
+        CrowdAvoidance::Settings settings;
+        settings.numThreads = numThreads;
+        CrowdAvoidance crowd;
+        crowd.start(settings);
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            solveHorde(crowd, numAgents, velocities);
+            Bench::doNotOptimize(velocities.data());
+        }
+
+        const std::vector<glm::vec2>& reference = singleThreadReference(numAgents);
+        if (memcmp(velocities.data(), reference.data(), reference.size() * sizeof(glm::vec2)) != 0) {
+            fprintf(stderr, "[ERROR]: Crowd velocities solved with %d threads differ from the single-thread result\n", crowd.getNumThreads());
+        }
+    }
+
+    void crowdAvoidance10k(size_t ITERATIONS) { runCrowd(10000, 0, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(crowdAvoidance10k, 10000.0);
+
+    void crowdAvoidance100k(size_t ITERATIONS) { runCrowd(100000, 0, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(crowdAvoidance100k, 100000.0);
+
+    void crowdAvoidance100k1Thread(size_t ITERATIONS) { runCrowd(100000, 1, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(crowdAvoidance100k1Thread, 100000.0);
+}
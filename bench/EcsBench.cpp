@@ -0,0 +1,162 @@
+/*
+ *  Recorrido de un sistema sobre 100 000 entidades, en entidades por segundo:
+ *   - ecsEach100k: Registry::each sobre Transform + AgentSchedule, repartidas en varios
+ *     arquetipos como en el mundo (un tercio tiene un componente más).
+ *   - heapObjects100k: el mismo trabajo sobre objetos reservados uno por uno con new y
+ *     recorridos por puntero, como los arreglos de punteros que reemplazó el ECS.
+ *   - ecsSpawnDespawn10k: una oleada de 10 000 zombies creada y destruida en orden mezclado;
+ *     después de la primera, las filas y los índices se reutilizan sin pasar por el allocator.
+ *   - newDeleteSpawnDespawn10k: la misma oleada con new y delete de cada Zombie.
+ */
+
+#include "Benchmark.h"
+
+#include "../ECS/Components.h"
+#include "../ECS/Registry.h"
+#include "../Enemies/Zombie.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+    constexpr uint32_t SEED = 12345u;
+    constexpr size_t NUM_ENTITIES = 100000;
+    constexpr float DELTA_TIME = 1.0f / 60.0f;
+
+    // Componentes de relleno para tener los mismos arquetipos que el mundo
+    struct Payload { float data[12]; };
+    struct Marker { int value; };
+
+    // Objeto "a la antigua": datos y relleno juntos, cada uno en su propia reserva
+    struct HeapObject {
+        ECS::Transform transform;
+        ECS::AgentSchedule schedule;
+        Payload payload;
+    };
+
+    uint32_t nextRandom(uint32_t& state) {
+        state = state * 1664525u + 1013904223u;
+        return state;
+    }
+
+    void moveAgent(ECS::Transform& transform, ECS::AgentSchedule& schedule) {
+        schedule.pendingTime += DELTA_TIME;
+        transform.position.x += schedule.pendingTime * 0.001f;
+        transform.heading += 0.01f;
+    }
+
+    ECS::Registry& populatedRegistry() {
+        static ECS::Registry registry;
+        if (registry.getNumEntities() == 0) {
+            uint32_t state = SEED;
+            for (size_t i = 0; i < NUM_ENTITIES; ++i) {
+                ECS::AgentSchedule schedule;
+                schedule.phase = static_cast<uint32_t>(i);
+                if (nextRandom(state) % 3 == 0) {
+                    registry.create(ECS::Transform(), schedule, Payload(), Marker{ static_cast<int>(i) });
+                } else {
+                    registry.create(ECS::Transform(), schedule, Payload());
+                }
+            }
+        }
+        return registry;
+    }
+
+    std::vector<std::unique_ptr<HeapObject>>& heapObjects() {
+        static std::vector<std::unique_ptr<HeapObject>> objects;
+        if (objects.empty()) {
+            // Reservas intercaladas con basura y en orden mezclado, como un heap con historia
+            std::vector<std::unique_ptr<Payload>> garbage;
+            for (size_t i = 0; i < NUM_ENTITIES; ++i) {
+                objects.push_back(std::make_unique<HeapObject>());
+                garbage.push_back(std::make_unique<Payload>());
+            }
+            uint32_t state = SEED;
+            for (size_t i = objects.size() - 1; i > 0; --i) {
+                std::swap(objects[i], objects[nextRandom(state) % (i + 1)]);
+            }
+        }
+        return objects;
+    }
+
+    void ecsEach100k(size_t ITERATIONS) {
+        ECS::Registry& registry = populatedRegistry();
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            registry.each<ECS::Transform, ECS::AgentSchedule>(moveAgent);
+            Bench::doNotOptimize(registry);
+        }
+    }
+    MP_BENCHMARK_ITEMS(ecsEach100k, static_cast<double>(NUM_ENTITIES));
+
+    void heapObjects100k(size_t ITERATIONS) {
+        std::vector<std::unique_ptr<HeapObject>>& objects = heapObjects();
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            for (const std::unique_ptr<HeapObject>& object : objects) {
+                moveAgent(object->transform, object->schedule);
+            }
+            Bench::doNotOptimize(objects.data());
+        }
+    }
+    MP_BENCHMARK_ITEMS(heapObjects100k, static_cast<double>(NUM_ENTITIES));
+
+    constexpr size_t WAVE_SIZE = 10000;
+
+    // Orden en que muere la oleada, igual para las dos versiones
+    const std::vector<size_t>& despawnOrder() {
+        static std::vector<size_t> order;
+        if (order.empty()) {
+            for (size_t i = 0; i < WAVE_SIZE; ++i) {
+                order.push_back(i);
+            }
+            uint32_t state = SEED;
+            for (size_t i = order.size() - 1; i > 0; --i) {
+                std::swap(order[i], order[nextRandom(state) % (i + 1)]);
+            }
+        }
+        return order;
+    }
+
+    void ecsSpawnDespawn10k(size_t ITERATIONS) {
+        static ECS::Registry registry;
+        static std::vector<ECS::Entity> entities;
+        const std::vector<size_t>& order = despawnOrder();
+        registry.reserve<Zombie, ECS::AgentSchedule>(WAVE_SIZE);
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            entities.clear();
+            for (size_t j = 0; j < WAVE_SIZE; ++j) {
+                ECS::AgentSchedule schedule;
+                schedule.phase = static_cast<uint32_t>(j);
+                entities.push_back(registry.create(Zombie(), schedule));
+            }
+            for (const size_t j : order) {
+                registry.destroy(entities[j]);
+            }
+            Bench::doNotOptimize(entities.data());
+        }
+    }
+    MP_BENCHMARK_ITEMS(ecsSpawnDespawn10k, static_cast<double>(WAVE_SIZE));
+
+    void newDeleteSpawnDespawn10k(size_t ITERATIONS) {
+        struct HeapZombie {
+            Zombie zombie;
+            ECS::AgentSchedule schedule;
+        };
+        static std::vector<HeapZombie*> zombies;
+        const std::vector<size_t>& order = despawnOrder();
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            zombies.clear();
+            for (size_t j = 0; j < WAVE_SIZE; ++j) {
+                HeapZombie* zombie = new HeapZombie{ Zombie(), ECS::AgentSchedule() };
+                zombie->schedule.phase = static_cast<uint32_t>(j);
+                zombies.push_back(zombie);
+            }
+            for (const size_t j : order) {
+                delete zombies[j];
+            }
+            Bench::doNotOptimize(zombies.data());
+        }
+    }
+    MP_BENCHMARK_ITEMS(newDeleteSpawnDespawn10k, static_cast<double>(WAVE_SIZE));
+}
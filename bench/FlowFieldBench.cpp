@@ -0,0 +1,92 @@
+/*
+ *  Costo del campo de direcciones de los zombies:
+ *   - flowFieldBuild: una reconstrucción completa (alturas, costos, Dijkstra y direcciones)
+ *     sobre 3 x 3 tiles de terreno, como cuando el héroe cambia de celda.
+ *   - flowFieldAgents10k / 100k: un tick de una horda que consulta el campo y avanza; el
+ *     throughput en agentes por segundo debería ser el mismo con 10 000 que con 100 000.
+ */
+
+#include "Benchmark.h"
+
+#include "../Enemies/FlowField.h"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+    constexpr uint32_t SEED = 12345u;
+    constexpr float AGENT_SPEED = 1.5f;
+    constexpr float DELTA_TIME = 1.0f / 60.0f;
+
+    const std::vector<std::shared_ptr<Terrain>>& terrainTiles() {
+        static std::vector<std::shared_ptr<Terrain>> tiles;
+        if(tiles.empty()) {
+            for(int z = -1; z <= 1; ++z) {
+                for(int x = -1; x <= 1; ++x) {
+                    Terrain::Settings settings;
+                    settings.tileX = x;
+                    settings.tileZ = z;
+                    tiles.push_back(std::make_shared<Terrain>());
+                    tiles.back()->generate(settings, SEED);
+                }
+            }
+        }
+        return tiles;
+    }
+
+    const FlowField::Field& builtField() {
+        static FlowField::Field field;
+        if(field.cellsPerSide == 0) {
+            std::vector<std::pair<float, int>> heap;
+            FlowField::build(FlowField::Settings(), glm::vec2(0.0f), terrainTiles(), field, heap);
+        }
+        return field;
+    }
+
+    void flowFieldBuild(size_t ITERATIONS) {
+        static FlowField::Field field;
+        static std::vector<std::pair<float, int>> heap;
+        const FlowField::Settings settings;
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            // El héroe se mueve una celda por iteración, como al caminar
+            const glm::vec2 goal(static_cast<float>(i % 8) * settings.cellSize, 0.0f);
+            FlowField::build(settings, goal, terrainTiles(), field, heap);
+            Bench::doNotOptimize(field.directions.data());
+        }
+    }
+    MP_BENCHMARK(flowFieldBuild);
+
+    // Agentes repartidos al azar (con semilla fija) por toda la ventana del campo
+    void scatterAgents(const FlowField::Field& field, size_t numAgents, std::vector<glm::vec2>& positions) {
+        const float extent = field.cellSize * static_cast<float>(field.cellsPerSide);
+        uint32_t state = SEED;
+        positions.resize(numAgents);
+        for(glm::vec2& position : positions) {
+            state = state * 1664525u + 1013904223u;
+            const float u = static_cast<float>(state >> 8) / 16777216.0f;
+            state = state * 1664525u + 1013904223u;
+            const float v = static_cast<float>(state >> 8) / 16777216.0f;
+            position = field.origin + glm::vec2(u, v) * extent;
+        }
+    }
+
+    void runAgents(size_t numAgents, size_t ITERATIONS) {
+        const FlowField::Field& field = builtField();
+        static std::vector<glm::vec2> positions;
+        scatterAgents(field, numAgents, positions);
+
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            for(glm::vec2& position : positions) {
+                position += field.sample(position.x, position.y) * (AGENT_SPEED * DELTA_TIME);
+            }
+            Bench::doNotOptimize(positions.data());
+        }
+    }
+
+    void flowFieldAgents10k(size_t ITERATIONS) { runAgents(10000, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(flowFieldAgents10k, 10000.0);
+
+    void flowFieldAgents100k(size_t ITERATIONS) { runAgents(100000, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(flowFieldAgents100k, 100000.0);
+}
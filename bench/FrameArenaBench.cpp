@@ -0,0 +1,87 @@
+/*
+ *  Memoria de trabajo que se arma y se descarta dentro de un frame, en trabajos por segundo.
+ *  Cada trabajo junta sus vecinos más cercanos y arma una lista de restricciones, como un
+ *  agente de CrowdAvoidance:
+ *   - frameArenaScratch10k: vectores en un FrameArena, devueltos con rewind() al terminar
+ *     cada trabajo y vaciados con reset() al terminar el frame.
+ *   - heapScratch10k: los mismos vectores con el allocator de siempre, creados en cada trabajo.
+ *
+ *  Después de calentar, el arena no debería pedir ningún bloque al heap; si lo hace se
+ *  reporta como falla del benchmark (ver Bench::expectAtMost).
+ */
+
+#include "Benchmark.h"
+
+#include "../Memory/FrameArena.h"
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr size_t NUM_JOBS = 10000;
+    constexpr size_t MAX_NEIGHBORS = 10;
+
+    struct Constraint {
+        float point[2];
+        float direction[2];
+    };
+
+    // Cantidad de vecinos de cada trabajo, fija para que las dos versiones hagan lo mismo
+    size_t neighborsOf(size_t job) { return (job * 2654435761u >> 7) % (MAX_NEIGHBORS + 1); }
+
+    template<typename Neighbors, typename Constraints>
+    float runJob(size_t job, Neighbors& neighbors, Constraints& constraints) {
+        const size_t numNeighbors = neighborsOf(job);
+        for (size_t i = 0; i < numNeighbors; ++i) {
+            neighbors.emplace_back(static_cast<float>(i * job % 97), static_cast<uint32_t>(i));
+        }
+        for (const std::pair<float, uint32_t>& neighbor : neighbors) {
+            constraints.push_back({ { neighbor.first, 0.0f }, { 0.0f, static_cast<float>(neighbor.second) } });
+        }
+        float sum = 0.0f;
+        for (const Constraint& constraint : constraints) {
+            sum += constraint.point[0] + constraint.direction[1];
+        }
+        return sum;
+    }
+
+    void frameArenaScratch10k(size_t ITERATIONS) {
+        static FrameArena arena;
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            float total = 0.0f;
+            for (size_t job = 0; job < NUM_JOBS; ++job) {
+                const FrameArena::Marker marker = arena.mark();
+                {
+                    FrameVector<std::pair<float, uint32_t>> neighbors{ ArenaAllocator<std::pair<float, uint32_t>>(arena) };
+                    neighbors.reserve(MAX_NEIGHBORS);
+                    FrameVector<Constraint> constraints{ ArenaAllocator<Constraint>(arena) };
+                    constraints.reserve(MAX_NEIGHBORS);
+                    total += runJob(job, neighbors, constraints);
+                }
+                arena.rewind(marker);
+            }
+            arena.reset();
+            Bench::doNotOptimize(total);
+        }
+
+        // El primer frame ya tiene lugar para todo: solo el bloque inicial vino del heap
+        Bench::expectAtMost("heapBlocks", static_cast<double>(arena.getHeapBlocks()), 1.0);
+    }
+    MP_BENCHMARK_ITEMS(frameArenaScratch10k, static_cast<double>(NUM_JOBS));
+
+    void heapScratch10k(size_t ITERATIONS) {
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            float total = 0.0f;
+            for (size_t job = 0; job < NUM_JOBS; ++job) {
+                std::vector<std::pair<float, uint32_t>> neighbors;
+                neighbors.reserve(MAX_NEIGHBORS);
+                std::vector<Constraint> constraints;
+                constraints.reserve(MAX_NEIGHBORS);
+                total += runJob(job, neighbors, constraints);
+            }
+            Bench::doNotOptimize(total);
+        }
+    }
+    MP_BENCHMARK_ITEMS(heapScratch10k, static_cast<double>(NUM_JOBS));
+}
@@ -0,0 +1,70 @@
+#include "GLStubs.h"
+
+#include <glad/gl.h>
+
+namespace {
+    GLuint sNextName = 0;
+
+    void GLAD_API_PTR stubGenNames(GLsizei n, GLuint* names) { for(GLsizei i = 0; i < n; ++i) names[i] = ++sNextName; }
+    void GLAD_API_PTR stubDeleteNames(GLsizei, const GLuint*) {}
+    void GLAD_API_PTR stubBindVertexArray(GLuint) {}
+    void GLAD_API_PTR stubBindBuffer(GLenum, GLuint) {}
+    void GLAD_API_PTR stubBindTexture(GLenum, GLuint) {}
+    void GLAD_API_PTR stubTexParameteri(GLenum, GLenum, GLint) {}
+    void GLAD_API_PTR stubPixelStorei(GLenum, GLint) {}
+    void GLAD_API_PTR stubTexImage2D(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*) {}
+    void GLAD_API_PTR stubBufferData(GLenum, GLsizeiptr, const void*, GLenum) {}
+    void GLAD_API_PTR stubBufferSubData(GLenum, GLintptr, GLsizeiptr, const void*) {}
+    void GLAD_API_PTR stubEnableVertexAttribArray(GLuint) {}
+    void GLAD_API_PTR stubVertexAttribPointer(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*) {}
+    void GLAD_API_PTR stubDrawElements(GLenum, GLsizei, GLenum, const void*) {}
+    void GLAD_API_PTR stubDrawArraysInstanced(GLenum, GLint, GLsizei, GLsizei) {}
+    void GLAD_API_PTR stubDrawElementsInstanced(GLenum, GLsizei, GLenum, const void*, GLsizei) {}
+    void GLAD_API_PTR stubGetIntegerv(GLenum pname, GLint* data) {
+        if(pname == GL_MAX_TEXTURE_SIZE) data[0] = 16384;
+        else data[0] = data[1] = GL_FILL;
+    }
+    void GLAD_API_PTR stubPolygonMode(GLenum, GLenum) {}
+    void GLAD_API_PTR stubProgramUniformMatrix4fv(GLuint, GLint, GLsizei, GLboolean, const GLfloat*) {}
+    void GLAD_API_PTR stubProgramUniformMatrix3fv(GLuint, GLint, GLsizei, GLboolean, const GLfloat*) {}
+    void GLAD_API_PTR stubProgramUniform3fv(GLuint, GLint, GLsizei, const GLfloat*) {}
+    void GLAD_API_PTR stubProgramUniform1f(GLuint, GLint, GLfloat) {}
+    void GLAD_API_PTR stubDeleteProgram(GLuint) {}
+    void GLAD_API_PTR stubGetProgramiv(GLuint, GLenum, GLint* params) { *params = 0; }
+    void GLAD_API_PTR stubGetProgramInfoLog(GLuint, GLsizei, GLsizei* length, GLchar*) { if(length) *length = 0; }
+}
+
+void Bench::installGLStubs() {
+    static bool installed = false;
+    if(installed) return;
+    installed = true;
+
+    glad_glGenVertexArrays = stubGenNames;
+    glad_glGenBuffers = stubGenNames;
+    glad_glDeleteVertexArrays = stubDeleteNames;
+    glad_glDeleteBuffers = stubDeleteNames;
+    glad_glGenTextures = stubGenNames;
+    glad_glDeleteTextures = stubDeleteNames;
+    glad_glBindVertexArray = stubBindVertexArray;
+    glad_glBindBuffer = stubBindBuffer;
+    glad_glBindTexture = stubBindTexture;
+    glad_glTexParameteri = stubTexParameteri;
+    glad_glPixelStorei = stubPixelStorei;
+    glad_glTexImage2D = stubTexImage2D;
+    glad_glBufferData = stubBufferData;
+    glad_glBufferSubData = stubBufferSubData;
+    glad_glEnableVertexAttribArray = stubEnableVertexAttribArray;
+    glad_glVertexAttribPointer = stubVertexAttribPointer;
+    glad_glDrawElements = stubDrawElements;
+    glad_glDrawArraysInstanced = stubDrawArraysInstanced;
+    glad_glDrawElementsInstanced = stubDrawElementsInstanced;
+    glad_glGetIntegerv = stubGetIntegerv;
+    glad_glPolygonMode = stubPolygonMode;
+    glad_glProgramUniformMatrix4fv = stubProgramUniformMatrix4fv;
+    glad_glProgramUniformMatrix3fv = stubProgramUniformMatrix3fv;
+    glad_glProgramUniform3fv = stubProgramUniform3fv;
+    glad_glProgramUniform1f = stubProgramUniform1f;
+    glad_glDeleteProgram = stubDeleteProgram;
+    glad_glGetProgramiv = stubGetProgramiv;
+    glad_glGetProgramInfoLog = stubGetProgramInfoLog;
+}
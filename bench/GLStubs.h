@@ -0,0 +1,16 @@
+#ifndef MP_BENCH_GL_STUBS_H
+#define MP_BENCH_GL_STUBS_H
+
+/**
+ * @brief Funciones de glad vacías para los benchmarks que pasan por código que llama a OpenGL.
+ *
+ * mp_bench no crea contexto: installGLStubs() apunta las funciones que usan objects.hpp,
+ * ModelLoader, MD5Model, VertexAnimationTexture y los uniforms de ShaderProgram a stubs que no
+ * hacen nada (los glGen* devuelven nombres distintos de cero), así se mide solo el trabajo de CPU. Se puede llamar
+ * varias veces; solo la primera hace algo.
+ */
+namespace Bench {
+    void installGLStubs();
+}
+
+#endif // MP_BENCH_GL_STUBS_H
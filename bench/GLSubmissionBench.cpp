@@ -0,0 +1,107 @@
+/*
+ *  Costo de CPU y llamadas GL de dibujar un zombie, una moneda y el héroe con submitDrawItems().
+ *
+ *  No hay contexto OpenGL: las funciones de glad se reemplazan por los stubs de GLStubs. Después
+ *  de las muestras se dibuja una vez más con el GLCallTracer instalado y se publican las llamadas
+ *  por categoría como contadores. Los presupuestos son los valores actuales: si un cambio en
+ *  Zombie, Coin o Aaron_Inti agrega llamadas, mp_bench falla y hay que justificar el presupuesto
+ *  nuevo.
+ */
+
+#include "Benchmark.h"
+#include "GLStubs.h"
+
+#include "../Coin.h"
+#include "../Enemies/Zombie.h"
+#include "../Heroes/Aaron_Inti.h"
+#include "../Render/DrawItemSubmission.h"
+
+#include <GLCallTracer.hpp>
+#include <objects.hpp>
+#include <ShaderProgram.hpp>
+
+#include <vector>
+
+namespace {
+    // Programa de iluminación sin shaders: solo hace falta que setProgramUniform llegue a glad
+    class BenchShaderProgram final : public CSCI441::ShaderProgram {
+    public:
+        BenchShaderProgram() {
+            Bench::installGLStubs();
+            CSCI441::setVertexAttributeLocations(0, 1);
+        }
+    };
+
+    const BenchShaderProgram& benchProgram() {
+        static BenchShaderProgram program;
+        return program;
+    }
+
+    const DrawItemUniforms UNIFORMS = { 0, 1, 2, 3, 4, 5 };
+
+    // Mismo camino que MP::_renderScene: MVP por pieza y la malla de objects.hpp
+    void submit(const std::vector<DrawItem>& drawItems) {
+        static const glm::mat4 VIEW_PROJECTION(1.0f);
+        submitDrawItems(benchProgram(), UNIFORMS, &VIEW_PROJECTION, drawItems);
+    }
+
+    // Dibuja una vez con el tracer y publica las llamadas; DRAW_BUDGET y TOTAL_BUDGET son los
+    // valores actuales del modelo
+    void countGLCalls(const std::vector<DrawItem>& drawItems, double DRAW_BUDGET, double TOTAL_BUDGET) {
+        CSCI441::GLCallTracer::install();
+        CSCI441::GLCallTracer::endFrame();
+        submit(drawItems);
+        const CSCI441::GLCallTracer::Counts calls = CSCI441::GLCallTracer::endFrame();
+        CSCI441::GLCallTracer::uninstall();
+
+        Bench::setCounter("drawItems", static_cast<double>(drawItems.size()));
+        for(int i = 0; i < CSCI441::GLCallTracer::NUM_CATEGORIES; ++i) {
+            if(calls.calls[i] == 0) continue;
+            Bench::setCounter(CSCI441::GLCallTracer::getCategoryName(static_cast<CSCI441::GLCallTracer::Category>(i)),
+                              static_cast<double>(calls.calls[i]));
+        }
+        Bench::setCounter("total", static_cast<double>(calls.total()));
+
+        Bench::expectAtMost("draw", static_cast<double>(calls.calls[CSCI441::GLCallTracer::DRAW]), DRAW_BUDGET);
+        Bench::expectAtMost("total", static_cast<double>(calls.total()), TOTAL_BUDGET);
+    }
+
+    void submitZombie(size_t ITERATIONS) {
+        const Zombie zombie;
+        std::vector<DrawItem> drawItems;
+        zombie.emitDrawItems(glm::mat4(1.0f), drawItems);
+        submit(drawItems);      // las mallas se crean en la primera llamada
+
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            submit(drawItems);
+        }
+        countGLCalls(drawItems, 84.0, 212.0);
+    }
+    MP_BENCHMARK(submitZombie);
+
+    void submitCoin(size_t ITERATIONS) {
+        const Coin coin;
+        std::vector<DrawItem> drawItems;
+        coin.emitDrawItems(glm::mat4(1.0f), drawItems);
+        submit(drawItems);
+
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            submit(drawItems);
+        }
+        countGLCalls(drawItems, 20.0, 36.0);
+    }
+    MP_BENCHMARK(submitCoin);
+
+    void submitHero(size_t ITERATIONS) {
+        const Aaron_Inti hero;
+        std::vector<DrawItem> drawItems;
+        hero.emitDrawItems(glm::mat4(1.0f), drawItems);
+        submit(drawItems);
+
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            submit(drawItems);
+        }
+        countGLCalls(drawItems, 103.0, 791.0);
+    }
+    MP_BENCHMARK(submitHero);
+}
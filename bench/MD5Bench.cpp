@@ -0,0 +1,180 @@
+/*
+ *  Animación esquelética de CSCI441::MD5Model:
+ *   - md5Interpolate: animate() interpola el esqueleto entre dos frames, en joints por segundo.
+ *   - md5SkinAndDraw: draw() pesa cada vértice con sus joints y sube la malla, en vértices por
+ *     segundo; la subida y el dibujo son stubs (GLStubs).
+ *   - md5BakeVertexAnimation: VertexAnimationTexture::bake() muestrea la animación completa a
+ *     30 muestras por segundo, en vértices por segundo. Falla si la textura no mide 2048 x 75 o
+ *     si el primer vértice de la primera muestra no coincide con el calculado a mano.
+ *
+ *  El repositorio no trae modelos MD5: la primera ejecución escribe en el directorio temporal
+ *  un tubo de 2048 vértices alrededor de una cadena de 32 joints, con dos pesos por vértice y
+ *  una animación de 60 frames que dobla la cadena.
+ */
+
+#include "Benchmark.h"
+#include "GLStubs.h"
+
+#include <MD5Model.hpp>
+#include <VertexAnimationTexture.hpp>
+
+#include <glm/gtx/quaternion.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+namespace {
+    constexpr int NUM_JOINTS = 32;
+    constexpr int SEGMENTS = 64;                    // vértices por anillo; un anillo por joint
+    constexpr int NUM_VERTICES = NUM_JOINTS * SEGMENTS;
+    constexpr int NUM_TRIANGLES = (NUM_JOINTS - 1) * SEGMENTS * 2;
+    constexpr int NUM_FRAMES = 60;
+    constexpr int FRAME_RATE = 24;
+    constexpr float RADIUS = 0.3f;
+    constexpr float SAMPLE_RATE = 30.0f;
+    constexpr int NUM_SAMPLES = NUM_FRAMES * static_cast<int>(SAMPLE_RATE) / FRAME_RATE;
+
+    bool writeMesh(const std::string& FILENAME) {
+        FILE* file = fopen(FILENAME.c_str(), "w");
+        if(file == nullptr) return false;
+        fprintf(file, "MD5Version 10\ncommandline \"\"\n\nnumJoints %d\nnumMeshes 1\n\njoints {\n", NUM_JOINTS);
+        for(int j = 0; j < NUM_JOINTS; ++j) {
+            fprintf(file, "\t\"joint%d\" %d ( 0 %d 0 ) ( 0 0 0 )\n", j, j - 1, j);
+        }
+        fprintf(file, "}\n\nmesh {\n\tnumverts %d\n", NUM_VERTICES);
+        for(int v = 0; v < NUM_VERTICES; ++v) {
+            fprintf(file, "\tvert %d ( %f %f ) %d 2\n", v, static_cast<float>(v % SEGMENTS) / SEGMENTS,
+                    static_cast<float>(v / SEGMENTS) / NUM_JOINTS, v * 2);
+        }
+        fprintf(file, "\n\tnumtris %d\n", NUM_TRIANGLES);
+        int triangle = 0;
+        for(int ring = 0; ring < NUM_JOINTS - 1; ++ring) {
+            for(int s = 0; s < SEGMENTS; ++s) {
+                const int a = ring * SEGMENTS + s, b = ring * SEGMENTS + (s + 1) % SEGMENTS;
+                fprintf(file, "\ttri %d %d %d %d\n", triangle++, a, b + SEGMENTS, a + SEGMENTS);
+                fprintf(file, "\ttri %d %d %d %d\n", triangle++, a, b, b + SEGMENTS);
+            }
+        }
+        // Cada vértice sigue a su joint y, en menor medida, al siguiente
+        fprintf(file, "\n\tnumweights %d\n", NUM_VERTICES * 2);
+        for(int v = 0; v < NUM_VERTICES; ++v) {
+            const int ring = v / SEGMENTS;
+            const int next = ring + 1 < NUM_JOINTS ? ring + 1 : ring;
+            const float angle = 6.2831853f * static_cast<float>(v % SEGMENTS) / SEGMENTS;
+            const float x = RADIUS * cosf(angle), z = RADIUS * sinf(angle);
+            fprintf(file, "\tweight %d %d 0.7 ( %f 0 %f )\n", v * 2, ring, x, z);
+            fprintf(file, "\tweight %d %d 0.3 ( %f %d %f )\n", v * 2 + 1, next, x, ring - next, z);
+        }
+        fprintf(file, "}\n");
+        return fclose(file) == 0;
+    }
+
+    bool writeAnimation(const std::string& FILENAME) {
+        FILE* file = fopen(FILENAME.c_str(), "w");
+        if(file == nullptr) return false;
+        fprintf(file, "MD5Version 10\ncommandline \"\"\n\nnumFrames %d\nnumJoints %d\nframeRate %d\nnumAnimatedComponents %d\n\nhierarchy {\n",
+                NUM_FRAMES, NUM_JOINTS, FRAME_RATE, NUM_JOINTS * 6);
+        for(int j = 0; j < NUM_JOINTS; ++j) {
+            fprintf(file, "\t\"joint%d\" %d 63 %d\n", j, j - 1, j * 6);
+        }
+        fprintf(file, "}\n\nbounds {\n");
+        for(int f = 0; f < NUM_FRAMES; ++f) {
+            fprintf(file, "\t( -%d -1 -%d ) ( %d %d %d )\n", NUM_JOINTS, NUM_JOINTS, NUM_JOINTS, NUM_JOINTS, NUM_JOINTS);
+        }
+        fprintf(file, "}\n\nbaseframe {\n");
+        for(int j = 0; j < NUM_JOINTS; ++j) {
+            fprintf(file, "\t( 0 %d 0 ) ( 0 0 0 )\n", j > 0 ? 1 : 0);
+        }
+        fprintf(file, "}\n");
+        for(int f = 0; f < NUM_FRAMES; ++f) {
+            fprintf(file, "\nframe %d {\n", f);
+            for(int j = 0; j < NUM_JOINTS; ++j) {
+                const float phase = 6.2831853f * static_cast<float>(f) / NUM_FRAMES + 0.2f * static_cast<float>(j);
+                fprintf(file, "\t0 %d 0 %f 0 %f\n", j > 0 ? 1 : 0, 0.05f * sinf(phase), 0.05f * cosf(phase));
+            }
+            fprintf(file, "}\n");
+        }
+        return fclose(file) == 0;
+    }
+
+    CSCI441::MD5Model& benchModel() {
+        static CSCI441::MD5Model model;
+        static bool loaded = false;
+        if(!loaded) {
+            loaded = true;
+            Bench::installGLStubs();
+            const std::filesystem::path directory = std::filesystem::temp_directory_path();
+            const std::string meshFilename = (directory / "mp_bench_tube.md5mesh").string();
+            const std::string animationFilename = (directory / "mp_bench_tube.md5anim").string();
+            if(!writeMesh(meshFilename) || !writeAnimation(animationFilename)) {
+                fprintf(stderr, "[ERROR]: Could not write the MD5 model to %s\n", directory.string().c_str());
+            } else if(model.loadMD5Model(meshFilename.c_str(), animationFilename.c_str())) {
+                model.allocVertexArrays(0, 1, 2);
+            }
+        }
+        return model;
+    }
+
+    void md5Interpolate(size_t ITERATIONS) {
+        CSCI441::MD5Model& model = benchModel();
+        if(!model.isAnimated()) return;
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            model.animate(1.0f / 60.0f);
+        }
+    }
+    MP_BENCHMARK_ITEMS(md5Interpolate, static_cast<double>(NUM_JOINTS));
+
+    void md5SkinAndDraw(size_t ITERATIONS) {
+        CSCI441::MD5Model& model = benchModel();
+        if(!model.isAnimated()) return;
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            model.animate(1.0f / 60.0f);
+            model.draw();
+        }
+    }
+    MP_BENCHMARK_ITEMS(md5SkinAndDraw, static_cast<double>(NUM_VERTICES));
+
+    // Orientación del joint j en el frame 0 tal como la escribe writeAnimation(), relativa a su padre
+    glm::quat frameZeroOrientation(int j) {
+        glm::quat orientation;
+        orientation.x = 0.05f * sinf(0.2f * static_cast<float>(j));
+        orientation.y = 0.0f;
+        orientation.z = 0.05f * cosf(0.2f * static_cast<float>(j));
+        orientation.w = glm::extractRealComponent(orientation);
+        return orientation;
+    }
+
+    // Vértice 0 en el frame 0: anillo del joint 0, ángulo 0, pesos 0.7 en el joint 0 y 0.3 en el joint 1
+    glm::vec3 expectedFirstVertex() {
+        const glm::quat joint0 = frameZeroOrientation(0);
+        const glm::vec3 joint1Position = glm::rotate(joint0, glm::vec3(0.0f, 1.0f, 0.0f));
+        const glm::quat joint1 = glm::normalize(joint0 * frameZeroOrientation(1));
+        return 0.7f * glm::rotate(joint0, glm::vec3(RADIUS, 0.0f, 0.0f))
+             + 0.3f * (joint1Position + glm::rotate(joint1, glm::vec3(RADIUS, -1.0f, 0.0f)));
+    }
+
+    void md5BakeVertexAnimation(size_t ITERATIONS) {
+        CSCI441::MD5Model& model = benchModel();
+        if(!model.isAnimated()) return;
+        // Sin el resumen de bake() en cada iteración: la salida no entra en la medición
+        CSCI441::VertexAnimationTexture::disableDebugMessages();
+        CSCI441::VertexAnimationTexture vertexAnimation;
+        bool baked = true;
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            baked = vertexAnimation.bake(model, SAMPLE_RATE) && baked;
+        }
+        const double sizeError = std::abs(vertexAnimation.getTextureWidth() - NUM_VERTICES)
+                               + std::abs(vertexAnimation.getRowsPerSample() * vertexAnimation.getNumSamples() - NUM_SAMPLES);
+        Bench::expectAtMost("textureSizeError", baked ? sizeError : 1.0, 0.0);
+
+        // La textura vive en la GPU; las posiciones se comparan con las que bake() sube
+        std::vector<glm::vec3> positions, normals;
+        model.bakeAnimation(SAMPLE_RATE, positions, normals);
+        const double vertexError = positions.empty() ? 1.0 : glm::distance(positions[0], expectedFirstVertex());
+        Bench::expectAtMost("firstVertexError", vertexError, 1e-4);
+    }
+    MP_BENCHMARK_ITEMS(md5BakeVertexAnimation, static_cast<double>(NUM_VERTICES) * NUM_SAMPLES);
+}
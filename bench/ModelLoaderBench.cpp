@@ -0,0 +1,142 @@
+/*
+ *  Lectura de modelos OBJ, PLY y STL con CSCI441::ModelLoader en triángulos por segundo.
+ *
+ *  El repositorio no trae modelos, así que la primera ejecución escribe en el directorio
+ *  temporal una misma malla ondulada de 64x64 quads (8192 triángulos) en los tres formatos.
+ *  Cada operación construye un ModelLoader y lee el archivo completo; la subida a la GPU son
+ *  stubs (GLStubs).
+ */
+
+#include "Benchmark.h"
+#include "GLStubs.h"
+
+#include <ModelLoader.hpp>
+// ModelLoader y MD5Model cargan texturas con stb_image; en mp_bench su implementación va aquí
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+
+namespace {
+    constexpr int QUADS_PER_SIDE = 64;
+    constexpr int VERTICES_PER_SIDE = QUADS_PER_SIDE + 1;
+    constexpr double NUM_TRIANGLES = 2.0 * QUADS_PER_SIDE * QUADS_PER_SIDE;
+
+    float gridHeight(int x, int z) {
+        return 0.5f * sinf(static_cast<float>(x) * 0.3f) * cosf(static_cast<float>(z) * 0.2f);
+    }
+
+    int gridIndex(int x, int z) {
+        return z * VERTICES_PER_SIDE + x;
+    }
+
+    // Posiciones, coordenadas de textura y normales; en OBJ los índices empiezan en 1
+    bool writeOBJ(const std::string& FILENAME) {
+        FILE* file = fopen(FILENAME.c_str(), "w");
+        if(file == nullptr) return false;
+        fprintf(file, "# malla de mp_bench\n");
+        for(int z = 0; z < VERTICES_PER_SIDE; ++z) {
+            for(int x = 0; x < VERTICES_PER_SIDE; ++x) {
+                fprintf(file, "v %f %f %f\n", static_cast<float>(x), gridHeight(x, z), static_cast<float>(z));
+            }
+        }
+        for(int z = 0; z < VERTICES_PER_SIDE; ++z) {
+            for(int x = 0; x < VERTICES_PER_SIDE; ++x) {
+                fprintf(file, "vt %f %f\n", static_cast<float>(x) / QUADS_PER_SIDE, static_cast<float>(z) / QUADS_PER_SIDE);
+            }
+        }
+        for(int i = 0; i < VERTICES_PER_SIDE * VERTICES_PER_SIDE; ++i) {
+            fprintf(file, "vn 0 1 0\n");
+        }
+        for(int z = 0; z < QUADS_PER_SIDE; ++z) {
+            for(int x = 0; x < QUADS_PER_SIDE; ++x) {
+                const int a = gridIndex(x, z) + 1, b = gridIndex(x + 1, z) + 1;
+                const int c = gridIndex(x + 1, z + 1) + 1, d = gridIndex(x, z + 1) + 1;
+                fprintf(file, "f %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, d, d, d, c, c, c);
+                fprintf(file, "f %d/%d/%d %d/%d/%d %d/%d/%d\n", a, a, a, c, c, c, b, b, b);
+            }
+        }
+        return fclose(file) == 0;
+    }
+
+    bool writePLY(const std::string& FILENAME) {
+        FILE* file = fopen(FILENAME.c_str(), "w");
+        if(file == nullptr) return false;
+        fprintf(file, "ply\nformat ascii 1.0\nelement vertex %d\nproperty float x\nproperty float y\nproperty float z\n",
+                VERTICES_PER_SIDE * VERTICES_PER_SIDE);
+        fprintf(file, "element face %d\nproperty list uchar int vertex_indices\nend_header\n", static_cast<int>(NUM_TRIANGLES));
+        for(int z = 0; z < VERTICES_PER_SIDE; ++z) {
+            for(int x = 0; x < VERTICES_PER_SIDE; ++x) {
+                fprintf(file, "%f %f %f\n", static_cast<float>(x), gridHeight(x, z), static_cast<float>(z));
+            }
+        }
+        for(int z = 0; z < QUADS_PER_SIDE; ++z) {
+            for(int x = 0; x < QUADS_PER_SIDE; ++x) {
+                const int a = gridIndex(x, z), b = gridIndex(x + 1, z);
+                const int c = gridIndex(x + 1, z + 1), d = gridIndex(x, z + 1);
+                fprintf(file, "3 %d %d %d\n3 %d %d %d\n", a, d, c, a, c, b);
+            }
+        }
+        return fclose(file) == 0;
+    }
+
+    bool writeSTL(const std::string& FILENAME) {
+        FILE* file = fopen(FILENAME.c_str(), "w");
+        if(file == nullptr) return false;
+        fprintf(file, "solid mp_bench\n");
+        const auto writeTriangle = [file](int x0, int z0, int x1, int z1, int x2, int z2) {
+            fprintf(file, "facet normal 0 1 0\nouter loop\n");
+            fprintf(file, "vertex %f %f %f\n", static_cast<float>(x0), gridHeight(x0, z0), static_cast<float>(z0));
+            fprintf(file, "vertex %f %f %f\n", static_cast<float>(x1), gridHeight(x1, z1), static_cast<float>(z1));
+            fprintf(file, "vertex %f %f %f\n", static_cast<float>(x2), gridHeight(x2, z2), static_cast<float>(z2));
+            fprintf(file, "endloop\nendfacet\n");
+        };
+        for(int z = 0; z < QUADS_PER_SIDE; ++z) {
+            for(int x = 0; x < QUADS_PER_SIDE; ++x) {
+                writeTriangle(x, z, x, z + 1, x + 1, z + 1);
+                writeTriangle(x, z, x + 1, z + 1, x + 1, z);
+            }
+        }
+        fprintf(file, "endsolid mp_bench\n");
+        return fclose(file) == 0;
+    }
+
+    // Escribe el modelo en el directorio temporal y devuelve su ruta
+    std::string writeModel(const char* EXTENSION, bool (*write)(const std::string&)) {
+        const std::string filename = (std::filesystem::temp_directory_path() / (std::string("mp_bench_grid") + EXTENSION)).string();
+        if(!write(filename)) {
+            fprintf(stderr, "[ERROR]: Could not write %s\n", filename.c_str());
+        }
+        return filename;
+    }
+
+    void loadModel(const std::string& FILENAME, size_t ITERATIONS) {
+        Bench::installGLStubs();
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            CSCI441::ModelLoader model;
+            if(!model.loadModelFile(FILENAME, false, true)) return;
+            Bench::doNotOptimize(model.getNumberOfIndices());
+        }
+    }
+
+    void loadOBJ8k(size_t ITERATIONS) {
+        static const std::string FILENAME = writeModel(".obj", writeOBJ);
+        loadModel(FILENAME, ITERATIONS);
+    }
+    MP_BENCHMARK_ITEMS(loadOBJ8k, NUM_TRIANGLES);
+
+    void loadPLY8k(size_t ITERATIONS) {
+        static const std::string FILENAME = writeModel(".ply", writePLY);
+        loadModel(FILENAME, ITERATIONS);
+    }
+    MP_BENCHMARK_ITEMS(loadPLY8k, NUM_TRIANGLES);
+
+    void loadSTL8k(size_t ITERATIONS) {
+        static const std::string FILENAME = writeModel(".stl", writeSTL);
+        loadModel(FILENAME, ITERATIONS);
+    }
+    MP_BENCHMARK_ITEMS(loadSTL8k, NUM_TRIANGLES);
+}
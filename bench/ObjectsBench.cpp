@@ -0,0 +1,51 @@
+/*
+ *  Generación de las mallas de objects.hpp en vértices por segundo: lo que cuesta la primera
+ *  vez que se dibuja cada combinación de radio, stacks y slices.
+ *
+ *  Las funciones de glad son stubs (GLStubs), así que solo se mide el cálculo de vértices,
+ *  normales y coordenadas de textura. Después de la primera llamada el mapa de VAOs ya tiene
+ *  la clave y la inserción no hace nada.
+ */
+
+#include "Benchmark.h"
+#include "GLStubs.h"
+
+#include <objects.hpp>
+
+namespace {
+    const CSCI441_INTERNAL::SphereData SPHERE = { 1.0f, 20, 20 };            // DrawMesh::SPHERE
+    const CSCI441_INTERNAL::CylinderData CYLINDER = { 0.5f, 0.5f, 0.2f, 16, 16 }; // DrawMesh::CYLINDER
+    const CSCI441_INTERNAL::TorusData TORUS = { 0.5f, 1.0f, 32, 32 };
+
+    void generateSphere20x20(size_t ITERATIONS) {
+        Bench::installGLStubs();
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            CSCI441_INTERNAL::generateSphereVAO(SPHERE);
+        }
+    }
+    MP_BENCHMARK_ITEMS(generateSphere20x20, static_cast<double>(SPHERE.numVertices()));
+
+    void generateCylinder16x16(size_t ITERATIONS) {
+        Bench::installGLStubs();
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            CSCI441_INTERNAL::generateCylinderVAO(CYLINDER);
+        }
+    }
+    MP_BENCHMARK_ITEMS(generateCylinder16x16, static_cast<double>(CYLINDER.numVertices()));
+
+    void generateTorus32x32(size_t ITERATIONS) {
+        Bench::installGLStubs();
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            CSCI441_INTERNAL::generateTorusVAO(TORUS);
+        }
+    }
+    MP_BENCHMARK_ITEMS(generateTorus32x32, static_cast<double>(TORUS.numVertices()));
+
+    void generateCubeIndexed(size_t ITERATIONS) {
+        Bench::installGLStubs();
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            CSCI441_INTERNAL::generateCubeVAOIndexed(1.0f);
+        }
+    }
+    MP_BENCHMARK(generateCubeIndexed);
+}
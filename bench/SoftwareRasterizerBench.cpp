@@ -0,0 +1,132 @@
+/*
+ *  SoftwareRasterizer dibujando en la CPU el héroe, 128 zombies y 64 monedas a 640x360 con
+ *  las luces de la escena, en píxeles por segundo:
+ *   - softwareRaster1Thread: todo en el hilo que llama.
+ *   - softwareRasterThreads: un hilo por núcleo; la imagen debe ser idéntica a la de un hilo
+ *     y si algún píxel difiere el benchmark falla.
+ *
+ *  La primera ejecución escribe la imagen en el directorio temporal (mp_bench_raster.ppm)
+ *  para poder revisarla sin OpenGL.
+ */
+
+#include "Benchmark.h"
+
+#include "../Coin.h"
+#include "../Enemies/Zombie.h"
+#include "../Heroes/Aaron_Inti.h"
+#include "../Render/SoftwareRasterizer.h"
+
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr int WIDTH = 640;
+    constexpr int HEIGHT = 360;
+    constexpr int NUM_ZOMBIES = 128;
+    constexpr int NUM_COINS = 64;
+
+    struct Scene {
+        FrameView view;
+        SceneLights lights;
+        std::vector<DrawItem> drawItems;
+    };
+
+    // Las luces de MP::mSetupScene() y una cámara que mira a la multitud desde arriba
+    const Scene& benchScene() {
+        static const Scene SCENE = [] {
+            Scene scene;
+            scene.view.viewMtx = glm::lookAt(glm::vec3(0.0f, 14.0f, 30.0f), glm::vec3(0.0f, 0.0f, 6.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+            scene.view.projMtx = glm::perspective(glm::radians(45.0f), static_cast<float>(WIDTH) / HEIGHT, 0.1f, 1000.0f);
+            scene.view.eyePosition = glm::vec3(0.0f, 14.0f, 30.0f);
+
+            scene.lights.directional = { glm::vec3(-1.0f, -1.0f, 1.0f), glm::vec3(0.2f), glm::vec3(1.0f), glm::vec3(1.0f) };
+            scene.lights.points[0] = { glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(0.9f, 0.8f, 0.4f), 1.0f, 0.7f, 0.1f };
+            scene.lights.numPointLights = 1;
+            scene.lights.spot = { glm::vec3(-2.0f, 5.0f, -2.0f), glm::vec3(0.0f, -1.0f, 0.0f), glm::vec3(0.7f),
+                                  glm::cos(glm::radians(15.0f)), glm::cos(glm::radians(20.0f)), 30.0f, 1.0f, 0.7f, 0.1f };
+
+            const Aaron_Inti hero;
+            hero.emitDrawItems(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 1.3f, 0.0f)), scene.drawItems);
+            for (int z = 0; z < NUM_ZOMBIES; ++z) {
+                Zombie zombie;
+                zombie.setPosition(glm::vec3(static_cast<float>(z % 16) * 2.0f - 15.0f, 0.0f, static_cast<float>(z / 16) * 2.0f));
+                zombie.emitDrawItems(glm::mat4(1.0f), scene.drawItems);
+            }
+            const Coin coin;
+            for (int c = 0; c < NUM_COINS; ++c) {
+                const float angle = glm::two_pi<float>() * static_cast<float>(c) / NUM_COINS;
+                coin.emitDrawItems(glm::translate(glm::mat4(1.0f), glm::vec3(12.0f * cosf(angle), 1.2f, 12.0f * sinf(angle) + 6.0f)), scene.drawItems);
+            }
+            return scene;
+        }();
+        return SCENE;
+    }
+
+    void publishStats(const SoftwareRasterizer& rasterizer) {
+        const SoftwareRasterizer::Stats& stats = rasterizer.getStats();
+        Bench::setCounter("threads", static_cast<double>(rasterizer.getNumThreads()));
+        Bench::setCounter("triangles", static_cast<double>(stats.trianglesSubmitted));
+        Bench::setCounter("trianglesBinned", static_cast<double>(stats.trianglesBinned));
+        Bench::setCounter("fragments", static_cast<double>(stats.fragmentsWritten));
+    }
+
+    // Imagen de referencia en un hilo; también se escribe al disco la primera vez
+    const std::vector<uint8_t>& referenceImage() {
+        static const std::vector<uint8_t> IMAGE = [] {
+            const Scene& scene = benchScene();
+            SoftwareRasterizer rasterizer;
+            SoftwareRasterizer::Settings settings;
+            settings.width = WIDTH;
+            settings.height = HEIGHT;
+            settings.numThreads = 1;
+            rasterizer.start(settings);
+            rasterizer.render(scene.view, scene.lights, scene.drawItems);
+
+            const std::string filename = (std::filesystem::temp_directory_path() / "mp_bench_raster.ppm").string();
+            if (rasterizer.writePPM(filename.c_str())) {
+                fprintf(stdout, "[INFO]: Software rasterizer image written to %s\n", filename.c_str());
+            }
+            return rasterizer.getColorBuffer();
+        }();
+        return IMAGE;
+    }
+
+    void rasterScene(size_t ITERATIONS, int numThreads) {
+        const Scene& scene = benchScene();
+        SoftwareRasterizer rasterizer;
+        SoftwareRasterizer::Settings settings;
+        settings.width = WIDTH;
+        settings.height = HEIGHT;
+        settings.numThreads = numThreads;
+        rasterizer.start(settings);
+
+        for (size_t i = 0; i < ITERATIONS; ++i) {
+            rasterizer.render(scene.view, scene.lights, scene.drawItems);
+            Bench::doNotOptimize(rasterizer.getColorBuffer().data());
+        }
+        publishStats(rasterizer);
+
+        const std::vector<uint8_t>& reference = referenceImage();
+        const std::vector<uint8_t>& image = rasterizer.getColorBuffer();
+        size_t differentPixels = 0;
+        for (size_t p = 0; p + 2 < image.size(); p += 3) {
+            differentPixels += image[p] != reference[p] || image[p + 1] != reference[p + 1] || image[p + 2] != reference[p + 2];
+        }
+        Bench::expectAtMost("pixelsDifferentFrom1Thread", static_cast<double>(differentPixels), 0.0);
+    }
+
+    void softwareRaster1Thread(size_t ITERATIONS) {
+        rasterScene(ITERATIONS, 1);
+    }
+    MP_BENCHMARK_ITEMS(softwareRaster1Thread, static_cast<double>(WIDTH) * HEIGHT);
+
+    void softwareRasterThreads(size_t ITERATIONS) {
+        rasterScene(ITERATIONS, 0);
+    }
+    MP_BENCHMARK_ITEMS(softwareRasterThreads, static_cast<double>(WIDTH) * HEIGHT);
+}
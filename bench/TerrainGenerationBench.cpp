@@ -0,0 +1,65 @@
+/*
+ *  Throughput de TerrainGenerator::generateHeightfield en tiles por segundo con 1, 2, 4 y
+ *  tantos hilos como núcleos.
+ *
+ *  Cada muestra también compara el heightfield con el generado por un solo hilo: si algún
+ *  bit difiere, el reparto entre hilos cambió el resultado y se reporta un error.
+ */
+
+#include "Benchmark.h"
+
+#include "../Terrain/TerrainGenerator.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+    // Mapa de 8x8 tiles de 32x32 muestras
+    constexpr int TILE_SIZE = 32;
+    constexpr int TILES_PER_SIDE = 8;
+    constexpr int SAMPLES_PER_SIDE = TILE_SIZE * TILES_PER_SIDE;
+    constexpr double TILES_PER_MAP = TILES_PER_SIDE * TILES_PER_SIDE;
+    constexpr uint32_t SEED = 12345u;
+
+    void generateMap(int numThreads, std::vector<float>& heights) {
+        TerrainGenerator::Settings settings;
+        settings.tileSize = TILE_SIZE;
+        settings.numThreads = numThreads;
+        heights.resize(static_cast<size_t>(SAMPLES_PER_SIDE) * SAMPLES_PER_SIDE);
+        TerrainGenerator(settings).generateHeightfield(SEED, -105.0f, -105.0f, 210.0f / SAMPLES_PER_SIDE, 0, 0,
+                                                       SAMPLES_PER_SIDE, SAMPLES_PER_SIDE, 10.0f, heights.data());
+    }
+
+    const std::vector<float>& singleThreadReference() {
+        static std::vector<float> reference;
+        if(reference.empty()) generateMap(1, reference);
+        return reference;
+    }
+
+    void runGeneration(int numThreads, size_t ITERATIONS) {
+        static std::vector<float> heights;
+        for(size_t i = 0; i < ITERATIONS; ++i) {
+            generateMap(numThreads, heights);
+            Bench::doNotOptimize(heights.data());
+        }
+
+        const std::vector<float>& reference = singleThreadReference();
+        if(memcmp(heights.data(), reference.data(), reference.size() * sizeof(float)) != 0) {
+            fprintf(stderr, "[ERROR]: Heightfield generated with %d threads differs from the single-thread result\n", numThreads);
+        }
+    }
+
+    void terrainTiles1Thread(size_t ITERATIONS) { runGeneration(1, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(terrainTiles1Thread, TILES_PER_MAP);
+
+    void terrainTiles2Threads(size_t ITERATIONS) { runGeneration(2, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(terrainTiles2Threads, TILES_PER_MAP);
+
+    void terrainTiles4Threads(size_t ITERATIONS) { runGeneration(4, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(terrainTiles4Threads, TILES_PER_MAP);
+
+    // numThreads = 0: un hilo por núcleo
+    void terrainTilesAllCores(size_t ITERATIONS) { runGeneration(0, ITERATIONS); }
+    MP_BENCHMARK_ITEMS(terrainTilesAllCores, TILES_PER_MAP);
+}
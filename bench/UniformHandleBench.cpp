@@ -0,0 +1,90 @@
+/*
+ *  Costo por llamada de setProgramUniform por nombre vs. con UniformHandle.
+ *
+ *  No hay contexto OpenGL: las funciones de glad que usa ShaderProgram se reemplazan por
+ *  stubs vacíos, de modo que solo se mide el trabajo de CPU previo a la llamada al driver.
+ */
+
+#include "Benchmark.h"
+
+#include <ShaderProgram.hpp>
+
+namespace {
+    GLuint sUniformCalls = 0;
+
+    void GLAD_API_PTR stubProgramUniformMatrix4fv(GLuint, GLint, GLsizei, GLboolean, const GLfloat*) { sUniformCalls++; }
+    void GLAD_API_PTR stubDeleteProgram(GLuint) {}
+    void GLAD_API_PTR stubGetProgramiv(GLuint, GLenum, GLint* params) { *params = 0; }
+    void GLAD_API_PTR stubGetProgramInfoLog(GLuint, GLsizei, GLsizei* length, GLchar*) { if(length) *length = 0; }
+
+    // Programa con los mismos uniforms que A3.v.glsl + skybox, cargados a mano en los mapas
+    class BenchShaderProgram final : public CSCI441::ShaderProgram {
+    public:
+        BenchShaderProgram() {
+            glad_glProgramUniformMatrix4fv = stubProgramUniformMatrix4fv;
+            glad_glDeleteProgram = stubDeleteProgram;
+            glad_glGetProgramiv = stubGetProgramiv;
+            glad_glGetProgramInfoLog = stubGetProgramInfoLog;
+
+            const char* UNIFORM_NAMES[] = {
+                "mvpMatrix", "normalMatrix", "eyePosition",
+                "materialAmbientColor", "materialDiffuseColor", "materialSpecularColor", "materialShininess",
+                "lightDirection", "lightAmbientColor", "lightDiffuseColor", "lightSpecularColor",
+                "pointLightPos", "pointLightColor", "pointLightConstant", "pointLightLinear", "pointLightQuadratic",
+                "spotLightPos", "spotLightDirection", "spotLightColor", "spotLightCutoff", "spotLightOuterCutoff",
+                "spotLightExponent", "spotLightConstant", "spotLightLinear", "spotLightQuadratic",
+                "view", "projection"
+            };
+
+            mpUniformLocationsMap = new std::map<std::string, GLint, std::less<>>();
+            mpUniformLocationsByHashMap = new std::unordered_map<uint64_t, GLint>();
+            mpAttributeLocationsMap = new std::map<std::string, GLint, std::less<>>();
+            GLint location = 0;
+            for(const char* name : UNIFORM_NAMES) {
+                mpUniformLocationsMap->emplace(name, location);
+                mpUniformLocationsByHashMap->emplace(CSCI441_INTERNAL::ShaderUtils::hashStringFNV1a(name), location);
+                location++;
+            }
+        }
+    };
+
+    const BenchShaderProgram& benchProgram() {
+        static BenchShaderProgram program;
+        return program;
+    }
+
+    void uniformByName(size_t iterations) {
+        const auto& program = benchProgram();
+        glm::mat4 mtx(1.0f);
+        for(size_t i = 0; i < iterations; ++i) {
+            mtx[3][0] = (float)i;
+            program.setProgramUniform("view", mtx);
+            program.setProgramUniform("projection", mtx);
+        }
+        Bench::doNotOptimize(sUniformCalls);
+    }
+    MP_BENCHMARK(uniformByName);
+
+    void uniformByHandle(size_t iterations) {
+        const auto& program = benchProgram();
+        static const auto VIEW = program.getUniformHandle<glm::mat4>("view");
+        static const auto PROJECTION = program.getUniformHandle<glm::mat4>("projection");
+        glm::mat4 mtx(1.0f);
+        for(size_t i = 0; i < iterations; ++i) {
+            mtx[3][0] = (float)i;
+            program.setProgramUniform(VIEW, mtx);
+            program.setProgramUniform(PROJECTION, mtx);
+        }
+        Bench::doNotOptimize(sUniformCalls);
+    }
+    MP_BENCHMARK(uniformByHandle);
+
+    void uniformHandleResolve(size_t iterations) {
+        const auto& program = benchProgram();
+        for(size_t i = 0; i < iterations; ++i) {
+            auto handle = program.getUniformHandle<glm::mat4>("spotLightQuadratic");
+            Bench::doNotOptimize(handle);
+        }
+    }
+    MP_BENCHMARK(uniformHandleResolve);
+}
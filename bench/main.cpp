@@ -0,0 +1,39 @@
+/*
+ *  mp_bench: microbenchmarks de CPU del motor MP.
+ *
+ *  Uso: mp_bench [--filter <texto>] [--json <archivo>]
+ *      --filter  solo ejecuta los benchmarks cuyo nombre contiene <texto>
+ *      --json    además escribe los resultados en <archivo> para compararlos entre builds
+ *
+ *  Termina con error si algún benchmark supera uno de sus presupuestos (Bench::expectAtMost).
+ */
+
+#include "Benchmark.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    std::string filter;
+    const char* jsonFilename = nullptr;
+
+    for(int i = 1; i < argc; ++i) {
+        if(strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if(strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonFilename = argv[++i];
+        } else {
+            fprintf(stderr, "Uso: %s [--filter <texto>] [--json <archivo>]\n", argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto results = Bench::runAll(filter);
+    if(jsonFilename != nullptr && !Bench::writeJSON(results, jsonFilename)) {
+        return EXIT_FAILURE;
+    }
+
+    return Bench::hasFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -13,16 +13,173 @@
  */
 
 #include "MP.h"
+#include "Memory/AllocationTracker.h"
 
+#include <cstdlib>
+#include <cstring>
 
 
 
 ///*****************************************************************************
 //
 // Our main function
-int main() {
+int main(int argc, char* argv[]) {
 
     auto labEngine = new MP();
+
+    // --single-thread: simular y dibujar en el mismo hilo (para comparar con el hilo de render)
+    // --multiview: dibujar todas las vistas en una sola pasada instanciada
+    // --record <archivo> / --replay <archivo>: grabar o reproducir la entrada de una sesión
+    // --no-dynamic-resolution, --dynres-scale <min> <max>, --dynres-target-ms <ms>,
+    // --dynres-hysteresis <fracción>: configuración del escalado dinámico de resolución
+    // --inset-scale <fracción>, --inset-interval <frames>, --inset-on-move: vista superpuesta
+    // --terrain-budget <triángulos>, --terrain-height <altura>: configuración del terreno
+    // --generator-threads <hilos>: hilos que generan el terreno (0 = uno por núcleo)
+    // --stream-radius <tiles>, --stream-budget-mb <MB>, --stream-threads <hilos>: carga del mundo por tiles
+    // --coins-per-tile <monedas>, --zombies-per-coin <zombies>: cuántas entidades tiene cada tile
+    // --flow-field-cells <celdas>, --flow-field-sync: campo de direcciones de los zombies
+    // --no-crowd-avoidance, --crowd-threads <hilos>: evasión entre zombies
+    // --no-ai-lod, --ai-lod-budget <zombies>: actualizar con menos frecuencia los zombies lejanos
+    // --track-allocations, --no-frame-allocations <frames>: contar las reservas del heap por frame
+    // y, con la segunda, fallar si algún frame posterior al calentamiento reserva
+    // --gl-calls, --gl-trace <archivo>: contar las llamadas GL por frame y categoría y, con la
+    // segunda, escribir cada llamada al archivo
+    // --seed <semilla>: semilla fija del mundo en lugar de la hora actual
+    // --stress-config <archivo>, --stress-zombies <n>, --stress-coins <n>, --stress-lights <n>,
+    // --stress-models <n> <modelo>, --stress-radius <unidades>, --stress-results <csv>: escena de
+    // prueba con cantidades fijas alrededor del origen y una fila de resultados por ejecución
+    // --software-capture <archivo.ppm>: al cerrar, dibujar el último frame en la CPU y guardarlo
+    DynamicResolution::Settings dynamicResolutionSettings;
+    OffscreenInset::Settings insetSettings;
+    Terrain::Settings terrainSettings;
+    WorldStreamer::Settings worldStreamerSettings;
+    FlowField::Settings flowFieldSettings;
+    CrowdAvoidance::Settings crowdAvoidanceSettings;
+    AgentUpdateScheduler::Settings agentUpdateSettings;
+    StressScene::Settings stressSceneSettings;
+    long long seed = -1;
+    // La grabación guarda la semilla al abrirse: se abre después de leer --seed
+    const char* recordFilename = nullptr;
+    const char* replayFilename = nullptr;
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--single-thread") == 0) {
+            labEngine->setRenderThreadEnabled(false);
+        } else if (strcmp(argv[i], "--multiview") == 0) {
+            labEngine->setMultiViewEnabled(true);
+        } else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc) {
+            recordFilename = argv[++i];
+        } else if (strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            replayFilename = argv[++i];
+        } else if (strcmp(argv[i], "--no-dynamic-resolution") == 0) {
+            dynamicResolutionSettings.enabled = false;
+        } else if (strcmp(argv[i], "--dynres-scale") == 0 && i + 2 < argc) {
+            dynamicResolutionSettings.minScale = static_cast<float>(atof(argv[++i]));
+            dynamicResolutionSettings.maxScale = static_cast<float>(atof(argv[++i]));
+        } else if (strcmp(argv[i], "--dynres-target-ms") == 0 && i + 1 < argc) {
+            dynamicResolutionSettings.targetFrameMs = static_cast<float>(atof(argv[++i]));
+        } else if (strcmp(argv[i], "--dynres-hysteresis") == 0 && i + 1 < argc) {
+            dynamicResolutionSettings.hysteresis = static_cast<float>(atof(argv[++i]));
+        } else if (strcmp(argv[i], "--inset-scale") == 0 && i + 1 < argc) {
+            insetSettings.resolutionScale = static_cast<float>(atof(argv[++i]));
+        } else if (strcmp(argv[i], "--inset-interval") == 0 && i + 1 < argc) {
+            insetSettings.updateInterval = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--inset-on-move") == 0) {
+            insetSettings.updateOnlyOnViewChange = true;
+        } else if (strcmp(argv[i], "--terrain-budget") == 0 && i + 1 < argc) {
+            terrainSettings.triangleBudget = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--terrain-height") == 0 && i + 1 < argc) {
+            terrainSettings.maxHeight = static_cast<float>(atof(argv[++i]));
+        } else if (strcmp(argv[i], "--generator-threads") == 0 && i + 1 < argc) {
+            terrainSettings.generatorThreads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--stream-radius") == 0 && i + 1 < argc) {
+            worldStreamerSettings.loadRadius = atoi(argv[++i]);
+            worldStreamerSettings.unloadRadius = worldStreamerSettings.loadRadius + 1;
+        } else if (strcmp(argv[i], "--stream-budget-mb") == 0 && i + 1 < argc) {
+            worldStreamerSettings.memoryBudgetBytes = static_cast<size_t>(std::max(atoi(argv[++i]), 1)) << 20;
+        } else if (strcmp(argv[i], "--stream-threads") == 0 && i + 1 < argc) {
+            worldStreamerSettings.numThreads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--coins-per-tile") == 0 && i + 1 < argc) {
+            worldStreamerSettings.coinsPerTile = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--zombies-per-coin") == 0 && i + 1 < argc) {
+            worldStreamerSettings.zombiesPerCoin = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--flow-field-cells") == 0 && i + 1 < argc) {
+            flowFieldSettings.cellsPerSide = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--flow-field-sync") == 0) {
+            flowFieldSettings.asynchronous = false;
+        } else if (strcmp(argv[i], "--no-crowd-avoidance") == 0) {
+            crowdAvoidanceSettings.enabled = false;
+        } else if (strcmp(argv[i], "--crowd-threads") == 0 && i + 1 < argc) {
+            crowdAvoidanceSettings.numThreads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--no-ai-lod") == 0) {
+            agentUpdateSettings.enabled = false;
+        } else if (strcmp(argv[i], "--ai-lod-budget") == 0 && i + 1 < argc) {
+            agentUpdateSettings.groupBudget = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--track-allocations") == 0) {
+            AllocationTracker::enable();
+        } else if (strcmp(argv[i], "--no-frame-allocations") == 0 && i + 1 < argc) {
+            AllocationTracker::assertNoFrameAllocations(static_cast<size_t>(std::max(atoi(argv[++i]), 0)));
+            AllocationTracker::enable();
+        } else if (strcmp(argv[i], "--gl-calls") == 0) {
+            labEngine->enableGLCallTracing();
+        } else if (strcmp(argv[i], "--gl-trace") == 0 && i + 1 < argc) {
+            labEngine->enableGLCallTracing(argv[++i]);
+        } else if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = strtoll(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--stress-config") == 0 && i + 1 < argc) {
+            if (!StressScene::loadConfig(argv[++i], stressSceneSettings)) {
+                delete labEngine;
+                return EXIT_FAILURE;
+            }
+        } else if (strcmp(argv[i], "--stress-zombies") == 0 && i + 1 < argc) {
+            stressSceneSettings.numZombies = atoi(argv[++i]);
+            stressSceneSettings.enabled = true;
+        } else if (strcmp(argv[i], "--stress-coins") == 0 && i + 1 < argc) {
+            stressSceneSettings.numCoins = atoi(argv[++i]);
+            stressSceneSettings.enabled = true;
+        } else if (strcmp(argv[i], "--stress-lights") == 0 && i + 1 < argc) {
+            stressSceneSettings.numPointLights = atoi(argv[++i]);
+            stressSceneSettings.enabled = true;
+        } else if (strcmp(argv[i], "--stress-models") == 0 && i + 2 < argc) {
+            stressSceneSettings.numModels = atoi(argv[++i]);
+            stressSceneSettings.modelFilename = argv[++i];
+            stressSceneSettings.enabled = true;
+        } else if (strcmp(argv[i], "--stress-radius") == 0 && i + 1 < argc) {
+            stressSceneSettings.radius = static_cast<float>(atof(argv[++i]));
+            stressSceneSettings.enabled = true;
+        } else if (strcmp(argv[i], "--stress-results") == 0 && i + 1 < argc) {
+            stressSceneSettings.resultsFilename = argv[++i];
+            stressSceneSettings.enabled = true;
+        } else if (strcmp(argv[i], "--software-capture") == 0 && i + 1 < argc) {
+            labEngine->setSoftwareCapture(argv[++i]);
+        }
+    }
+
+    // La semilla de la línea de comandos tiene prioridad sobre la del archivo de configuración
+    if (seed < 0) {
+        seed = stressSceneSettings.seed;
+    }
+    if (seed >= 0) {
+        labEngine->setRandomSeed(static_cast<uint32_t>(seed));
+    }
+    if (recordFilename != nullptr) {
+        labEngine->recordInputTo(recordFilename);
+    }
+    if (replayFilename != nullptr) {
+        labEngine->replayInputFrom(replayFilename);
+    }
+    // Los resultados incluyen el pico de memoria, que solo se cuenta con el tracker activo
+    if (stressSceneSettings.enabled && !stressSceneSettings.resultsFilename.empty()) {
+        AllocationTracker::enable();
+    }
+    labEngine->setDynamicResolutionSettings(dynamicResolutionSettings);
+    labEngine->setInsetSettings(insetSettings);
+    labEngine->setTerrainSettings(terrainSettings);
+    labEngine->setWorldStreamerSettings(worldStreamerSettings);
+    labEngine->setFlowFieldSettings(flowFieldSettings);
+    labEngine->setCrowdAvoidanceSettings(crowdAvoidanceSettings);
+    labEngine->setAgentUpdateSettings(agentUpdateSettings);
+    labEngine->setStressSceneSettings(stressSceneSettings);
+
     labEngine->initialize();
     if (labEngine->getError() == CSCI441::OpenGLEngine::OPENGL_ENGINE_ERROR_NO_ERROR) {
         labEngine->run();
@@ -30,5 +187,6 @@ int main() {
     labEngine->shutdown();
     delete labEngine;
 
-	return EXIT_SUCCESS;
+    AllocationTracker::printReport();
+	return AllocationTracker::hasFailed() ? EXIT_FAILURE : EXIT_SUCCESS;
 }
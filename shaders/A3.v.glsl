@@ -1,124 +1,266 @@
 #version 410 core
 
+// Permutation defines (inyectados por ShaderPermutationCache, valores por defecto abajo)
+#ifndef NUM_DIRECTIONAL_LIGHTS
+#define NUM_DIRECTIONAL_LIGHTS 1
+#endif
+#ifndef NUM_POINT_LIGHTS
+#define NUM_POINT_LIGHTS 1
+#endif
+#ifndef NUM_SPOT_LIGHTS
+#define NUM_SPOT_LIGHTS 1
+#endif
+
+#define LIGHTING_MODEL_LAMBERT 0
+#define LIGHTING_MODEL_PHONG 1
+#ifndef LIGHTING_MODEL
+#define LIGHTING_MODEL LIGHTING_MODEL_PHONG
+#endif
+
+#ifndef USE_SKINNING
+#define USE_SKINNING 0
+#endif
+#ifndef USE_INSTANCING
+#define USE_INSTANCING 0
+#endif
+
+// Multi-view: cada instancia dibuja el objeto en una vista distinta
+#ifndef USE_MULTIVIEW
+#define USE_MULTIVIEW 0
+#endif
+#ifndef MULTIVIEW_VS_VIEWPORT_INDEX
+#define MULTIVIEW_VS_VIEWPORT_INDEX 0
+#endif
+#ifndef MAX_VIEWS
+#define MAX_VIEWS 2
+#endif
+
+#if USE_MULTIVIEW && USE_INSTANCING
+#error "USE_MULTIVIEW uses gl_InstanceID to select the view and cannot be combined with USE_INSTANCING"
+#endif
+#if USE_MULTIVIEW && MULTIVIEW_VS_VIEWPORT_INDEX
+#extension GL_ARB_shader_viewport_layer_array : require
+#endif
+
 // Uniform inputs
+#if USE_MULTIVIEW
+layout(std140) uniform ViewBlock {
+    mat4 viewProjectionMatrices[MAX_VIEWS]; // View-Projection Matrix of every view
+    vec4 eyePositions[MAX_VIEWS];           // Eye position of every view, w unused
+};
+uniform mat4 modelMatrix;               // Model Matrix, shared by all views
+uniform mat3 normalMatrix;              // Normal matrix
+#elif USE_INSTANCING
+uniform mat4 viewProjectionMatrix;      // View-Projection Matrix, model matrix is per instance
+uniform vec3 eyePosition;               // Eye position
+#else
 uniform mat4 mvpMatrix;                 // Model-View-Projection Matrix
 uniform mat3 normalMatrix;              // Normal matrix
 uniform vec3 eyePosition;               // Eye position
+#endif
 
 // Attribute inputs
 layout(location = 0) in vec3 vPos;      // Vertex position
 layout(location = 1) in vec3 vNormal;   // Vertex normal
 
+#if USE_SKINNING
+#ifndef MAX_BONES
+#define MAX_BONES 64
+#endif
+uniform mat4 boneMatrices[MAX_BONES];
+layout(location = 6) in ivec4 vBoneIndices; // Indices de los huesos que afectan al vertice
+layout(location = 7) in vec4 vBoneWeights;  // Pesos de cada hueso
+#endif
+
+#if USE_INSTANCING
+layout(location = 8) in mat4 vInstanceModelMatrix; // Ocupa las ubicaciones 8 a 11
+layout(location = 12) in vec3 vInstanceColor;       // ambiente = color * 0.2, difuso = color
+#endif
+
 // Material properties
+#if USE_INSTANCING
+vec3 materialAmbientColor;              // Se toman de vInstanceColor al empezar main()
+vec3 materialDiffuseColor;
+#else
 uniform vec3 materialAmbientColor;
 uniform vec3 materialDiffuseColor;
+#endif
+#if LIGHTING_MODEL == LIGHTING_MODEL_PHONG
 uniform vec3 materialSpecularColor;
 uniform float materialShininess;
+#endif
 
 // Directional Light properties
-uniform vec3 lightDirection;
-uniform vec3 lightAmbientColor;
-uniform vec3 lightDiffuseColor;
-uniform vec3 lightSpecularColor;
+#if NUM_DIRECTIONAL_LIGHTS > 0
+uniform vec3 lightDirection[NUM_DIRECTIONAL_LIGHTS];
+uniform vec3 lightAmbientColor[NUM_DIRECTIONAL_LIGHTS];
+uniform vec3 lightDiffuseColor[NUM_DIRECTIONAL_LIGHTS];
+#if LIGHTING_MODEL == LIGHTING_MODEL_PHONG
+uniform vec3 lightSpecularColor[NUM_DIRECTIONAL_LIGHTS];
+#endif
+#endif
 
 // Point Light properties
-uniform vec3 pointLightPos;
-uniform vec3 pointLightColor;
-uniform float pointLightConstant;
-uniform float pointLightLinear;
-uniform float pointLightQuadratic;
+#if NUM_POINT_LIGHTS > 0
+uniform vec3 pointLightPos[NUM_POINT_LIGHTS];
+uniform vec3 pointLightColor[NUM_POINT_LIGHTS];
+uniform float pointLightConstant[NUM_POINT_LIGHTS];
+uniform float pointLightLinear[NUM_POINT_LIGHTS];
+uniform float pointLightQuadratic[NUM_POINT_LIGHTS];
+#endif
 
 // Spotlight properties
-uniform vec3 spotLightPos;
-uniform vec3 spotLightDirection;
-uniform vec3 spotLightColor;
-uniform float spotLightCutoff;
-uniform float spotLightOuterCutoff;
-uniform float spotLightExponent;
-uniform float spotLightConstant;
-uniform float spotLightLinear;
-uniform float spotLightQuadratic;
+#if NUM_SPOT_LIGHTS > 0
+uniform vec3 spotLightPos[NUM_SPOT_LIGHTS];
+uniform vec3 spotLightDirection[NUM_SPOT_LIGHTS];
+uniform vec3 spotLightColor[NUM_SPOT_LIGHTS];
+uniform float spotLightCutoff[NUM_SPOT_LIGHTS];
+uniform float spotLightOuterCutoff[NUM_SPOT_LIGHTS];
+uniform float spotLightExponent[NUM_SPOT_LIGHTS];
+uniform float spotLightConstant[NUM_SPOT_LIGHTS];
+uniform float spotLightLinear[NUM_SPOT_LIGHTS];
+uniform float spotLightQuadratic[NUM_SPOT_LIGHTS];
+#endif
 
 // Varying outputs
 layout(location = 0) out vec3 color;    // Color to pass to fragment shader
+#if USE_MULTIVIEW && !MULTIVIEW_VS_VIEWPORT_INDEX
+layout(location = 1) flat out int viewIndex; // View for shaders/multiview.g.glsl to route the triangle to
+#endif
+
+#if LIGHTING_MODEL == LIGHTING_MODEL_PHONG
+float calculateSpecularFactor(vec3 normal, vec3 lightVector, vec3 viewVector) {
+    vec3 reflectVector = reflect(-lightVector, normal);
+    return pow(max(dot(viewVector, reflectVector), 0.0), materialShininess);
+}
+#endif
 
-vec3 calculateDirectionalLight(vec3 normal, vec3 viewVector) {
+#if NUM_DIRECTIONAL_LIGHTS > 0
+vec3 calculateDirectionalLight(int i, vec3 normal, vec3 viewVector) {
     // Compute light vector
-    vec3 lightVector = normalize(-lightDirection);
+    vec3 lightVector = normalize(-lightDirection[i]);
 
     // Ambient component
-    vec3 ambient = lightAmbientColor * materialAmbientColor;
+    vec3 ambient = lightAmbientColor[i] * materialAmbientColor;
 
     // Diffuse component
     float diffuseFactor = max(dot(normal, lightVector), 0.0);
-    vec3 diffuse = lightDiffuseColor * materialDiffuseColor * diffuseFactor;
-
-    // Specular component
-    vec3 reflectVector = reflect(-lightVector, normal);
-    float specularFactor = pow(max(dot(viewVector, reflectVector), 0.0), materialShininess);
-    vec3 specular = lightSpecularColor * materialSpecularColor * specularFactor;
+    vec3 diffuse = lightDiffuseColor[i] * materialDiffuseColor * diffuseFactor;
 
     // Sum all components
+#if LIGHTING_MODEL == LIGHTING_MODEL_PHONG
+    vec3 specular = lightSpecularColor[i] * materialSpecularColor * calculateSpecularFactor(normal, lightVector, viewVector);
     return ambient + diffuse + specular;
+#else
+    return ambient + diffuse;
+#endif
 }
+#endif
 
-vec3 calculatePointLight(vec3 normal, vec3 fragPosition, vec3 viewVector) {
-    vec3 lightDirection = normalize(pointLightPos - fragPosition);
+#if NUM_POINT_LIGHTS > 0
+vec3 calculatePointLight(int i, vec3 normal, vec3 fragPosition, vec3 viewVector) {
+    vec3 lightDirection = normalize(pointLightPos[i] - fragPosition);
     float difference = max(dot(normal, lightDirection), 0.0);
-    vec3 reflectDirection = reflect(-lightDirection, normal);
-    float specularFactor = pow(max(dot(viewVector, reflectDirection), 0.0), materialShininess);
-
-    float distance = length(pointLightPos - fragPosition);
-    float attenuation = 1.0 / (pointLightConstant + pointLightLinear * distance + pointLightQuadratic * (distance * distance));
 
-    vec3 ambient = pointLightColor * materialAmbientColor;
-    vec3 diffuse = difference * pointLightColor;
-    vec3 specular = specularFactor * pointLightColor;
+    float distance = length(pointLightPos[i] - fragPosition);
+    float attenuation = 1.0 / (pointLightConstant[i] + pointLightLinear[i] * distance + pointLightQuadratic[i] * (distance * distance));
 
+    vec3 ambient = pointLightColor[i] * materialAmbientColor;
+    vec3 diffuse = difference * pointLightColor[i];
+#if LIGHTING_MODEL == LIGHTING_MODEL_PHONG
+    vec3 specular = calculateSpecularFactor(normal, lightDirection, viewVector) * pointLightColor[i];
     return (ambient + diffuse + specular) * attenuation;
+#else
+    return (ambient + diffuse) * attenuation;
+#endif
 }
+#endif
 
-vec3 calculateSpotlight(vec3 normal, vec3 fragPosition, vec3 viewVector) {
-    vec3 lightDirection = normalize(spotLightPos - fragPosition);
-    float theta = dot(lightDirection, normalize(-spotLightDirection));
+#if NUM_SPOT_LIGHTS > 0
+vec3 calculateSpotlight(int i, vec3 normal, vec3 fragPosition, vec3 viewVector) {
+    vec3 lightDirection = normalize(spotLightPos[i] - fragPosition);
+    float theta = dot(lightDirection, normalize(-spotLightDirection[i]));
 
-    if (theta > spotLightCutoff) {
+    if (theta > spotLightCutoff[i]) {
         float difference = max(dot(normal, lightDirection), 0.0);
-        vec3 reflectDirection = reflect(-lightDirection, normal);
-        float specularFactor = pow(max(dot(viewVector, reflectDirection), 0.0), materialShininess);
 
-        float distance = length(spotLightPos - fragPosition);
-        float attenuation = 1.0 / (spotLightConstant + spotLightLinear * distance + spotLightQuadratic * (distance * distance));
+        float distance = length(spotLightPos[i] - fragPosition);
+        float attenuation = 1.0 / (spotLightConstant[i] + spotLightLinear[i] * distance + spotLightQuadratic[i] * (distance * distance));
 
-        float intensity = clamp((theta - spotLightOuterCutoff) / (spotLightCutoff - spotLightOuterCutoff), 0.0, 1.0);
-        intensity = pow(intensity, spotLightExponent);
-
-        vec3 ambient = spotLightColor * materialAmbientColor;
-        vec3 diffuse = difference * spotLightColor;
-        vec3 specular = specularFactor * spotLightColor;
+        float intensity = clamp((theta - spotLightOuterCutoff[i]) / (spotLightCutoff[i] - spotLightOuterCutoff[i]), 0.0, 1.0);
+        intensity = pow(intensity, spotLightExponent[i]);
 
+        vec3 ambient = spotLightColor[i] * materialAmbientColor;
+        vec3 diffuse = difference * spotLightColor[i];
+#if LIGHTING_MODEL == LIGHTING_MODEL_PHONG
+        vec3 specular = calculateSpecularFactor(normal, lightDirection, viewVector) * spotLightColor[i];
         return (ambient + diffuse + specular) * intensity * attenuation;
+#else
+        return (ambient + diffuse) * intensity * attenuation;
+#endif
     }
 
     return vec3(0.0); // Outside spotlight cone
 }
+#endif
 
 void main() {
-    // Transform & output the vertex in clip space
-    gl_Position = mvpMatrix * vec4(vPos, 1.0);
+    vec4 position = vec4(vPos, 1.0);
+    vec3 objectNormal = vNormal;
+
+#if USE_INSTANCING
+    materialAmbientColor = vInstanceColor * 0.2;
+    materialDiffuseColor = vInstanceColor;
+#endif
 
-    // Transform normal vector
-    vec3 normal = normalize(normalMatrix * vNormal);
+#if USE_SKINNING
+    mat4 skinMatrix = vBoneWeights.x * boneMatrices[vBoneIndices.x]
+                    + vBoneWeights.y * boneMatrices[vBoneIndices.y]
+                    + vBoneWeights.z * boneMatrices[vBoneIndices.z]
+                    + vBoneWeights.w * boneMatrices[vBoneIndices.w];
+    position = skinMatrix * position;
+    objectNormal = mat3(skinMatrix) * objectNormal;
+#endif
+
+    // Transform & output the vertex in clip space
+#if USE_MULTIVIEW
+    int view = gl_InstanceID;
+    gl_Position = viewProjectionMatrices[view] * modelMatrix * position;
+    vec3 normal = normalize(normalMatrix * objectNormal);
+    vec3 eyePosition = eyePositions[view].xyz;
+#if MULTIVIEW_VS_VIEWPORT_INDEX
+    gl_ViewportIndex = view;
+#else
+    viewIndex = view;
+#endif
+#elif USE_INSTANCING
+    position = vInstanceModelMatrix * position;
+    gl_Position = viewProjectionMatrix * position;
+    vec3 normal = normalize(transpose(inverse(mat3(vInstanceModelMatrix))) * objectNormal);
+#else
+    gl_Position = mvpMatrix * position;
+    vec3 normal = normalize(normalMatrix * objectNormal);
+#endif
 
     // Compute view vector
-    vec3 fragmentPos = vec3(vPos);
+    vec3 fragmentPos = vec3(position);
     vec3 viewVector = normalize(eyePosition - fragmentPos);
 
-    // Calculate all light sources
-    vec3 directionalLight = calculateDirectionalLight(normal, viewVector);
-    vec3 pointLight = calculatePointLight(normal, fragmentPos, viewVector);
-    vec3 spotlight = calculateSpotlight(normal, fragmentPos, viewVector);
-
-    // Combine lighting
-    color = directionalLight + pointLight + spotlight;
+    // Accumulate only the light sources compiled into this variant
+    color = vec3(0.0);
+#if NUM_DIRECTIONAL_LIGHTS > 0
+    for (int i = 0; i < NUM_DIRECTIONAL_LIGHTS; i++) {
+        color += calculateDirectionalLight(i, normal, viewVector);
+    }
+#endif
+#if NUM_POINT_LIGHTS > 0
+    for (int i = 0; i < NUM_POINT_LIGHTS; i++) {
+        color += calculatePointLight(i, normal, fragmentPos, viewVector);
+    }
+#endif
+#if NUM_SPOT_LIGHTS > 0
+    for (int i = 0; i < NUM_SPOT_LIGHTS; i++) {
+        color += calculateSpotlight(i, normal, fragmentPos, viewVector);
+    }
+#endif
 }
@@ -0,0 +1,14 @@
+#version 410 core
+
+// uniform inputs
+uniform sampler2D insetTexture;         // vista en primera persona dibujada fuera de pantalla
+
+// varying inputs
+layout(location = 0) in vec2 texCoord;
+
+// outputs
+out vec4 fragColorOut;
+
+void main() {
+    fragColorOut = vec4(texture(insetTexture, texCoord).rgb, 1.0);
+}
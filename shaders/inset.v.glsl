@@ -0,0 +1,10 @@
+#version 410 core
+
+// Quad que cubre todo el viewport, generado a partir de gl_VertexID (GL_TRIANGLE_STRIP de 4 vértices)
+layout(location = 0) out vec2 texCoord;
+
+void main() {
+    vec2 corner = vec2(gl_VertexID & 1, (gl_VertexID >> 1) & 1);
+    texCoord = corner;
+    gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
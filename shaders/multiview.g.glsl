@@ -0,0 +1,24 @@
+#version 410 core
+
+// Routes every triangle of a multi-view draw to the viewport of the view it was
+// transformed for.  Only needed when the vertex shader cannot write gl_ViewportIndex.
+
+layout(triangles) in;
+layout(triangle_strip, max_vertices = 3) out;
+
+// varying inputs
+layout(location = 0) in vec3 color[];          // lit color of each vertex
+layout(location = 1) flat in int viewIndex[];   // view selected by gl_InstanceID
+
+// varying outputs
+layout(location = 0) out vec3 fragColor;        // color to pass to fragment shader
+
+void main() {
+    for (int i = 0; i < 3; i++) {
+        gl_Position = gl_in[i].gl_Position;
+        gl_ViewportIndex = viewIndex[0];
+        fragColor = color[i];
+        EmitVertex();
+    }
+    EndPrimitive();
+}
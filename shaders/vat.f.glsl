@@ -0,0 +1,19 @@
+#version 410 core
+
+// uniform inputs
+uniform sampler2D diffuseMap;           // diffuse texture of the current mesh
+uniform vec3 lightDirection;            // direction light travels
+uniform vec3 lightColor;                // color of the directional light
+
+// varying inputs
+layout(location = 0) in vec2 texCoord;
+layout(location = 1) in vec3 normal;
+
+// outputs
+out vec4 fragColorOut;
+
+void main() {
+    vec4 diffuse = texture(diffuseMap, texCoord);
+    float lambert = max(dot(normalize(normal), -normalize(lightDirection)), 0.0);
+    fragColorOut = vec4(diffuse.rgb * lightColor * (0.2 + 0.8 * lambert), diffuse.a);
+}
@@ -0,0 +1,58 @@
+#version 410 core
+
+// uniform inputs
+uniform mat4 viewProjectionMatrix;      // View-Projection Matrix
+uniform float time;                     // seconds since start
+uniform sampler2D positionTexture;      // baked vertex positions
+uniform sampler2D normalTexture;        // baked vertex normals
+uniform int numVertices;                // vertices per sample
+uniform int numSamples;                 // samples in the clip
+uniform float sampleRate;               // samples per second
+uniform int textureWidth;               // texels per row
+uniform int rowsPerSample;              // rows occupied by one sample
+
+// attribute inputs
+layout(location = 0) in vec2 vTexCoord;         // per vertex texture coordinate
+layout(location = 1) in vec4 iPositionHeading;  // per instance world position (xyz) and heading (w)
+layout(location = 2) in vec2 iPhaseSpeed;       // per instance clip offset (x) and playback speed (y)
+
+// varying outputs
+layout(location = 0) out vec2 texCoord;
+layout(location = 1) out vec3 normal;
+
+ivec2 texelFor(int sampleIndex, int vertexIndex) {
+    return ivec2(vertexIndex % textureWidth, sampleIndex * rowsPerSample + vertexIndex / textureWidth);
+}
+
+void main() {
+    // locate this instance within the looping clip
+    float samplePosition = (iPhaseSpeed.x + time * iPhaseSpeed.y) * sampleRate;
+    samplePosition = mod(samplePosition, float(numSamples));
+    int currSample = int(samplePosition) % numSamples;
+    int nextSample = (currSample + 1) % numSamples;
+    float interp = fract(samplePosition);
+
+    // gl_VertexID is the index value, which addresses the concatenated baked vertex
+    vec3 position = mix(texelFetch(positionTexture, texelFor(currSample, gl_VertexID), 0).xyz,
+                        texelFetch(positionTexture, texelFor(nextSample, gl_VertexID), 0).xyz,
+                        interp);
+    vec3 objNormal = normalize(mix(texelFetch(normalTexture, texelFor(currSample, gl_VertexID), 0).xyz,
+                                   texelFetch(normalTexture, texelFor(nextSample, gl_VertexID), 0).xyz,
+                                   interp));
+
+    // MD5 models are Z-up, rotate into Y-up then spin about Y by the heading
+    float c = cos(iPositionHeading.w);
+    float s = sin(iPositionHeading.w);
+    mat3 orientation = mat3( c, 0.0, -s,
+                             0.0, 1.0, 0.0,
+                             s, 0.0, c )
+                     * mat3( 1.0, 0.0, 0.0,
+                             0.0, 0.0, -1.0,
+                             0.0, 1.0, 0.0 );
+
+    vec3 worldPosition = orientation * position + iPositionHeading.xyz;
+    gl_Position = viewProjectionMatrix * vec4(worldPosition, 1.0);
+
+    texCoord = vTexCoord;
+    normal = orientation * objNormal;
+}